@@ -8,3 +8,10 @@ REM
 REM To log any details to the email report, use ECHO like so:
 REM   (ECHO "Here are some details about the custom step.")>>%abs_detailed_report_file%
 REM -------------------------------------------------------------------------------------------------------------------
+
+REM Cook the racetracks with the server that was just built so the .ctrk files sit beside the .trk files. A racetrack
+REM   without a matching .ctrk still loads, only slower, so failing to cook is reported but not fatal.
+CALL "%CD%\scripts\cook_racetracks.bat" --build-config public
+IF ERRORLEVEL 1 (
+	(ECHO "Failed to cook the racetracks, they will be derived as they load.")>>%abs_detailed_report_file%
+)
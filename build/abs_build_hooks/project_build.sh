@@ -8,3 +8,9 @@
 # To log any details to the email report, use printf like so:
 #   printf "Here are some details about the custom step." >> "$abs_detailed_report_file"
 # -------------------------------------------------------------------------------------------------------------------
+
+# Cook the racetracks with the server that was just built so the .ctrk files sit beside the .trk files. A racetrack
+#   without a matching .ctrk still loads, only slower, so failing to cook is reported but not fatal.
+if ! ./scripts/cook_racetracks.sh --build-config public; then
+	printf "Failed to cook the racetracks, they will be derived as they load.\n" >> "$abs_detailed_report_file"
+fi
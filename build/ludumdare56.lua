@@ -166,6 +166,11 @@ elseif (MACOS_SYSTEM_NAME == SYSTEM_NAME) then ---------------------------------
 		INTERNAL_COMBUSTION_DIRECTORY .. "source/",
 		TRACK_BUILDER_DIRECTORY .. "includes/"
 	}
+
+	-- Clang contracts into fused multiply-adds on Apple silicon, see the Linux notes below.
+	filter "files:../source/game_state/helpers/swarm_*.cpp or ../source/game_state/racecar_state.cpp"
+		buildoptions "-ffp-contract=off"
+	filter {}
 elseif (LINUX_SYSTEM_NAME == SYSTEM_NAME) then --------------------------------- Linux Platform Specifics (ALL projects)
 	includedirs {
 		"/usr/includes/GL/"
@@ -174,6 +179,18 @@ elseif (LINUX_SYSTEM_NAME == SYSTEM_NAME) then ---------------------------------
 		"../external_libraries/libraries/gmake/x64",
 		"/opt/lib/"
 	}
+
+	-- The swarm kernels pick AVX2 at runtime, so only the one file is allowed to use it. MSVC does not need a flag for
+	--   the intrinsics, and macOS/web stay on the SSE2/scalar kernels.
+	filter "files:../source/game_state/helpers/swarm_kernels_avx2.cpp"
+		buildoptions "-mavx2"
+	filter {}
+
+	-- Fusing multiply-adds changes the rounding, so the swarm math that deterministic swarms rely on must not be
+	--   contracted. MSVC only contracts with /fp:contract, which is not used.
+	filter "files:../source/game_state/helpers/swarm_*.cpp or ../source/game_state/racecar_state.cpp"
+		buildoptions "-ffp-contract=off"
+	filter {}
 elseif (WEB_SYSTEM_NAME == SYSTEM_NAME) then ------------------------ Web (Emscripten) Platform Specifics (ALL projects)
 	-- 2024-08-06: May need define tb_without_networking again, but waiting until we make a web_build.
 	defines { "tb_without_legacy_gl", "tb_without_threading" }
@@ -0,0 +1,51 @@
+@ECHO off
+setlocal enabledelayedexpansion
+
+REM
+REM Automated Build Script for LudumDare56 to cook the racetracks in run\data\racetracks\ into the .ctrk files beside
+REM   them with an executable that was already built and copied into the run area by post_build.
+REM
+REM <!-- Copyright (c) 2024 Tyre Bytes LLC - All Rights Reserved -->
+REM
+REM Usage: cook_racetracks.bat [--build-config public] [--name ludumdare56_server] [--racetrack name]
+REM -------------------------------------------------------------------------------------------------------------------
+
+SET buildConfig=public
+SET executableName=ludumdare56_server
+SET racetrackName=
+SET runDirectory=%~dp0..\..\run\
+
+:process_arguments_loop
+	IF "%~1"=="" GOTO :arguments_processed
+	IF "--build-config"=="%~1" (
+		SET buildConfig=%~2
+		SHIFT
+	) ELSE IF "--name"=="%~1" (
+		SET executableName=%~2
+		SHIFT
+	) ELSE IF "--racetrack"=="%~1" (
+		SET racetrackName=%~2
+		SHIFT
+	)
+	SHIFT
+	GOTO :process_arguments_loop
+:arguments_processed
+
+REM -------------------------------------------------------------------------------------------------------------------
+
+SET executable=%executableName%_%buildConfig%.exe
+IF NOT EXIST "%runDirectory%%executable%" (
+	ECHO "Unable to cook the racetracks, missing %executable% in the run directory; build it first."
+	EXIT /B 404
+)
+
+PUSHD "%runDirectory%"
+IF DEFINED racetrackName (
+	"%executable%" --cook_racetracks --racetrack "%racetrackName%"
+) ELSE (
+	"%executable%" --cook_racetracks
+)
+SET cookResult=%ERRORLEVEL%
+POPD
+
+EXIT /B %cookResult%
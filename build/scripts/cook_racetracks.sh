@@ -0,0 +1,63 @@
+#!/usr/bin/env bash
+
+#
+# Automated Build Script for LudumDare56 to cook the racetracks in run/data/racetracks/ into the .ctrk files beside
+#   them with an executable that was already built and copied into the run area by post_build.
+#
+# <!-- Copyright (c) 2024 Tyre Bytes LLC - All Rights Reserved -->
+#---------------------------------------------------------------------------------------------------------------------#
+
+buildConfig=public
+executableName=ludumdare56_server
+racetrackName=
+
+while [[ $# -gt 0 ]]; do
+	case "$1" in
+		--help ) FLAG_HELP=true; shift ;;
+		--build-config ) buildConfig="$2"; shift 2 ;;
+		--name ) executableName="$2"; shift 2 ;;
+		--racetrack ) racetrackName="$2"; shift 2 ;;
+		-* ) echo "Unknown parameter \"$1\""; exit 2 ;;
+		* ) shift ;;
+	esac
+done
+
+print_usage() {
+	cat <<USAGE
+Usage:
+  $0 [flags]
+
+Flags:
+  --help           show this help
+  --build-config   the build configuration of the executable to cook with; debug, development, release, public.
+  --name           the name of the executable, ludumdare56_server by default.
+  --racetrack      cook only this racetrack, by name, instead of every racetrack.
+USAGE
+}
+
+if [[ "$FLAG_HELP" == true ]]; then
+	print_usage
+	exit 0
+fi
+
+#---------------------------------------------------------------------------------------------------------------------#
+
+DIR=`dirname "$(readlink -f "$0")"`
+runDirectory="${DIR}/../../run"
+
+buildPlatform=linux
+if [ "Darwin" == "$(uname)" ]; then
+	buildPlatform=macos
+fi
+
+executable="./${executableName}_${buildPlatform}_${buildConfig}"
+if [ ! -x "${runDirectory}/${executable}" ]; then
+	echo "Unable to cook the racetracks, missing ${executable} in the run directory; build it first."
+	exit 404
+fi
+
+if [ -z ${racetrackName} ]; then
+	(cd "${runDirectory}" && ${executable} --cook_racetracks)
+else
+	(cd "${runDirectory}" && ${executable} --cook_racetracks --racetrack "${racetrackName}")
+fi
@@ -0,0 +1,178 @@
+///
+/// @file
+/// @details A small pool of worker threads for splitting independent pieces of a simulation step across cores.
+///
+/// <!-- Copyright (c) 2024 Tyre Bytes LLC - All Rights Reserved -->
+///------------------------------------------------------------------------------------------------------------------///
+
+#include "../core/worker_pool.hpp"
+
+#include <algorithm>
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+size_t TyreBytes::Core::WorkerPool::GetRecommendedNumberOfWorkers(const size_t maximumTasks)
+{
+#if defined(tb_without_threading)
+	(void)maximumTasks;
+	return 0;
+#else
+	const size_t hardwareThreads = static_cast<size_t>(std::thread::hardware_concurrency());
+	const size_t availableWorkers = (hardwareThreads > 1) ? hardwareThreads - 1 : 0;
+	return std::min(availableWorkers, (maximumTasks > 1) ? maximumTasks - 1 : 0);
+#endif /* tb_without_threading */
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+#if defined(tb_without_threading)
+
+TyreBytes::Core::WorkerPool::WorkerPool(const size_t /*numberOfWorkers*/)
+{
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+TyreBytes::Core::WorkerPool::~WorkerPool(void)
+{
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+size_t TyreBytes::Core::WorkerPool::GetNumberOfWorkers(void) const
+{
+	return 0;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void TyreBytes::Core::WorkerPool::ParallelFor(const size_t numberOfTasks, const TaskFunction& task)
+{
+	for (size_t taskIndex = 0; taskIndex < numberOfTasks; ++taskIndex)
+	{
+		task(taskIndex);
+	}
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+#else /* tb_without_threading */
+
+TyreBytes::Core::WorkerPool::WorkerPool(const size_t numberOfWorkers) :
+	mWorkers(),
+	mMutex(),
+	mWorkAvailable(),
+	mWorkFinished(),
+	mTask(nullptr),
+	mNumberOfTasks(0),
+	mNextTask(0),
+	mBusyWorkers(0),
+	mGeneration(0),
+	mIsQuitting(false)
+{
+	mWorkers.reserve(numberOfWorkers);
+	for (size_t workerIndex = 0; workerIndex < numberOfWorkers; ++workerIndex)
+	{
+		mWorkers.emplace_back(&WorkerPool::WorkerLoop, this);
+	}
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+TyreBytes::Core::WorkerPool::~WorkerPool(void)
+{
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		mIsQuitting = true;
+	}
+
+	mWorkAvailable.notify_all();
+	for (std::thread& worker : mWorkers)
+	{
+		worker.join();
+	}
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+size_t TyreBytes::Core::WorkerPool::GetNumberOfWorkers(void) const
+{
+	return mWorkers.size();
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void TyreBytes::Core::WorkerPool::ParallelFor(const size_t numberOfTasks, const TaskFunction& task)
+{
+	if (true == mWorkers.empty() || numberOfTasks <= 1)
+	{
+		for (size_t taskIndex = 0; taskIndex < numberOfTasks; ++taskIndex)
+		{
+			task(taskIndex);
+		}
+
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(mMutex);
+		mTask = &task;
+		mNumberOfTasks = numberOfTasks;
+		mNextTask = 0;
+		mBusyWorkers = mWorkers.size();
+		++mGeneration;
+	}
+
+	mWorkAvailable.notify_all();
+	RunTasks();
+
+	std::unique_lock<std::mutex> lock(mMutex);
+	mWorkFinished.wait(lock, [this]() { return 0 == mBusyWorkers; });
+	mTask = nullptr;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void TyreBytes::Core::WorkerPool::WorkerLoop(void)
+{
+	tbCore::uint64 lastGeneration = 0;
+
+	while (true)
+	{
+		{
+			std::unique_lock<std::mutex> lock(mMutex);
+			mWorkAvailable.wait(lock, [this, lastGeneration]() { return true == mIsQuitting || lastGeneration != mGeneration; });
+			if (true == mIsQuitting)
+			{
+				return;
+			}
+
+			lastGeneration = mGeneration;
+		}
+
+		RunTasks();
+
+		{
+			std::lock_guard<std::mutex> lock(mMutex);
+			--mBusyWorkers;
+			if (0 == mBusyWorkers)
+			{
+				mWorkFinished.notify_one();
+			}
+		}
+	}
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void TyreBytes::Core::WorkerPool::RunTasks(void)
+{
+	for (size_t taskIndex = mNextTask.fetch_add(1); taskIndex < mNumberOfTasks; taskIndex = mNextTask.fetch_add(1))
+	{
+		(*mTask)(taskIndex);
+	}
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+#endif /* tb_without_threading */
@@ -0,0 +1,78 @@
+///
+/// @file
+/// @details A small pool of worker threads for splitting independent pieces of a simulation step across cores.
+///
+/// <!-- Copyright (c) 2024 Tyre Bytes LLC - All Rights Reserved -->
+///------------------------------------------------------------------------------------------------------------------///
+
+#ifndef TyreBytes_WorkerPool_hpp
+#define TyreBytes_WorkerPool_hpp
+
+#include <turtle_brains/core/tb_types.hpp>
+
+#include <functional>
+
+#if !defined(tb_without_threading)
+  #include <atomic>
+  #include <condition_variable>
+  #include <mutex>
+  #include <thread>
+  #include <vector>
+#endif /* tb_without_threading */
+
+namespace TyreBytes
+{
+	namespace Core
+	{
+
+		///
+		/// @details The calling thread always works on the tasks alongside the workers, so a pool with zero workers, or
+		///   any pool built with tb_without_threading, simply runs every task in order on the calling thread.
+		///
+		class WorkerPool
+		{
+		public:
+			typedef std::function<void(const size_t taskIndex)> TaskFunction;
+
+			///
+			/// @details Returns the number of workers that keeps every core busy while leaving one for the caller, but
+			///   never more than the number of tasks that could ever be run at once.
+			///
+			static size_t GetRecommendedNumberOfWorkers(const size_t maximumTasks);
+
+			explicit WorkerPool(const size_t numberOfWorkers);
+			~WorkerPool(void);
+
+			WorkerPool(const WorkerPool& other) = delete;
+			WorkerPool& operator=(const WorkerPool& other) = delete;
+
+			size_t GetNumberOfWorkers(void) const;
+
+			///
+			/// @details Calls task once for each index from 0 to numberOfTasks - 1 and returns once all of them are
+			///   complete. The tasks may run in any order and at the same time, so each must only touch its own data.
+			///
+			void ParallelFor(const size_t numberOfTasks, const TaskFunction& task);
+
+		private:
+#if !defined(tb_without_threading)
+			void WorkerLoop(void);
+			void RunTasks(void);
+
+			std::vector<std::thread> mWorkers;
+			std::mutex mMutex;
+			std::condition_variable mWorkAvailable;
+			std::condition_variable mWorkFinished;
+			const TaskFunction* mTask;
+			size_t mNumberOfTasks;
+			std::atomic<size_t> mNextTask;
+			size_t mBusyWorkers;
+			tbCore::uint64 mGeneration;
+			bool mIsQuitting;
+#endif /* tb_without_threading */
+		};
+
+	};	//namespace Core
+};	//namespace TyreBytes
+
+#endif /* TyreBytes_WorkerPool_hpp */
@@ -23,7 +23,7 @@ LudumDare56::GameClient::SwarmHealthBar::SwarmHealthBar(const GameState::Racecar
 	mRacecarIndex(racecarIndex),
 	mHealthBar()
 {
-	mHealthBar.SetTotal(GameState::RacecarState::kNumberOfCreatures);
+	mHealthBar.SetTotal(GameState::kDefaultCreaturesPerRacecar);
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
@@ -47,9 +47,10 @@ void LudumDare56::GameClient::SwarmHealthBar::OnUpdate(const float deltaTime)
 	{
 		SetVisible(true);
 
-		const GameState::RacecarState::CreatureIndex total = GameState::RacecarState::kNumberOfCreatures;
-		const GameState::RacecarState::CreatureIndex health = GameState::RacecarState::Get(mRacecarIndex).GetSwarmHealth();
-		const GameState::RacecarState::CreatureIndex min = GameState::RacecarState::kMinimumCreatures;;
+		const GameState::RacecarState& racecar = GameState::RacecarState::Get(mRacecarIndex);
+		const GameState::RacecarState::CreatureIndex total = racecar.GetNumberOfCreatures();
+		const GameState::RacecarState::CreatureIndex health = racecar.GetSwarmHealth();
+		const GameState::RacecarState::CreatureIndex min = racecar.GetMinimumCreatures();
 
 		mHealthBar.SetTotal(total - min);
 		mHealthBar.SetCount(health - min);
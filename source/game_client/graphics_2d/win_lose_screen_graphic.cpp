@@ -109,14 +109,14 @@ void LudumDare56::GameClient::WinLoseScreenGraphic::OnUpdate(const float deltaTi
 			mYouWinText.SetPosition(ui::GetAnchorPositionOfInterface(tbGraphics::kAnchorCenter, Vector2(0.0f, -80.0f) * interfaceScale));
 			mYouWinText.SetScale(interfaceScale);
 
-			if (racecar.GetSwarmHealth() == GameState::RacecarState::kNumberOfCreatures)
+			if (racecar.GetSwarmHealth() == racecar.GetNumberOfCreatures())
 			{
 				mWinStatusText.SetText("Flawless Victory! All Ants Survived.");
 				mWinStatusText.SetColor(tbGraphics::ColorPalette::Green);
 			}
 			else
 			{
-				int lost = GameState::RacecarState::kNumberOfCreatures - racecar.GetSwarmHealth();
+				int lost = racecar.GetNumberOfCreatures() - racecar.GetSwarmHealth();
 				mWinStatusText.SetText("But at what cost? " + tb_string(lost) + " crashed.");
 				mWinStatusText.SetColor(tbGraphics::ColorPalette::Red);
 			}
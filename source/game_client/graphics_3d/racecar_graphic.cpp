@@ -13,6 +13,11 @@
 
 bool LudumDare56::GameClient::RacecarGraphic::sDisplayCarNumbers = true;
 
+namespace
+{
+	const std::minstd_rand::result_type kCreatureMeshSeed = 56;
+};
+
 //--------------------------------------------------------------------------------------------------------------------//
 
 LudumDare56::GameClient::RacecarGraphic::RacecarGraphic(void) :
@@ -21,6 +26,8 @@ LudumDare56::GameClient::RacecarGraphic::RacecarGraphic(void) :
 	mRacecarGraphic(),
 	mWheelGraphics(),
 	mCreatureGraphics(),
+	mVisibleCreatures(),
+	mCreatureMeshRandom(kCreatureMeshSeed),
 	mLagText("LAG", 15.0f),
 	mCarText("", 20.0f)
 {
@@ -34,13 +41,8 @@ LudumDare56::GameClient::RacecarGraphic::RacecarGraphic(void) :
 		mRacecarGraphic.AddGraphic(wheelGraphic);
 	}
 
-	for (iceGraphics::Graphic& creatureGraphic : mCreatureGraphics)
-	{
-		creatureGraphic.SetMesh(GameState::RacecarState::GetCarFilepath(
-			tbCore::RangedCast<tbCore::uint8>(rand() % GameState::RacecarState::GetAvailableCars(false, false).size())
-		));
-		creatureGraphic.SetMaterial("data/materials/palette256.mat");
-	}
+	mCreatureGraphics.reserve(GameState::RacecarState::kMaximumCreatures);
+	mVisibleCreatures.reserve(GameState::RacecarState::kMaximumCreatures);
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
@@ -104,13 +106,8 @@ void LudumDare56::GameClient::RacecarGraphic::Update(const float /*deltaTime*/)
 		}
 	}
 
-	CreatureIndex creatureIndex = 0;
-	for (iceGraphics::Graphic& creatureGraphic : mCreatureGraphics)
-	{
-		const tbMath::Matrix4 creatureToWorld = static_cast<tbMath::Matrix4>(racecar.GetCreatureToWorld(creatureIndex));
-		creatureGraphic.SetObjectToWorld(creatureToWorld);
-		++creatureIndex;
-	}
+	MatchCreatureGraphics(racecar);
+	UpdateCreatureGraphics(racecar);
 
 	size_t wheelIndex = 0;
 	for (iceGraphics::Graphic& wheelGraphic : mWheelGraphics)
@@ -128,3 +125,50 @@ void LudumDare56::GameClient::RacecarGraphic::Update(const float /*deltaTime*/)
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
+
+void LudumDare56::GameClient::RacecarGraphic::MatchCreatureGraphics(const GameState::RacecarState& racecar)
+{
+	const CreatureIndex::Integer numberOfCreatures = racecar.GetNumberOfCreatures();
+	if (mCreatureGraphics.size() >= numberOfCreatures)
+	{
+		return;
+	}
+
+	const size_t availableCars = GameState::RacecarState::GetAvailableCars(false, false).size();
+	while (mCreatureGraphics.size() < numberOfCreatures)
+	{
+		GraphicPtr creatureGraphic(new iceGraphics::Graphic());
+		creatureGraphic->SetMesh(GameState::RacecarState::GetCarFilepath(
+			tbCore::RangedCast<tbCore::uint8>(mCreatureMeshRandom() % availableCars)
+		));
+		creatureGraphic->SetMaterial("data/materials/palette256.mat");
+		creatureGraphic->SetVisible(false);
+		mCreatureGraphics.push_back(std::move(creatureGraphic));
+	}
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void LudumDare56::GameClient::RacecarGraphic::UpdateCreatureGraphics(const GameState::RacecarState& racecar)
+{
+	//Only those shown last Update() can need hiding, a creature beyond a smaller swarm size is never alive.
+	for (const CreatureIndex::Integer creatureIndex : mVisibleCreatures)
+	{
+		if (creatureIndex >= racecar.GetNumberOfCreatures() || false == racecar.IsCreatureAlive(creatureIndex))
+		{
+			mCreatureGraphics[creatureIndex]->SetVisible(false);
+		}
+	}
+
+	const std::span<const CreatureIndex::Integer> aliveCreatures = racecar.GetAliveCreatures();
+	for (const CreatureIndex::Integer creatureIndex : aliveCreatures)
+	{
+		const tbMath::Matrix4 creatureToWorld = static_cast<tbMath::Matrix4>(racecar.GetCreatureToWorld(creatureIndex));
+		mCreatureGraphics[creatureIndex]->SetObjectToWorld(creatureToWorld);
+		mCreatureGraphics[creatureIndex]->SetVisible(true);
+	}
+
+	mVisibleCreatures.assign(aliveCreatures.begin(), aliveCreatures.end());
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
@@ -17,6 +17,9 @@
 
 #include <ice/graphics/ice_graphic.hpp>
 
+#include <random>
+#include <vector>
+
 namespace LudumDare56
 {
 	namespace GameClient
@@ -41,13 +44,27 @@ namespace LudumDare56
 
 		private:
 			typedef GameState::RacecarState::CreatureIndex CreatureIndex;
-			static constexpr CreatureIndex kNumberOfCreatures = GameState::RacecarState::kNumberOfCreatures;
+
+			///
+			/// @details Creates graphics, hidden, for any creatures the racecar has that do not yet have one.
+			///
+			void MatchCreatureGraphics(const GameState::RacecarState& racecar);
+
+			///
+			/// @details Hides the graphics of the creatures that died since the last Update(), then shows and places those
+			///   of every creature still alive, without visiting the dead ones.
+			///
+			void UpdateCreatureGraphics(const GameState::RacecarState& racecar);
 
 			tbCore::uint8 mRacecarIndex;
 			tbCore::uint8 mRacecarMeshID;
 			iceGraphics::Graphic mRacecarGraphic;
 			std::array<iceGraphics::Graphic, 4> mWheelGraphics;
-			std::array<iceGraphics::Graphic, kNumberOfCreatures> mCreatureGraphics;
+			std::vector<GraphicPtr> mCreatureGraphics;
+			std::vector<CreatureIndex::Integer> mVisibleCreatures;
+
+			//Creature graphics are only ever added in order, so creature N gets the same mesh on every machine.
+			std::minstd_rand mCreatureMeshRandom;
 
 			tbGraphics::Text mLagText;
 			tbGraphics::Text mCarText;
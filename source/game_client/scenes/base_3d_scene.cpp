@@ -15,6 +15,7 @@
 
 #if defined(development_build)
 #include "../../game_state/racecar_state.hpp"
+#include "../../game_state/helpers/simulation_scheduler.hpp"
 #include "../../core/development/tb_imgui_implementation.hpp"
 #include "../../core/development/developer_console.hpp"
 #endif /* development_build */
@@ -208,10 +209,44 @@ void LudumDare56::GameClient::Base3dScene::DisplayDeveloperConsole(void) const
 		if (true == ImGui::Begin("Profiler"))
 		{
 			TyreBytes::Core::Development::FrameProfiler::ImGuiShowPerformance(mProfiler);
+
+			const GameState::SimulationScheduler& scheduler = GameState::RaceSessionState::GetScheduler();
+			ImGui::Text("Subsystem         Rate  Average     Peak");
+			for (size_t subsystemIndex = 0; subsystemIndex < scheduler.GetNumberOfSubsystems(); ++subsystemIndex)
+			{
+				const TyreBytes::Core::Development::TimeProfiler& profiler = scheduler.GetProfiler(subsystemIndex);
+				ImGui::Text("%-16s 1/%-3u %6.3fms %6.3fms", scheduler.GetName(subsystemIndex).c_str(), scheduler.GetDivisor(subsystemIndex),
+					static_cast<float>(profiler.GetAverageTime()) / 1000.0f, static_cast<float>(profiler.GetMaximumPeak()) / 1000.0f);
+			}
+
 			Network::Development::ImGuiShowNetworkHistory();
 		}
 		ImGui::End();
 
+		ImGui::SetNextWindowSize(ImVec2(480, 160), ImGuiCond_FirstUseEver);
+		ImGui::SetNextWindowPos(ImVec2(794, 360), ImGuiCond_FirstUseEver);
+		if (true == ImGui::Begin("Swarm Level of Detail"))
+		{
+			typedef GameState::SwarmLevelOfDetail SwarmLevelOfDetail;
+			ImGui::Text("Racecar     Full    Half Quarter  Eighth Updated");
+			for (const GameState::RacecarState& racecar : GameState::RacecarState::AllRacecars())
+			{
+				if (false == racecar.IsRacecarInUse())
+				{
+					continue;
+				}
+
+				const SwarmLevelOfDetail& levelOfDetail = racecar.GetSwarmLevelOfDetail();
+				ImGui::Text("%7d %8u%8u%8u%8u%8u", static_cast<int>(static_cast<GameState::RacecarIndex::Integer>(racecar.GetRacecarIndex())),
+					levelOfDetail.GetTierCount(SwarmLevelOfDetail::kFullRate),
+					levelOfDetail.GetTierCount(SwarmLevelOfDetail::kHalfRate),
+					levelOfDetail.GetTierCount(SwarmLevelOfDetail::kQuarterRate),
+					levelOfDetail.GetTierCount(SwarmLevelOfDetail::kEighthRate),
+					levelOfDetail.GetUpdatedCount());
+			}
+		}
+		ImGui::End();
+
 		//if (true == ImGui::Begin("Property Mess"))
 		//{
 		//	extern icePhysics::Scalar kCohesionDistance;
@@ -18,6 +18,7 @@
 #include "../../game_state/racetrack_state.hpp"
 #include "../../game_state/timing_and_scoring_state.hpp"
 #include "../../game_state/ai/artificial_driver_controller.hpp"
+#include "../../game_state/helpers/swarm_level_of_detail.hpp"
 #include "../../game_state/events/driver_events.hpp"
 #include "../../game_state/events/racecar_events.hpp"
 #include "../../game_state/events/timing_events.hpp"
@@ -66,6 +67,7 @@ LudumDare56::GameClient::RacingScene::RacingScene(void) :
 	mToggleInfoAction(tbApplication::tbKeyN),
 
 	mCamera(),
+	mSwarmAudio(),
 
 	mRacetrack(),
 	mRacecarArray(),
@@ -202,6 +204,11 @@ void LudumDare56::GameClient::RacingScene::OnUpdate(const float deltaTime)
 	mCamera.SetMovementSpeed(50.0f);
 	mCamera.Update(GetCamera(), deltaTime);
 
+	{	//Creatures outside of the view get steered less often, never probed less often, see SwarmLevelOfDetail.
+		const iceMatrix4 viewToWorld = static_cast<iceMatrix4>(GetCamera().GetWorldToView()).FastInverse();
+		GameState::SwarmLevelOfDetail::SetClientView(viewToWorld.GetPosition(), -viewToWorld.GetBasis(2));
+	}
+
 	const GameState::RacecarIndex viewedRacecar = mCamera.GetViewedRacecarIndex();
 	mRacecarTachometer.SetRacecarIndex(viewedRacecar);
 	mSwarmHealthBar.SetRacecarIndex(viewedRacecar);
@@ -215,6 +222,8 @@ void LudumDare56::GameClient::RacingScene::OnUpdate(const float deltaTime)
 		racecar.Update(deltaTime);
 	}
 
+	mSwarmAudio.Update(viewedRacecar);
+
 	if (false == mSettingsScreen.IsDisplayingSettings() && true == tbApplication::Input::IsKeyReleased(tbApplication::tbKeyEscape))
 	{
 #if defined(development_build)
@@ -336,6 +345,8 @@ void LudumDare56::GameClient::RacingScene::OnOpen(void)
 	//This is down here because we set thePlayerRacecarIndex in the middle...
 	AddGraphic(new WinLoseScreenGraphic(thePlayerRacecarIndex));
 
+	mSwarmAudio.Open();
+
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
@@ -344,6 +355,9 @@ void LudumDare56::GameClient::RacingScene::OnClose(void)
 {
 	tb_debug_log(LogClient::Info() << "Closing RacingScene.");
 
+	GameState::SwarmLevelOfDetail::ClearClientView();
+	mSwarmAudio.Close();
+
 	for (GameState::RacecarState& racecar : GameState::RacecarState::AllMutableRacecars())
 	{
 		racecar.RemoveEventListener(*this);
@@ -17,6 +17,7 @@
 #include "../../game_client/entities_2d/settings_screen_entity.hpp"
 #include "../../game_client/entities_2d/player_standings_entity.hpp"
 #include "../../game_client/camera_controller.hpp"
+#include "../../game_client/swarm_audio_observer.hpp"
 #include "../../game_state/racecar_controller_interface.hpp"
 #include "../../game_state/race_session_state.hpp"
 #include "../../ludumdare56.hpp"
@@ -94,6 +95,7 @@ namespace LudumDare56
 			tbGame::InputAction mToggleInfoAction;
 
 			CameraController mCamera;
+			SwarmAudioObserver mSwarmAudio;
 
 			RacetrackGraphic mRacetrack;
 			RacecarArray mRacecarArray;
@@ -0,0 +1,187 @@
+///
+/// @file
+/// @details Plays the engine, crash and start sounds of a racecar swarm from what the simulation gathered, so the
+///   simulation itself, and therefore the dedicated server, never does any audio work.
+///
+/// <!-- Copyright (c) 2024 Tyre Bytes LLC - All Rights Reserved -->
+///------------------------------------------------------------------------------------------------------------------///
+
+#include "../game_client/swarm_audio_observer.hpp"
+
+namespace
+{
+	const size_t kMaximumCrashSounds = 5;
+
+	//Fluffy made that math happen; the pitch goes from 0.75 at 1m/s up to maxPitch at 35m/s.
+	float CalculatePitch(const float speed, const float maxPitch)
+	{
+		const float minSpeed = 1.0f;
+		const float maxSpeed = 35.0f;
+		const float minPitch = 0.75f;
+
+		const float slope = (maxPitch - minPitch) / (maxSpeed - minSpeed);
+		return slope * (speed - minSpeed) + minPitch;
+	}
+};
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+LudumDare56::GameClient::SwarmAudioObserver::SwarmAudioObserver(void) :
+	mEngineControllers(),
+	mCrashSounds(),
+	mStartCueController(),
+	mMusicController(),
+	mRacecarIndex(GameState::InvalidRacecar()),
+	mNumberOfCrashes(0),
+	mNumberOfResets(0)
+{
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+LudumDare56::GameClient::SwarmAudioObserver::~SwarmAudioObserver(void)
+{
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void LudumDare56::GameClient::SwarmAudioObserver::Open(void)
+{
+	mEngineControllers = std::array<tbAudio::AudioController, GameState::RacecarState::kNumberOfEngineChannels>{
+		tbAudio::theAudioManager.PlayEvent("audio_events", "engine_1"),
+		tbAudio::theAudioManager.PlayEvent("audio_events", "engine_2"),
+		tbAudio::theAudioManager.PlayEvent("audio_events", "engine_3")
+	};
+
+	SilenceEngines();
+
+	mStartCueController = tbAudio::theAudioManager.PlayEvent("audio_events", "start_countdown");
+	mStartCueController.Stop();
+
+	if (true == mMusicController.IsComplete())
+	{
+		mMusicController = tbAudio::theAudioManager.PlayEvent("audio_events", "music");
+	}
+
+	mRacecarIndex = GameState::InvalidRacecar();
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void LudumDare56::GameClient::SwarmAudioObserver::Close(void)
+{
+	mStartCueController.Stop();
+	for (tbAudio::AudioController& controller : mEngineControllers)
+	{
+		controller.Stop();
+	}
+
+	mRacecarIndex = GameState::InvalidRacecar();
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void LudumDare56::GameClient::SwarmAudioObserver::Update(const GameState::RacecarIndex racecarIndex)
+{
+	for (size_t index = 0; index < mCrashSounds.size(); /* in loop */)
+	{
+		if (true == mCrashSounds[index].IsComplete())
+		{
+			mCrashSounds[index] = mCrashSounds.back();
+			mCrashSounds.pop_back();
+		}
+		else
+		{
+			++index;
+		}
+	}
+
+	if (false == GameState::IsValidRacecar(racecarIndex) || false == GameState::RacecarState::Get(racecarIndex).IsRacecarInUse())
+	{
+		mRacecarIndex = GameState::InvalidRacecar();
+		SilenceEngines();
+		return;
+	}
+
+	if (racecarIndex != mRacecarIndex)
+	{
+		FollowRacecar(racecarIndex);
+	}
+
+	const GameState::RacecarState& racecar = GameState::RacecarState::Get(racecarIndex);
+	const SwarmAudio& swarmAudio = racecar.GetSwarmAudio();
+
+	if (swarmAudio.mNumberOfResets != mNumberOfResets)
+	{	//Only the latest reset matters, the grid holds the racecars in place by resetting them over and over.
+		mNumberOfResets = swarmAudio.mNumberOfResets;
+		if (swarmAudio.mResetWorldTimer < 100 && true == mStartCueController.IsComplete())
+		{
+			mStartCueController.Play();
+		}
+		else if (swarmAudio.mResetWorldTimer > 5000)
+		{
+			tbAudio::theAudioManager.PlayEvent("audio_events", "start");
+		}
+	}
+
+	for (/* nothing */; mNumberOfCrashes != swarmAudio.mNumberOfCrashes; ++mNumberOfCrashes)
+	{
+		if (mCrashSounds.size() < kMaximumCrashSounds)
+		{
+			mCrashSounds.push_back(tbAudio::theAudioManager.PlayEvent("audio_events", "crash"));
+		}
+	}
+
+	size_t engineChannel = 0;
+	for (tbAudio::AudioController& controller : mEngineControllers)
+	{
+		const float speed = swarmAudio.mEngineSpeeds[engineChannel];
+		if (speed < 0.0f)
+		{
+			if (false == controller.IsComplete())
+			{
+				controller.Stop();
+			}
+		}
+		else
+		{
+			controller.Play();
+			controller.SetPitch(CalculatePitch(speed, 1.5f));
+		}
+
+		++engineChannel;
+	}
+
+	float percentage = tbMath::Clamp(static_cast<float>(racecar.GetElapsedTime()) / 400.0f, 0.0f, 1.0f);
+	if (true == racecar.HasWon() || true == racecar.HasLost())
+	{
+		percentage = 0.0f;
+	}
+
+	for (tbAudio::AudioController& controller : mEngineControllers)
+	{
+		controller.SetVolume(percentage * 0.5f);
+	}
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void LudumDare56::GameClient::SwarmAudioObserver::FollowRacecar(const GameState::RacecarIndex racecarIndex)
+{
+	const SwarmAudio& swarmAudio = GameState::RacecarState::Get(racecarIndex).GetSwarmAudio();
+	mRacecarIndex = racecarIndex;
+	mNumberOfCrashes = swarmAudio.mNumberOfCrashes;
+	mNumberOfResets = swarmAudio.mNumberOfResets;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void LudumDare56::GameClient::SwarmAudioObserver::SilenceEngines(void)
+{
+	for (tbAudio::AudioController& controller : mEngineControllers)
+	{
+		controller.SetVolume(0.0f);
+	}
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
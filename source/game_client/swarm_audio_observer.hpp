@@ -0,0 +1,62 @@
+///
+/// @file
+/// @details Plays the engine, crash and start sounds of a racecar swarm from what the simulation gathered, so the
+///   simulation itself, and therefore the dedicated server, never does any audio work.
+///
+/// <!-- Copyright (c) 2024 Tyre Bytes LLC - All Rights Reserved -->
+///------------------------------------------------------------------------------------------------------------------///
+
+#ifndef LudumDare56_SwarmAudioObserver_hpp
+#define LudumDare56_SwarmAudioObserver_hpp
+
+#include "../game_state/race_session_state.hpp"
+#include "../game_state/racecar_state.hpp"
+
+#include <turtle_brains/audio/tb_audio_manager.hpp>
+
+#include <array>
+#include <vector>
+
+namespace LudumDare56
+{
+	namespace GameClient
+	{
+
+		class SwarmAudioObserver
+		{
+		public:
+			SwarmAudioObserver(void);
+			~SwarmAudioObserver(void);
+
+			///
+			/// @details Starts the engine channels (silent until there is a swarm to follow) and the music if it is not
+			///   already playing. Anything that happened to the swarms before opening is not played.
+			///
+			void Open(void);
+			void Close(void);
+
+			///
+			/// @details Called at render rate to play whatever happened to the swarm of the racecar since the last
+			///   Update(). Changing the racecar starts following it from its current state without replaying it.
+			///
+			void Update(const GameState::RacecarIndex racecarIndex);
+
+		private:
+			void FollowRacecar(const GameState::RacecarIndex racecarIndex);
+			void SilenceEngines(void);
+
+			typedef GameState::RacecarState::SwarmAudio SwarmAudio;
+
+			std::array<tbAudio::AudioController, GameState::RacecarState::kNumberOfEngineChannels> mEngineControllers;
+			std::vector<tbAudio::AudioController> mCrashSounds;
+			tbAudio::AudioController mStartCueController;
+			tbAudio::AudioController mMusicController;
+			GameState::RacecarIndex mRacecarIndex;
+			tbCore::uint32 mNumberOfCrashes;
+			tbCore::uint32 mNumberOfResets;
+		};
+
+	};	//namespace GameClient
+};	//namespace LudumDare56
+
+#endif /* LudumDare56_SwarmAudioObserver_hpp */
@@ -0,0 +1,232 @@
+///
+/// @file
+/// @details Runs the race session headless as fast as the machine allows, for evaluating the artificial drivers and
+///   gating performance offline.
+///
+/// <!-- Copyright (c) 2024 Tyre Bytes LLC - All Rights Reserved -->
+///------------------------------------------------------------------------------------------------------------------///
+
+#include "../game_server/fast_forward.hpp"
+
+#include "../game_state/race_session_state.hpp"
+#include "../game_state/racecar_state.hpp"
+#include "../game_state/timing_and_scoring_state.hpp"
+#include "../game_state/ai/artificial_driver_controller.hpp"
+#include "../game_state/events/race_session_events.hpp"
+#include "../game_state/events/timing_events.hpp"
+
+#include "../logging.hpp"
+
+#include <turtle_brains/core/debug/tb_debug_logger.hpp>
+
+#include <algorithm>
+#include <chrono>
+
+//Exists in race_session_state.cpp for starting track.
+extern tbCore::tbString theDefaultRacetrackName;
+
+namespace
+{
+	using namespace LudumDare56;
+
+	const tbCore::int64 kDefaultFastForwardSeconds = 3600; //An hour of racing, in steps at the tick rate.
+
+	//Simulated seconds between each progress report, so a long run shows it is still going.
+	const double kReportInterval = 600.0;
+
+	///
+	/// @details Stands in for the GameServer or singleplayer RacingScene, which would normally start the countdown on
+	///   the grid, and keeps track of the laps as they are completed.
+	///
+	class FastForwardObserver : public TyreBytes::Core::EventListener
+	{
+	public:
+		FastForwardObserver(void) :
+			mNumberOfLaps(0),
+			mNumberOfRaces(0),
+			mBestLapTime(0)
+		{
+		}
+
+		tbCore::int64 mNumberOfLaps;
+		tbCore::int64 mNumberOfRaces;
+		tbCore::uint32 mBestLapTime;
+
+	protected:
+		virtual void OnHandleEvent(const TyreBytes::Core::Event& event) override
+		{
+			switch (event.GetID())
+			{
+			case GameState::Events::RaceSession::RaceSessionPhaseChanged: {
+				const auto& phaseChangeEvent = event.As<GameState::Events::RaceSessionPhaseChangeEvent>();
+				if (GameState::RaceSessionState::SessionPhase::kPhaseGrid == phaseChangeEvent.mSessionPhase)
+				{
+					if (0 == phaseChangeEvent.mPhaseTimer)
+					{	//There is nobody to wait on, the same short countdown as singleplayer.
+						GameState::RaceSessionState::SetSessionPhase(GameState::RaceSessionState::SessionPhase::kPhaseGrid, 250);
+					}
+					else
+					{
+						++mNumberOfRaces;
+					}
+				}
+				break; }
+
+			case GameState::Events::Timing::CompletedLapResult: {
+				const auto& timingEvent = event.As<GameState::Events::TimingEvent>();
+				++mNumberOfLaps;
+				if (0 == mBestLapTime || timingEvent.mLapTime < mBestLapTime)
+				{
+					mBestLapTime = timingEvent.mLapTime;
+				}
+				break; }
+
+			default:
+				break;
+			};
+		}
+	};
+
+	///
+	/// @details The race only moves on once a racecar finishes, so when every swarm has been lost instead the session
+	///   is sent back to practice, which puts the racecars back on the grid for the next race.
+	///
+	bool HaveAllRacecarsLost(void)
+	{
+		using namespace GameState;
+
+		bool anyRacecarInUse = false;
+		for (const RacecarState& racecar : RacecarState::AllRacecars())
+		{
+			if (true == racecar.IsRacecarInUse())
+			{
+				if (false == racecar.HasLost())
+				{
+					return false;
+				}
+
+				anyRacecarInUse = true;
+			}
+		}
+
+		return anyRacecarInUse;
+	}
+
+	void LogProgress(const char* label, const double simulatedSeconds, const double wallSeconds, const FastForwardObserver& observer)
+	{
+		tb_log("%-10s %10.1f simulated seconds in %8.2f wall seconds, %8.1f simulated seconds per second, %d laps in %d races.\n",
+			label, simulatedSeconds, wallSeconds, simulatedSeconds / std::max(wallSeconds, 1.0e-9),
+			static_cast<int>(observer.mNumberOfLaps), static_cast<int>(observer.mNumberOfRaces));
+	}
+
+};	//namespace
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+int LudumDare56::GameServer::RunFastForward(int argumentCount, const char* argumentValues[])
+{
+	using namespace GameState;
+
+	const UserSettings launchSettings = ParseLaunchParameters(argumentCount, argumentValues);
+	const tbCore::tbString racetrack = launchSettings.GetString("racetrack");
+	if (false == racetrack.empty())
+	{
+		theDefaultRacetrackName = racetrack;
+	}
+
+	const tbCore::int64 requestedTickRate = launchSettings.GetInteger("tick_rate", kDefaultTickRate);
+	if (requestedTickRate < 0 || false == IsValidTickRate(static_cast<tbCore::uint32>(requestedTickRate)))
+	{
+		tb_always_log(LogServer::Error() << "The --tick_rate of " << requestedTickRate << " is not valid, see IsValidTickRate().");
+		return 1;
+	}
+
+	const tbCore::uint32 tickRate = static_cast<tbCore::uint32>(requestedTickRate);
+	const tbCore::int64 numberOfTicks = std::max<tbCore::int64>(1, launchSettings.GetInteger("benchmark_ticks", kDefaultFastForwardSeconds * tickRate));
+	const tbCore::int64 numberOfLaps = launchSettings.GetInteger("fast_forward_laps", 0);
+	const tbCore::int64 minimumRate = launchSettings.GetInteger("fast_forward_minimum_rate", 0);
+	RaceSessionState::SetDeterministicSwarms(launchSettings.GetBoolean("deterministic"));
+	if (launchSettings.GetInteger("simulation_workers", -1) >= 0)
+	{
+		RaceSessionState::SetNumberOfSimulationWorkers(static_cast<size_t>(launchSettings.GetInteger("simulation_workers")));
+	}
+
+	FastForwardObserver observer;
+	RaceSessionState::AddEventListener(observer);
+	TimingState::AddEventListener(observer);
+
+	RaceSessionState::Create(true, "", kDefaultCreaturesPerRacecar, tickRate);
+
+	for (RacecarIndex racecarIndex = 0; racecarIndex < kNumberOfRacecars; ++racecarIndex)
+	{
+		const tbCore::tbString number = tbCore::ToString(static_cast<int>(static_cast<RacecarIndex::Integer>(racecarIndex)));
+		const DriverIndex driverIndex = RaceSessionState::DriverEnterCompetition(DriverLicense("fast_forward_" + number, "Driver " + number));
+		const RacecarIndex drivenRacecar = (true == IsValidDriver(driverIndex)) ? RaceSessionState::DriverEnterRacecar(driverIndex) : InvalidRacecar();
+		if (false == IsValidRacecar(drivenRacecar))
+		{
+			tb_always_log(LogServer::Error() << "Fast forward failed to put an artificial driver into every racecar.");
+			RaceSessionState::Destroy();
+			RaceSessionState::RemoveEventListener(observer);
+			TimingState::RemoveEventListener(observer);
+			return 1;
+		}
+
+		RacecarState::GetMutable(drivenRacecar).SetRacecarController(new ArtificialDriverController(driverIndex, drivenRacecar));
+	}
+
+	//Practice moves straight on to the grid once every driver has a racecar, and the observer starts the countdown.
+	RaceSessionState::SetSessionPhase(RaceSessionState::SessionPhase::kPhasePractice);
+
+	tb_log("Fast forward on racetrack \"%s\" for up to %d ticks at %d ticks per second.\n", theDefaultRacetrackName.c_str(),
+		static_cast<int>(numberOfTicks), static_cast<int>(tickRate));
+
+	const std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+	double nextReport = kReportInterval;
+
+	tbCore::int64 tick = 0;
+	for (/* nothing */; tick < numberOfTicks; ++tick)
+	{
+		RaceSessionState::Simulate();
+
+		if (RaceSessionState::SessionPhase::kPhaseRacing == RaceSessionState::GetSessionPhase() && true == HaveAllRacecarsLost())
+		{
+			RaceSessionState::SetSessionPhase(RaceSessionState::SessionPhase::kPhasePractice);
+		}
+
+		const double simulatedSeconds = static_cast<double>(tick + 1) / static_cast<double>(tickRate);
+		if (simulatedSeconds >= nextReport)
+		{
+			nextReport += kReportInterval;
+			LogProgress("progress", simulatedSeconds, std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count(), observer);
+		}
+
+		if (0 != numberOfLaps && observer.mNumberOfLaps >= numberOfLaps)
+		{
+			++tick;
+			break;
+		}
+	}
+
+	const double wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+	const double simulatedSeconds = static_cast<double>(tick) / static_cast<double>(tickRate);
+	const double rate = simulatedSeconds / std::max(wallSeconds, 1.0e-9);
+
+	LogProgress("finished", simulatedSeconds, wallSeconds, observer);
+	tb_log("    %-14s %12.0f ticks/sec\n", "simulation", static_cast<double>(tick) / std::max(wallSeconds, 1.0e-9));
+	tb_log("    %-14s %12.3f seconds\n", "best lap", static_cast<double>(observer.mBestLapTime) / 1000.0);
+
+	//Destroy() takes every driver out of the competition.
+	RaceSessionState::Destroy();
+	RaceSessionState::RemoveEventListener(observer);
+	TimingState::RemoveEventListener(observer);
+
+	if (0 != minimumRate && rate < static_cast<double>(minimumRate))
+	{
+		tb_always_log(LogServer::Error() << "Fast forward ran " << rate << " simulated seconds per second, below the minimum of " << minimumRate << ".");
+		return 1;
+	}
+
+	return 0;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
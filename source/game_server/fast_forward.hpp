@@ -0,0 +1,32 @@
+///
+/// @file
+/// @details Runs the race session headless as fast as the machine allows, for evaluating the artificial drivers and
+///   gating performance offline.
+///
+/// <!-- Copyright (c) 2024 Tyre Bytes LLC - All Rights Reserved -->
+///------------------------------------------------------------------------------------------------------------------///
+
+#ifndef LudumDare56_FastForward_hpp
+#define LudumDare56_FastForward_hpp
+
+namespace LudumDare56
+{
+	namespace GameServer
+	{
+
+		///
+		/// @details Just like RunDedicatedServer() this is a main() of sorts, run with --fast_forward. A RaceSession is
+		///   created on --racetrack (or the default track) with an artificial driver in every racecar, then simulated
+		///   back to back without networking or sleeping, racing over and over, until --laps laps were completed or
+		///   --ticks steps were simulated, whichever comes first. The simulated seconds per wall second get logged as
+		///   it runs and again at the end along with the laps completed and the best lap.
+		///
+		/// @return 0 once finished, non-zero if the session could not be setup or, when --minimum_rate is given, the
+		///   simulated seconds per wall second fell below it.
+		///
+		int RunFastForward(int argumentCount, const char* argumentValues[]);
+
+	};	//namespace GameServer
+};	//namespace LudumDare56
+
+#endif /* LudumDare56_FastForward_hpp */
@@ -41,6 +41,7 @@ namespace LudumDare56
 
 		tbCore::tbString theServerIP = "";
 		tbCore::uint16 theServerPort = 0;
+		tbCore::uint32 theServerTickRate = kDefaultTickRate;
 		bool theServerIsRunning = false;
 
 		namespace Implementation
@@ -67,7 +68,7 @@ void LudumDare56::GameServer::InitializeServer(void)
 	theServerIsRunning = true;
 	Network::CreateServerConnection(theServerPort);
 
-	GameState::RaceSessionState::Create(true);
+	GameState::RaceSessionState::Create(true, "", GameState::kDefaultCreaturesPerRacecar, theServerTickRate);
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
@@ -91,11 +92,21 @@ int LudumDare56::GameServer::RunDedicatedServer(int argumentCount, const char* a
 		theDefaultRacetrackName = startRacetrack;
 	}
 
+	//Large servers may want 40 or 50 steps a second to save on processing, small competitive servers 125 or 200.
+	const tbCore::int64 tickRate = launchSettings.GetInteger("tick_rate", kDefaultTickRate);
+	theServerTickRate = static_cast<tbCore::uint32>(tickRate);
+	if (tickRate < 0 || false == IsValidTickRate(theServerTickRate))
+	{
+		tb_always_log(LogServer::Error() << "The --tick_rate of " << tickRate << " is not valid, see IsValidTickRate(), using " <<
+			kDefaultTickRate << " steps per second instead.");
+		theServerTickRate = kDefaultTickRate;
+	}
+
 	tbSystem::Timer::Timer timer;
 	float accumulatedSimulationTime = 0.0f;
-	const float kSecondsPerStep(0.01f);
 
 	InitializeServer();
+	const float kSecondsPerStep(FixedTime());
 
 	while (true == theServerIsRunning)
 	{
@@ -132,9 +143,9 @@ int LudumDare56::GameServer::RunDedicatedServer(int argumentCount, const char* a
 		tb_debug_log_if(accumulatedSimulationTime > kSecondsPerStep, LogServer::Warning() << "Warning, simulation time falling behind wall-timer.");
 
 		std::chrono::high_resolution_clock::duration totalFrameTime = std::chrono::high_resolution_clock::now() - timeAtStart;
-		auto sleepTime = std::chrono::milliseconds(10) - std::chrono::duration_cast<std::chrono::milliseconds>(totalFrameTime);
+		auto sleepTime = std::chrono::milliseconds(FixedTimeMS()) - std::chrono::duration_cast<std::chrono::milliseconds>(totalFrameTime);
 		if (sleepTime > std::chrono::milliseconds(1))
-		{	//Could technically sleep a little, this doesn't need to run faster than ~100hz
+		{	//Could technically sleep a little, this doesn't need to run faster than the tick rate
 			//std::this_thread::sleep_for(std::chrono::milliseconds(2));
 			std::this_thread::sleep_for(sleepTime);
 		}
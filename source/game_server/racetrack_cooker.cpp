@@ -0,0 +1,85 @@
+///
+/// @file
+/// @details Cooks the racetracks offline so the collider and TrackNodes are loaded instead of derived at runtime.
+///
+/// <!-- Copyright (c) 2024 Tyre Bytes LLC - All Rights Reserved -->
+///------------------------------------------------------------------------------------------------------------------///
+
+#include "../game_server/racetrack_cooker.hpp"
+
+#include "../game_state/racetrack_state.hpp"
+
+#include "../logging.hpp"
+
+#include <turtle_brains/core/debug/tb_debug_logger.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <filesystem>
+#include <vector>
+
+//Exists in race_session_state.cpp for the same racetrack paths as the session.
+extern tbCore::tbString RacetrackNameToFilepath(const tbCore::tbString& racetrackName);
+
+namespace
+{
+	const char* const kRacetrackDirectory = "data/racetracks/";
+};	//namespace
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+int LudumDare56::GameServer::RunRacetrackCooker(int argumentCount, const char* argumentValues[])
+{
+	using namespace GameState;
+
+	const UserSettings launchSettings = ParseLaunchParameters(argumentCount, argumentValues);
+	const tbCore::tbString racetrack = launchSettings.GetString("racetrack");
+
+	std::vector<tbCore::tbString> racetrackFilepaths;
+	if (false == racetrack.empty())
+	{
+		racetrackFilepaths.push_back(RacetrackNameToFilepath(racetrack));
+	}
+	else
+	{
+		std::error_code errorCode;
+		for (const std::filesystem::directory_entry& entry : std::filesystem::directory_iterator(kRacetrackDirectory, errorCode))
+		{
+			if (true == entry.is_regular_file() && ".trk" == entry.path().extension())
+			{
+				racetrackFilepaths.push_back(kRacetrackDirectory + entry.path().filename().string());
+			}
+		}
+
+		std::sort(racetrackFilepaths.begin(), racetrackFilepaths.end());
+	}
+
+	if (true == racetrackFilepaths.empty())
+	{
+		tb_always_log(LogServer::Error() << "Found no racetracks to cook in \"" << kRacetrackDirectory << "\".");
+		return 1;
+	}
+
+	int numberOfFailures = 0;
+	for (const tbCore::tbString& racetrackFilepath : racetrackFilepaths)
+	{
+		const std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+		const bool isCooked = RacetrackState::CookRacetrack(racetrackFilepath);
+		const double cookSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+
+		if (true == isCooked)
+		{
+			tb_log("Cooked %-40s in %8.3f seconds.\n", racetrackFilepath.c_str(), cookSeconds);
+		}
+		else
+		{
+			tb_always_log(LogServer::Error() << "Failed to cook the racetrack \"" << racetrackFilepath << "\".");
+			++numberOfFailures;
+		}
+	}
+
+	RacetrackState::InvalidateRacetrack();
+	return (0 == numberOfFailures) ? 0 : 1;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
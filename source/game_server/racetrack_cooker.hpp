@@ -0,0 +1,29 @@
+///
+/// @file
+/// @details Cooks the racetracks offline so the collider and TrackNodes are loaded instead of derived at runtime.
+///
+/// <!-- Copyright (c) 2024 Tyre Bytes LLC - All Rights Reserved -->
+///------------------------------------------------------------------------------------------------------------------///
+
+#ifndef LudumDare56_RacetrackCooker_hpp
+#define LudumDare56_RacetrackCooker_hpp
+
+namespace LudumDare56
+{
+	namespace GameServer
+	{
+
+		///
+		/// @details Just like RunDedicatedServer() this is a main() of sorts, run with --cook_racetracks. Every racetrack
+		///   in data/racetracks/, or only --racetrack when given, is loaded and has the derived collider, TrackNodeEdges
+		///   and TrackNodes saved into a .ctrk beside the .trk. Run from the build scripts, or by hand after editing a
+		///   racetrack, since a cooked racetrack that no longer matches its racetrack gets ignored.
+		///
+		/// @return 0 once every racetrack was cooked, non-zero if any racetrack failed to cook.
+		///
+		int RunRacetrackCooker(int argumentCount, const char* argumentValues[]);
+
+	};	//namespace GameServer
+};	//namespace LudumDare56
+
+#endif /* LudumDare56_RacetrackCooker_hpp */
@@ -0,0 +1,480 @@
+///
+/// @file
+/// @details Times the creature swarm simulation headless so performance regressions are caught before deploying.
+///
+/// <!-- Copyright (c) 2024 Tyre Bytes LLC - All Rights Reserved -->
+///------------------------------------------------------------------------------------------------------------------///
+
+#include "../game_server/swarm_benchmark.hpp"
+
+#include "../game_state/race_session_state.hpp"
+#include "../game_state/racecar_state.hpp"
+#include "../game_state/racetrack_state.hpp"
+#include "../game_state/ai/artificial_driver_controller.hpp"
+
+#include "../logging.hpp"
+
+#include <turtle_brains/core/debug/tb_debug_logger.hpp>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstring>
+#include <random>
+#include <vector>
+
+//Exists in race_session_state.cpp for starting track.
+extern tbCore::tbString theDefaultRacetrackName;
+
+namespace
+{
+	using namespace LudumDare56;
+
+	const std::array<tbCore::uint16, 3> kBenchmarkSwarmSizes = { 200, 1000, 5000 };
+	const tbCore::int64 kDefaultBenchmarkTicks = 1000;
+	const tbCore::int64 kDefaultBenchmarkSeed = 56;
+
+	//How far each creature may be scattered from its usual spot on the grid, in meters, and how fast it may start.
+	const float kScatterDistance = 0.25f;
+	const float kScatterSpeed = 0.5f;
+
+	//Every ray goes through the hierarchy, only the first few are also tested against every triangle since that is slow.
+	const size_t kNumberOfRacetrackRays = 200000;
+	const size_t kNumberOfReferenceRays = 2000;
+
+	///
+	/// @details Sorts the times in place and logs the mean, p50, p99 and max of a stage in microseconds.
+	///
+	void LogStageTimes(const char* stageName, std::vector<tbCore::uint64>& stageTimes)
+	{
+		if (true == stageTimes.empty())
+		{
+			return;
+		}
+
+		std::sort(stageTimes.begin(), stageTimes.end());
+
+		double totalTime = 0.0;
+		for (const tbCore::uint64 stageTime : stageTimes)
+		{
+			totalTime += static_cast<double>(stageTime);
+		}
+
+		const size_t lastIndex = stageTimes.size() - 1;
+		const double kToMicroseconds = 1.0 / 1000.0;
+		tb_log("    %-14s mean: %9.2fus    p50: %9.2fus    p99: %9.2fus    max: %9.2fus\n", stageName,
+			totalTime / static_cast<double>(stageTimes.size()) * kToMicroseconds,
+			static_cast<double>(stageTimes[lastIndex * 50 / 100]) * kToMicroseconds,
+			static_cast<double>(stageTimes[lastIndex * 99 / 100]) * kToMicroseconds,
+			static_cast<double>(stageTimes[lastIndex]) * kToMicroseconds);
+	}
+
+	///
+	/// @details Returns a value from -range to range. The std distributions are not the same across standard libraries,
+	///   while std::mt19937 itself is, so this keeps the swarm hashes comparable between platforms.
+	///
+	float RandomInRange(std::mt19937& generator, const float range)
+	{
+		const float unit = static_cast<float>(static_cast<double>(generator()) / static_cast<double>(std::mt19937::max()));
+		return (unit * 2.0f - 1.0f) * range;
+	}
+
+	///
+	/// @details Scatters the freshly placed swarm so each run of the benchmark, given the same seed, starts from the
+	///   exact same state while the creatures are not all perfectly settled into their grid spots.
+	///
+	void ScatterSwarm(GameState::RacecarState& racecar, std::mt19937& generator)
+	{
+		for (GameState::RacecarState::CreatureIndex creatureIndex = 0; creatureIndex < racecar.GetNumberOfCreatures(); ++creatureIndex)
+		{
+			GameState::RacecarState::MutableCreature creature = racecar.GetMutableCreature(creatureIndex);
+			const float offsetX = RandomInRange(generator, kScatterDistance);
+			const float offsetZ = RandomInRange(generator, kScatterDistance);
+			const float speedX = RandomInRange(generator, kScatterSpeed);
+			const float speedZ = RandomInRange(generator, kScatterSpeed);
+			creature.SetPosition(creature.GetPosition() + iceVector3(offsetX, 0.0f, offsetZ));
+			creature.SetVelocity(iceVector3(speedX, 0.0f, speedZ));
+		}
+	}
+
+	///
+	/// @details Creates the session with an artificial driver in a racecar and scatters its swarm from the seed, so each
+	///   call with the same swarm size and seed starts from the exact same state. Returns false, with the session
+	///   already destroyed, if the driver could not be put into a racecar.
+	///
+	bool CreateBenchmarkSession(const tbCore::uint16 swarmSize, const tbCore::int64 seed,
+		GameState::DriverIndex& driverIndex, GameState::RacecarIndex& racecarIndex)
+	{
+		using namespace GameState;
+
+		RaceSessionState::Create(true, "", swarmSize);
+		RaceSessionState::SetSessionPhase(RaceSessionState::SessionPhase::kPhaseRacing);
+
+		driverIndex = RaceSessionState::DriverEnterCompetition(DriverLicense("benchmark", "Benchmark"));
+		if (false == IsValidDriver(driverIndex))
+		{
+			tb_always_log(LogServer::Error() << "The swarm benchmark failed to enter a driver into the competition.");
+			RaceSessionState::Destroy();
+			return false;
+		}
+
+		racecarIndex = RaceSessionState::DriverEnterRacecar(driverIndex);
+		if (false == IsValidRacecar(racecarIndex))
+		{
+			tb_always_log(LogServer::Error() << "The swarm benchmark failed to put the driver into a racecar.");
+			RaceSessionState::Destroy();
+			return false;
+		}
+
+		RacecarState& racecar = RacecarState::GetMutable(racecarIndex);
+		racecar.SetRacecarController(new ArtificialDriverController(driverIndex, racecarIndex));
+
+		std::mt19937 generator(static_cast<std::mt19937::result_type>(seed));
+		ScatterSwarm(racecar, generator);
+		return true;
+	}
+
+	void DestroyBenchmarkSession(const GameState::DriverIndex driverIndex)
+	{
+		GameState::RaceSessionState::DriverLeaveCompetition(driverIndex);
+		GameState::RaceSessionState::Destroy();
+	}
+
+	bool RunSwarmBenchmarkFor(const tbCore::uint16 swarmSize, const tbCore::int64 numberOfTicks, const tbCore::int64 seed)
+	{
+		using namespace GameState;
+
+		DriverIndex driverIndex = InvalidDriver();
+		RacecarIndex racecarIndex = InvalidRacecar();
+		if (false == CreateBenchmarkSession(swarmSize, seed, driverIndex, racecarIndex))
+		{
+			return false;
+		}
+
+		const RacecarState& racecar = RacecarState::Get(racecarIndex);
+		RacecarState::SetSwarmStageTiming(true);
+
+		std::vector<tbCore::uint64> groundProbeTimes;
+		std::vector<tbCore::uint64> steeringTimes;
+		std::vector<tbCore::uint64> integrationTimes;
+		groundProbeTimes.reserve(static_cast<size_t>(numberOfTicks));
+		steeringTimes.reserve(static_cast<size_t>(numberOfTicks));
+		integrationTimes.reserve(static_cast<size_t>(numberOfTicks));
+
+		for (tbCore::int64 tick = 0; tick < numberOfTicks; ++tick)
+		{
+			RaceSessionState::Simulate();
+
+			const RacecarState::SwarmStageTimes& stageTimes = racecar.GetSwarmStageTimes();
+			groundProbeTimes.push_back(stageTimes.mGroundProbes);
+			steeringTimes.push_back(stageTimes.mSteering);
+			integrationTimes.push_back(stageTimes.mIntegration);
+		}
+
+		tb_log("Swarm of %d creatures over %d ticks, %d still alive at the end with swarm hash %016llx.\n",
+			static_cast<int>(swarmSize), static_cast<int>(numberOfTicks), static_cast<int>(racecar.GetAliveCreatures().size()),
+			static_cast<unsigned long long>(racecar.ComputeSwarmHash()));
+		LogStageTimes("ground probes", groundProbeTimes);
+		LogStageTimes("steering", steeringTimes);
+		LogStageTimes("integration", integrationTimes);
+
+		RacecarState::SetSwarmStageTiming(false);
+		DestroyBenchmarkSession(driverIndex);
+		return true;
+	}
+
+	struct VehicleState
+	{
+		iceMatrix4 mVehicleToWorld;
+		iceVector3 mLinearVelocity;
+		iceVector3 mAngularVelocity;
+	};
+
+	VehicleState GetVehicleState(const GameState::RacecarState& racecar)
+	{
+		return VehicleState{ racecar.GetVehicleToWorld(), racecar.GetLinearVelocity(), racecar.GetAngularVelocity() };
+	}
+
+	bool IsSameVehicleState(const VehicleState& a, const VehicleState& b)
+	{	//Bit for bit, a restored step that is only close enough will still drift apart over a race.
+		return 0 == std::memcmp(&a.mVehicleToWorld, &b.mVehicleToWorld, sizeof(iceMatrix4)) &&
+			0 == std::memcmp(&a.mLinearVelocity, &b.mLinearVelocity, sizeof(iceVector3)) &&
+			0 == std::memcmp(&a.mAngularVelocity, &b.mAngularVelocity, sizeof(iceVector3));
+	}
+
+	///
+	/// @details Simulates into the race, saves a snapshot and keeps going for kSnapshotSteps, then repeatedly restores
+	///   back to that snapshot and simulates the same steps again. Every run must end with the same swarm hash and the
+	///   same vehicle, bit for bit, as the first. Logs how long each restore took, which includes simulating the
+	///   restored step again.
+	///
+	bool RunSnapshotBenchmark(const tbCore::int64 seed)
+	{
+		using namespace GameState;
+
+		const tbCore::uint16 kSnapshotSwarmSize = kBenchmarkSwarmSizes[1];
+		const tbCore::uint32 kWarmupSteps = 200;
+		const tbCore::uint32 kSnapshotSteps = 60;
+		const size_t kNumberOfRestores = 50;
+
+		const size_t previousNumberOfSnapshots = RaceSessionState::GetNumberOfSnapshots();
+		RaceSessionState::SetNumberOfSnapshots(kSnapshotSteps + 1);
+
+		DriverIndex driverIndex = InvalidDriver();
+		RacecarIndex racecarIndex = InvalidRacecar();
+		if (false == CreateBenchmarkSession(kSnapshotSwarmSize, seed, driverIndex, racecarIndex))
+		{
+			RaceSessionState::SetNumberOfSnapshots(previousNumberOfSnapshots);
+			return false;
+		}
+
+		const RacecarState& racecar = RacecarState::Get(racecarIndex);
+
+		for (tbCore::uint32 step = 0; step < kWarmupSteps; ++step)
+		{
+			RaceSessionState::Simulate();
+		}
+
+		const tbCore::uint32 snapshotStep = RaceSessionState::GetSimulationStep();
+		for (tbCore::uint32 step = 0; step < kSnapshotSteps; ++step)
+		{
+			RaceSessionState::Simulate();
+		}
+
+		const tbCore::uint64 expectedSwarmHash = RaceSessionState::ComputeSwarmHash();
+		const VehicleState expectedVehicle = GetVehicleState(racecar);
+
+		std::vector<tbCore::uint64> restoreTimes;
+		restoreTimes.reserve(kNumberOfRestores);
+		size_t numberOfMismatches = 0;
+
+		for (size_t restoreIndex = 0; restoreIndex < kNumberOfRestores; ++restoreIndex)
+		{
+			const std::chrono::steady_clock::time_point restoreStartTime = std::chrono::steady_clock::now();
+			const bool isRestored = RaceSessionState::RestoreSnapshot(snapshotStep);
+			const std::chrono::steady_clock::time_point restoreFinishTime = std::chrono::steady_clock::now();
+			restoreTimes.push_back(static_cast<tbCore::uint64>(std::chrono::duration_cast<std::chrono::nanoseconds>(restoreFinishTime - restoreStartTime).count()));
+
+			if (false == isRestored)
+			{
+				tb_always_log(LogServer::Error() << "The snapshot of step " << snapshotStep << " could not be restored.");
+				DestroyBenchmarkSession(driverIndex);
+				RaceSessionState::SetNumberOfSnapshots(previousNumberOfSnapshots);
+				return false;
+			}
+
+			for (tbCore::uint32 step = 0; step < kSnapshotSteps; ++step)
+			{
+				RaceSessionState::Simulate();
+			}
+
+			if (expectedSwarmHash != RaceSessionState::ComputeSwarmHash() || false == IsSameVehicleState(expectedVehicle, GetVehicleState(racecar)))
+			{
+				++numberOfMismatches;
+			}
+		}
+
+		tb_log("Snapshot of %d creatures restored %d times, %d steps back, with swarm hash %016llx.\n",
+			static_cast<int>(kSnapshotSwarmSize), static_cast<int>(kNumberOfRestores), static_cast<int>(kSnapshotSteps),
+			static_cast<unsigned long long>(expectedSwarmHash));
+		LogStageTimes("restore", restoreTimes);
+
+		DestroyBenchmarkSession(driverIndex);
+		RaceSessionState::SetNumberOfSnapshots(previousNumberOfSnapshots);
+
+		if (0 != numberOfMismatches)
+		{
+			tb_always_log(LogServer::Error() << numberOfMismatches << " restored snapshots did not simulate the same steps again.");
+			return false;
+		}
+
+		return true;
+	}
+
+	///
+	/// @details Creates the session twice from the same seed with deterministic swarms and simulates the same steps,
+	///   both runs must end with the same swarm hash. Only the swarms are compared, ComputeSwarmHash() does not cover
+	///   the vehicle physics so this makes no claim about the racecars themselves being deterministic.
+	///
+	bool RunDeterminismCheck(const tbCore::int64 seed)
+	{
+		using namespace GameState;
+
+		const tbCore::uint16 kDeterminismSwarmSize = kBenchmarkSwarmSizes[1];
+		const tbCore::uint32 kDeterminismSteps = 500;
+
+		const bool wasDeterministic = RaceSessionState::IsDeterministicSwarms();
+		RaceSessionState::SetDeterministicSwarms(true);
+
+		std::array<tbCore::uint64, 2> swarmHashes = { 0, 0 };
+		for (tbCore::uint64& swarmHash : swarmHashes)
+		{
+			DriverIndex driverIndex = InvalidDriver();
+			RacecarIndex racecarIndex = InvalidRacecar();
+			if (false == CreateBenchmarkSession(kDeterminismSwarmSize, seed, driverIndex, racecarIndex))
+			{
+				RaceSessionState::SetDeterministicSwarms(wasDeterministic);
+				return false;
+			}
+
+			for (tbCore::uint32 step = 0; step < kDeterminismSteps; ++step)
+			{
+				RaceSessionState::Simulate();
+			}
+
+			swarmHash = RaceSessionState::ComputeSwarmHash();
+			DestroyBenchmarkSession(driverIndex);
+		}
+
+		RaceSessionState::SetDeterministicSwarms(wasDeterministic);
+
+		tb_log("Deterministic swarm of %d creatures over %d steps, twice, with swarm hashes %016llx and %016llx.\n",
+			static_cast<int>(kDeterminismSwarmSize), static_cast<int>(kDeterminismSteps),
+			static_cast<unsigned long long>(swarmHashes[0]), static_cast<unsigned long long>(swarmHashes[1]));
+
+		if (swarmHashes[0] != swarmHashes[1])
+		{
+			tb_always_log(LogServer::Error() << "The deterministic swarms did not simulate the same steps the same way twice.");
+			return false;
+		}
+
+		return true;
+	}
+
+	///
+	/// @details Casts rays straight down at random spots over the racetrack, like the ground probes of the creatures,
+	///   and logs how many rays per second go through the racetrack hierarchy compared to testing every triangle.
+	///
+	bool RunRacetrackRayBenchmark(const tbCore::int64 seed)
+	{
+		using namespace GameState;
+
+		RaceSessionState::Create(true, "", kBenchmarkSwarmSizes[0]);
+
+		const BoundingVolumeHierarchy& hierarchy = RacetrackState::GetRacetrackHierarchy();
+		if (true == hierarchy.IsEmpty())
+		{
+			tb_always_log(LogServer::Error() << "The racetrack benchmark found no racetrack surface to cast rays against.");
+			RaceSessionState::Destroy();
+			return false;
+		}
+
+		iceVector3 minimum = iceVector3::Zero();
+		iceVector3 maximum = iceVector3::Zero();
+		hierarchy.GetBounds(minimum, maximum);
+
+		const iceVector3 center = (minimum + maximum) * 0.5;
+		const iceVector3 halfSize = (maximum - minimum) * 0.5;
+		const iceScalar startHeight = maximum.y + 1.0;
+		const iceScalar maximumDistance = (maximum.y - minimum.y) + 2.0;
+		const iceVector3 down(0.0, -1.0, 0.0);
+
+		std::mt19937 generator(static_cast<std::mt19937::result_type>(seed));
+		std::vector<iceVector3> rayOrigins(kNumberOfRacetrackRays);
+		for (iceVector3& origin : rayOrigins)
+		{
+			origin.x = center.x + RandomInRange(generator, static_cast<float>(halfSize.x));
+			origin.y = startHeight;
+			origin.z = center.z + RandomInRange(generator, static_cast<float>(halfSize.z));
+		}
+
+		BoundingVolumeHierarchy::RayHit hit;
+		size_t numberOfHits = 0;
+		const std::chrono::steady_clock::time_point hierarchyStartTime = std::chrono::steady_clock::now();
+		for (const iceVector3& origin : rayOrigins)
+		{
+			numberOfHits += (true == hierarchy.CastRay(origin, down, maximumDistance, hit)) ? 1 : 0;
+		}
+		const std::chrono::steady_clock::time_point hierarchyFinishTime = std::chrono::steady_clock::now();
+
+		size_t numberOfMismatches = 0;
+		BoundingVolumeHierarchy::RayHit referenceHit;
+		for (size_t rayIndex = 0; rayIndex < kNumberOfReferenceRays; ++rayIndex)
+		{
+			const bool isHit = hierarchy.CastRay(rayOrigins[rayIndex], down, maximumDistance, hit);
+			const bool isReferenceHit = hierarchy.CastRayAgainstAllTriangles(rayOrigins[rayIndex], down, maximumDistance, referenceHit);
+			if (isHit != isReferenceHit || (true == isHit && hit.mDistance != referenceHit.mDistance))
+			{
+				++numberOfMismatches;
+			}
+		}
+
+		const std::chrono::steady_clock::time_point referenceStartTime = std::chrono::steady_clock::now();
+		for (size_t rayIndex = 0; rayIndex < kNumberOfReferenceRays; ++rayIndex)
+		{
+			hierarchy.CastRayAgainstAllTriangles(rayOrigins[rayIndex], down, maximumDistance, referenceHit);
+		}
+		const std::chrono::steady_clock::time_point referenceFinishTime = std::chrono::steady_clock::now();
+
+		const double hierarchySeconds = std::chrono::duration<double>(hierarchyFinishTime - hierarchyStartTime).count();
+		const double referenceSeconds = std::chrono::duration<double>(referenceFinishTime - referenceStartTime).count();
+
+		tb_log("Racetrack of %d triangles in %d nodes, %d of %d downward rays hit the surface.\n",
+			static_cast<int>(hierarchy.GetNumberOfTriangles()), static_cast<int>(hierarchy.GetNumberOfNodes()),
+			static_cast<int>(numberOfHits), static_cast<int>(kNumberOfRacetrackRays));
+		tb_log("    %-14s %12.0f rays/sec\n", "hierarchy", static_cast<double>(kNumberOfRacetrackRays) / std::max(hierarchySeconds, 1.0e-9));
+		tb_log("    %-14s %12.0f rays/sec\n", "every triangle", static_cast<double>(kNumberOfReferenceRays) / std::max(referenceSeconds, 1.0e-9));
+
+		RaceSessionState::Destroy();
+
+		if (0 != numberOfMismatches)
+		{
+			tb_always_log(LogServer::Error() << numberOfMismatches << " rays hit differently through the racetrack hierarchy than every triangle.");
+			return false;
+		}
+
+		return true;
+	}
+
+};	//namespace
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+int LudumDare56::GameServer::RunSwarmBenchmark(int argumentCount, const char* argumentValues[])
+{
+	const UserSettings launchSettings = ParseLaunchParameters(argumentCount, argumentValues);
+	const tbCore::tbString racetrack = launchSettings.GetString("racetrack");
+	if (false == racetrack.empty())
+	{
+		theDefaultRacetrackName = racetrack;
+	}
+
+	const tbCore::int64 numberOfTicks = std::max<tbCore::int64>(1, launchSettings.GetInteger("benchmark_ticks", kDefaultBenchmarkTicks));
+	const tbCore::int64 seed = launchSettings.GetInteger("benchmark_seed", kDefaultBenchmarkSeed);
+
+	//With --deterministic the swarm hashes can be compared between machines, the timings are then for the scalar path.
+	GameState::RaceSessionState::SetDeterministicSwarms(launchSettings.GetBoolean("deterministic"));
+	if (launchSettings.GetInteger("simulation_workers", -1) >= 0)
+	{
+		GameState::RaceSessionState::SetNumberOfSimulationWorkers(static_cast<size_t>(launchSettings.GetInteger("simulation_workers")));
+	}
+
+	tb_log("Swarm benchmark on racetrack \"%s\" with seed %d.\n", theDefaultRacetrackName.c_str(), static_cast<int>(seed));
+
+	for (const tbCore::uint16 swarmSize : kBenchmarkSwarmSizes)
+	{
+		if (false == RunSwarmBenchmarkFor(swarmSize, numberOfTicks, seed))
+		{
+			return 1;
+		}
+	}
+
+	if (false == RunSnapshotBenchmark(seed))
+	{
+		return 1;
+	}
+
+	if (false == RunDeterminismCheck(seed))
+	{
+		return 1;
+	}
+
+	if (false == RunRacetrackRayBenchmark(seed))
+	{
+		return 1;
+	}
+
+	return 0;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
@@ -0,0 +1,33 @@
+///
+/// @file
+/// @details Times the creature swarm simulation headless so performance regressions are caught before deploying.
+///
+/// <!-- Copyright (c) 2024 Tyre Bytes LLC - All Rights Reserved -->
+///------------------------------------------------------------------------------------------------------------------///
+
+#ifndef LudumDare56_SwarmBenchmark_hpp
+#define LudumDare56_SwarmBenchmark_hpp
+
+namespace LudumDare56
+{
+	namespace GameServer
+	{
+
+		///
+		/// @details Just like RunDedicatedServer() this is a main() of sorts, run with --benchmark. For each swarm size
+		///   of 200, 1000 and 5000 creatures a RaceSession is created on the test racetrack (--racetrack, or the default
+		///   track) with an artificial driver, the swarm is scattered from --seed and then --ticks steps are simulated
+		///   while timing each stage of the swarm. The mean, p50, p99 and max of each stage get logged. Next a snapshot
+		///   is restored over and over, each time simulating the same steps again, logging how long restoring took.
+		///   The session is then simulated twice with deterministic swarms, which must end with the same swarm hash.
+		///   Then rays are cast down at the racetrack, logging the rays per second through the racetrack hierarchy.
+		///
+		/// @return 0 once the benchmark completes, non-zero if the session could not be setup, or a restored snapshot,
+		///   the deterministic swarms or a ray through the racetrack hierarchy did not match.
+		///
+		int RunSwarmBenchmark(int argumentCount, const char* argumentValues[]);
+
+	};	//namespace GameServer
+};	//namespace LudumDare56
+
+#endif /* LudumDare56_SwarmBenchmark_hpp */
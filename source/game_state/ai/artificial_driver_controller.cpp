@@ -38,7 +38,8 @@ void LudumDare56::GameState::ArtificialDriverController::SetDebugVisualizer(iceG
 LudumDare56::GameState::ArtificialDriverController::ArtificialDriverController(const DriverIndex& driverIndex, const RacecarIndex& racecarIndex) :
 	RacecarControllerInterface(),
 	mDriver(DriverState::Get(driverIndex)),
-	mRacecar(RacecarState::Get(racecarIndex))
+	mRacecar(RacecarState::Get(racecarIndex)),
+	mTargetNodeIndex(RacetrackState::InvalidTrackNode())
 {
 	ResetControls();
 }
@@ -53,13 +54,12 @@ LudumDare56::GameState::ArtificialDriverController::~ArtificialDriverController(
 
 void LudumDare56::GameState::ArtificialDriverController::OnUpdateControls(void)
 {
-	/// @note 2023-10-19: targetNodeIndex is assuming the racetrack is a looping circuit and won't work terrible well
-	///   for a point-to-point type track, unless the race were to finish before it would possible loop around.
-	const TrackNodeIndex closestNodeIndex = FindClosestTrackNode();
-	//const TrackNodeIndex targetNodeIndex = (closestNodeIndex + 3) % RacetrackState::GetNumberOfTrackNodes();
-	const TrackNodeIndex targetNodeIndex = (closestNodeIndex + static_cast<TrackNodeIndex>(1)) % RacetrackState::GetNumberOfTrackNodes();
+	if (false == RacetrackState::IsValidTrackNode(mTargetNodeIndex))
+	{	//Never wait on the scheduler for the very first decision.
+		OnUpdateDecisions();
+	}
 
-	const Vector3 targetPosition = RacetrackState::GetTrackNodeLeadingEdge(targetNodeIndex, TrackEdge::kCenter);
+	const Vector3 targetPosition = RacetrackState::GetTrackNodeLeadingEdge(mTargetNodeIndex, TrackEdge::kCenter);
 
 	const Vector2 flatTargetPosition = Flatten(targetPosition);
 	const Vector2 flatRacecarPosition = Flatten(mRacecar.GetVehicleToWorld().GetPosition());
@@ -122,9 +122,52 @@ void LudumDare56::GameState::ArtificialDriverController::OnUpdateControls(void)
 
 //--------------------------------------------------------------------------------------------------------------------//
 
+void LudumDare56::GameState::ArtificialDriverController::OnUpdateDecisions(void)
+{
+	/// @note 2023-10-19: targetNodeIndex is assuming the racetrack is a looping circuit and won't work terrible well
+	///   for a point-to-point type track, unless the race were to finish before it would possible loop around.
+	const TrackNodeIndex closestNodeIndex = FindClosestTrackNode();
+	//const TrackNodeIndex targetNodeIndex = (closestNodeIndex + 3) % RacetrackState::GetNumberOfTrackNodes();
+	mTargetNodeIndex = (closestNodeIndex + static_cast<TrackNodeIndex>(1)) % RacetrackState::GetNumberOfTrackNodes();
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void LudumDare56::GameState::ArtificialDriverController::OnSaveDecisions(DecisionState& decisionState) const
+{
+	decisionState.mTargetIndex = static_cast<TrackNodeIndex::Integer>(mTargetNodeIndex);
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void LudumDare56::GameState::ArtificialDriverController::OnRestoreDecisions(const DecisionState& decisionState)
+{	//A snapshot from before the first decision restores an invalid node, which decides again on the next controls.
+	mTargetNodeIndex = static_cast<TrackNodeIndex::Integer>(decisionState.mTargetIndex);
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
 LudumDare56::GameState::ArtificialDriverController::TrackNodeIndex LudumDare56::GameState::ArtificialDriverController::FindClosestTrackNode(void)
 {
-	const Vector3 racecarPosition = static_cast<Vector3>(mRacecar.GetVehicleToWorld().GetPosition());
+	const iceVector3 vehiclePosition = mRacecar.GetVehicleToWorld().GetPosition();
+
+	TrackSurfaceTable::SurfaceSample sample;
+	if (true == RacetrackState::QueryTrackSurface(vehiclePosition, sample))
+	{	//The closest leading edge is this segment's own, unless still in the first half of the segment.
+		const TrackNodeIndex segmentNodeIndex = tbCore::RangedCast<TrackNodeIndex::Integer>(sample.mSegmentIndex);
+		if (sample.mSegmentFraction >= 0.5 && segmentNodeIndex < RacetrackState::GetNumberOfTrackNodes())
+		{
+			return segmentNodeIndex;
+		}
+
+		//The segment closing the circuit runs from the last leading edge to the first trailing edge, which stands in for
+		//  the last leading edge just as it does for the first half of segment 0.
+		const TrackNodeIndex lastNodeIndex = RacetrackState::GetNumberOfTrackNodes() - static_cast<TrackNodeIndex>(1);
+		return (0 == segmentNodeIndex || segmentNodeIndex > lastNodeIndex) ? lastNodeIndex : segmentNodeIndex - static_cast<TrackNodeIndex>(1);
+	}
+
+	//Off in the weeds beyond the track surface table, so just search every track node.
+	const Vector3 racecarPosition = static_cast<Vector3>(vehiclePosition);
 
 	TrackNodeIndex closestNodeIndex = 0;
 	float closestDistanceSquared = -1.0f;
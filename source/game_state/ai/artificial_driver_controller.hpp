@@ -39,6 +39,9 @@ namespace LudumDare56
 
 		protected:
 			virtual void OnUpdateControls(void);
+			virtual void OnUpdateDecisions(void) override;
+			virtual void OnSaveDecisions(DecisionState& decisionState) const override;
+			virtual void OnRestoreDecisions(const DecisionState& decisionState) override;
 
 		private:
 			typedef RacetrackState::TrackNodeIndex TrackNodeIndex;
@@ -47,6 +50,7 @@ namespace LudumDare56
 
 			const DriverState& mDriver;
 			const RacecarState& mRacecar;
+			TrackNodeIndex mTargetNodeIndex;
 		};
 
 	};
@@ -13,11 +13,53 @@
 
 #include <track_bundler/track_bundler_to_ice_physics.hpp>
 
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+	//Anything crossing the finish plane farther than this from the finish object does not count as finishing.
+	const iceScalar kFinishRadius = 10.0;
+
+	///
+	/// @details Returns false when no segment inside the swept bounds could cross the finish plane within kFinishRadius
+	///   of the finish, in which case none of the creatures need to be checked individually.
+	///
+	bool SweptBoundsReachFinish(const LudumDare56::GameState::RacecarState::SweptBounds& sweptBounds,
+		const iceVector3& finishPosition, const iceVector3& finishDirection)
+	{
+		const iceVector3& minimum = sweptBounds.mMinimum;
+		const iceVector3& maximum = sweptBounds.mMaximum;
+		if (minimum.x > maximum.x)
+		{	//No creatures are racing.
+			return false;
+		}
+
+		const iceVector3 closestToFinish(std::clamp(finishPosition.x, minimum.x, maximum.x),
+			std::clamp(finishPosition.y, minimum.y, maximum.y), std::clamp(finishPosition.z, minimum.z, maximum.z));
+		if (closestToFinish.SquaredDistanceTo(finishPosition) >= kFinishRadius * kFinishRadius)
+		{
+			return false;
+		}
+
+		//The box only holds a crossing if its corners are not all on the same side of the finish plane.
+		const iceVector3 center = (minimum + maximum) * 0.5;
+		const iceVector3 extents = (maximum - minimum) * 0.5;
+		const iceScalar distanceToPlane = iceVector3::Dot(center - finishPosition, finishDirection);
+		const iceScalar projectedExtent = extents.x * std::abs(finishDirection.x) +
+			extents.y * std::abs(finishDirection.y) + extents.z * std::abs(finishDirection.z);
+		return std::abs(distanceToPlane) <= projectedExtent;
+	}
+
+};	//namespace
+
 //--------------------------------------------------------------------------------------------------------------------//
 
 LudumDare56::GameState::ZoneFinishComponent::ZoneFinishComponent(ObjectState& object, const TrackBundler::Component& component) :
 	ComponentState(object),
-	mNextTrackName(component.mProperties["next_track"].AsStringWithDefault(""))
+	mNextTrackName(component.mProperties["next_track"].AsStringWithDefault("")),
+	mFocusZone(0),
+	mHasFocusZone(false)
 {
 	//TrackBundler::CreateBoundingVolumesFrom(static_cast<TrackBundler::NodeKey>(object.GetID()),
 
@@ -40,12 +82,22 @@ void LudumDare56::GameState::ZoneFinishComponent::OnAwake(void)
 	//TimingState::AddCheckpoint(static_cast<iceMatrix4>(objectToWorld), finishSphere, 0, false);
 
 	TimingState::AddCheckpoint(static_cast<iceMatrix4>(objectToWorld), 0, false);
+
+	//Creatures that are about to cross the line always get their full update so the finish never depends on the
+	//  swarm level of detail. This is a bit larger than the 10m the creatures are checked against in OnSimulate.
+	mFocusZone = SwarmLevelOfDetail::AddFocusZone(static_cast<iceMatrix4>(objectToWorld).GetPosition(), 15.0);
+	mHasFocusZone = true;
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
 
 void LudumDare56::GameState::ZoneFinishComponent::OnDestroy(void)
 {
+	if (true == mHasFocusZone)
+	{
+		SwarmLevelOfDetail::RemoveFocusZone(mFocusZone);
+		mHasFocusZone = false;
+	}
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
@@ -58,24 +110,31 @@ void LudumDare56::GameState::ZoneFinishComponent::OnSimulate(void)
 
 	for (RacecarState& racecar : RacecarState::AllMutableRacecars())
 	{
-		for (RacecarState::CreatureIndex creatureIndex = 0; creatureIndex < RacecarState::kNumberOfCreatures; ++creatureIndex)
+		//Most of the lap the swarm is nowhere near the finish, so only look at each creature when the box around
+		//  everything the swarm moved through last step could have crossed the line.
+		if (true == SweptBoundsReachFinish(racecar.GetSwarmSweptBounds(), finishPosition, finishDirection))
 		{
-			const RacecarState::Creature& creature = racecar.GetCreature(creatureIndex);
-			if (false == creature.mIsAlive && false == creature.mIsRacing)
+			for (const RacecarState::CreatureIndex::Integer racingIndex : racecar.GetRacingCreatures())
 			{
-				continue;
-			}
-
-			const iceVector3 creatureStartPosition = creature.mPreviousPosition;
-			const iceVector3 creatureFinalPosition = creature.mCreatureToWorld.GetPosition();
+				const RacecarState::CreatureIndex creatureIndex = racingIndex;
+				const RacecarState::Creature creature = racecar.GetCreature(creatureIndex);
+				if (false == creature.IsAlive() || false == creature.IsRacing())
+				{	//Died or finished this tick, the racing list catches up when the swarm is next simulated. A creature
+					//  that died keeps its racing flag, see KillCreature(), so it must not be allowed to finish.
+					continue;
+				}
 
-			if (true == icePhysics::LineSegmentToPlaneCollision(creatureStartPosition, creatureFinalPosition,
-				finishPosition, finishDirection, at))
-			{
-				const iceVector3 creatureDirection = creatureStartPosition.DirectionTo(creatureFinalPosition);
-				if (at.SquaredDistanceTo(finishPosition) < 10.0f * 10.0f && Vector3::Dot(creatureDirection, finishDirection) > 0.0f)
-				{	//Creature finished!
-					racecar.OnCreatureFinished(creatureIndex);
+				const iceVector3 creatureStartPosition = creature.GetPreviousPosition();
+				const iceVector3 creatureFinalPosition = creature.GetPosition();
+
+				if (true == icePhysics::LineSegmentToPlaneCollision(creatureStartPosition, creatureFinalPosition,
+					finishPosition, finishDirection, at))
+				{
+					const iceVector3 creatureDirection = creatureStartPosition.DirectionTo(creatureFinalPosition);
+					if (at.SquaredDistanceTo(finishPosition) < kFinishRadius * kFinishRadius && Vector3::Dot(creatureDirection, finishDirection) > 0.0f)
+					{	//Creature finished!
+						racecar.OnCreatureFinished(creatureIndex);
+					}
 				}
 			}
 		}
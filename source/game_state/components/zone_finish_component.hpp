@@ -11,6 +11,7 @@
 #include "../../ludumdare56.hpp"
 #include "../../game_state/race_session_state.hpp"
 #include "../../game_state/object_state.hpp"
+#include "../../game_state/helpers/swarm_level_of_detail.hpp"
 
 namespace LudumDare56::GameState
 {
@@ -28,6 +29,8 @@ namespace LudumDare56::GameState
 
 	private:
 		String mNextTrackName;
+		SwarmLevelOfDetail::FocusZoneKey mFocusZone;
+		bool mHasFocusZone;
 	};
 
 };	//namespace LudumDare56::GameState
@@ -0,0 +1,627 @@
+///
+/// @file
+/// @details A static bounding volume hierarchy of triangles to quickly cast rays against the racetrack surface.
+///
+/// <!-- Copyright (c) 2024 Tyre Bytes LLC - All Rights Reserved -->
+///------------------------------------------------------------------------------------------------------------------///
+
+#include "../../game_state/helpers/bounding_volume_hierarchy.hpp"
+
+#include "../../logging.hpp"
+
+#include <turtle_brains/core/unit_test/tb_unit_test.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <random>
+
+namespace
+{
+	//Splits are searched for across this many bins of the centroids on each axis, which is close enough to testing
+	//  every triangle for the surface area heuristic while keeping the build linear.
+	const size_t kNumberOfBins = 16;
+
+	//Leaves hold at most this many triangles, unless they all share a centroid and cannot be split. Any more and the
+	//  surface area heuristic is not asked, the node is split.
+	const size_t kMaximumLeafTriangles = 8;
+
+	//Also the size of the stack when casting rays, no node is split any deeper than this.
+	const size_t kMaximumDepth = 64;
+
+	//Relative cost of stepping into a node compared to testing a triangle, for the surface area heuristic.
+	const iceScalar kTraversalCost = 1.0;
+
+	const iceScalar kParallelEpsilon = 1.0e-12;
+
+	struct Bounds
+	{
+		iceScalar mMinimum[3];
+		iceScalar mMaximum[3];
+	};
+
+	Bounds EmptyBounds(void)
+	{
+		const iceScalar kLargest = std::numeric_limits<iceScalar>::max();
+		return Bounds{ { kLargest, kLargest, kLargest }, { -kLargest, -kLargest, -kLargest } };
+	}
+
+	void GrowBounds(Bounds& bounds, const Bounds& other)
+	{
+		for (size_t axis = 0; axis < 3; ++axis)
+		{
+			bounds.mMinimum[axis] = std::min(bounds.mMinimum[axis], other.mMinimum[axis]);
+			bounds.mMaximum[axis] = std::max(bounds.mMaximum[axis], other.mMaximum[axis]);
+		}
+	}
+
+	void GrowBounds(Bounds& bounds, const iceScalar point[3])
+	{
+		for (size_t axis = 0; axis < 3; ++axis)
+		{
+			bounds.mMinimum[axis] = std::min(bounds.mMinimum[axis], point[axis]);
+			bounds.mMaximum[axis] = std::max(bounds.mMaximum[axis], point[axis]);
+		}
+	}
+
+	iceScalar SurfaceArea(const Bounds& bounds)
+	{
+		const iceScalar x = bounds.mMaximum[0] - bounds.mMinimum[0];
+		const iceScalar y = bounds.mMaximum[1] - bounds.mMinimum[1];
+		const iceScalar z = bounds.mMaximum[2] - bounds.mMinimum[2];
+		return (x < 0.0 || y < 0.0 || z < 0.0) ? 0.0 : 2.0 * (x * y + y * z + z * x);
+	}
+
+	//The nodes store floats, so the bounds get rounded outward to never cut off the triangles inside.
+	float RoundDown(const iceScalar value)
+	{
+		const float rounded = static_cast<float>(value);
+		return (static_cast<iceScalar>(rounded) > value) ? std::nextafter(rounded, -std::numeric_limits<float>::infinity()) : rounded;
+	}
+
+	float RoundUp(const iceScalar value)
+	{
+		const float rounded = static_cast<float>(value);
+		return (static_cast<iceScalar>(rounded) < value) ? std::nextafter(rounded, std::numeric_limits<float>::infinity()) : rounded;
+	}
+
+	iceScalar Dot(const iceScalar a[3], const iceScalar b[3])
+	{
+		return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+	}
+
+	void Cross(const iceScalar a[3], const iceScalar b[3], iceScalar result[3])
+	{
+		result[0] = a[1] * b[2] - a[2] * b[1];
+		result[1] = a[2] * b[0] - a[0] * b[2];
+		result[2] = a[0] * b[1] - a[1] * b[0];
+	}
+};
+
+struct LudumDare56::GameState::BoundingVolumeHierarchy::BuildEntry
+{
+	Bounds mBounds;
+	iceScalar mCentroid[3];
+	TriangleIndex mTriangle;  //Into the triangles before they get sorted into the leaves.
+};
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+LudumDare56::GameState::BoundingVolumeHierarchy::BoundingVolumeHierarchy(void) :
+	mTriangles(),
+	mNodes()
+{
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+LudumDare56::GameState::BoundingVolumeHierarchy::~BoundingVolumeHierarchy(void)
+{
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void LudumDare56::GameState::BoundingVolumeHierarchy::Clear(void)
+{
+	mTriangles.clear();
+	mNodes.clear();
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void LudumDare56::GameState::BoundingVolumeHierarchy::AddTriangle(const iceVector3& a, const iceVector3& b, const iceVector3& c)
+{
+	tb_error_if(false == mNodes.empty(), "Expected triangles to be added to the BoundingVolumeHierarchy before building it.");
+
+	Triangle triangle;
+	triangle.mVertex[0] = a.x;
+	triangle.mVertex[1] = a.y;
+	triangle.mVertex[2] = a.z;
+	triangle.mEdgeAB[0] = b.x - a.x;
+	triangle.mEdgeAB[1] = b.y - a.y;
+	triangle.mEdgeAB[2] = b.z - a.z;
+	triangle.mEdgeAC[0] = c.x - a.x;
+	triangle.mEdgeAC[1] = c.y - a.y;
+	triangle.mEdgeAC[2] = c.z - a.z;
+	triangle.mTriangleIndex = static_cast<TriangleIndex>(mTriangles.size());
+	mTriangles.push_back(triangle);
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void LudumDare56::GameState::BoundingVolumeHierarchy::Build(void)
+{
+	mNodes.clear();
+	if (true == mTriangles.empty())
+	{
+		return;
+	}
+
+	std::vector<BuildEntry> entries(mTriangles.size());
+	for (size_t triangleIndex = 0; triangleIndex < mTriangles.size(); ++triangleIndex)
+	{
+		const Triangle& triangle = mTriangles[triangleIndex];
+		BuildEntry& entry = entries[triangleIndex];
+		entry.mBounds = EmptyBounds();
+		entry.mTriangle = static_cast<TriangleIndex>(triangleIndex);
+
+		for (size_t corner = 0; corner < 3; ++corner)
+		{
+			iceScalar point[3];
+			for (size_t axis = 0; axis < 3; ++axis)
+			{
+				point[axis] = triangle.mVertex[axis] + ((1 == corner) ? triangle.mEdgeAB[axis] : 0.0) +
+					((2 == corner) ? triangle.mEdgeAC[axis] : 0.0);
+			}
+			GrowBounds(entry.mBounds, point);
+		}
+
+		for (size_t axis = 0; axis < 3; ++axis)
+		{
+			entry.mCentroid[axis] = (entry.mBounds.mMinimum[axis] + entry.mBounds.mMaximum[axis]) * 0.5;
+		}
+	}
+
+	//At most one node per triangle on each side of a split, and there are always fewer leaves than triangles.
+	mNodes.reserve(mTriangles.size() * 2);
+	BuildNode(entries, 0, entries.size(), 0);
+	mNodes.shrink_to_fit();
+
+	//Sort the triangles into the order of the leaves so each leaf reads a single run of them.
+	std::vector<Triangle> sortedTriangles;
+	sortedTriangles.reserve(mTriangles.size());
+	for (const BuildEntry& entry : entries)
+	{
+		sortedTriangles.push_back(mTriangles[entry.mTriangle]);
+	}
+
+	mTriangles.swap(sortedTriangles);
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+size_t LudumDare56::GameState::BoundingVolumeHierarchy::BuildNode(std::vector<BuildEntry>& entries, const size_t first,
+	const size_t count, const size_t depth)
+{
+	const size_t nodeIndex = mNodes.size();
+	mNodes.push_back(Node());
+
+	Bounds bounds = EmptyBounds();
+	Bounds centroidBounds = EmptyBounds();
+	for (size_t entryIndex = first; entryIndex < first + count; ++entryIndex)
+	{
+		GrowBounds(bounds, entries[entryIndex].mBounds);
+		GrowBounds(centroidBounds, entries[entryIndex].mCentroid);
+	}
+
+	Node& node = mNodes[nodeIndex];
+	for (size_t axis = 0; axis < 3; ++axis)
+	{
+		node.mMinimum[axis] = RoundDown(bounds.mMinimum[axis]);
+		node.mMaximum[axis] = RoundUp(bounds.mMaximum[axis]);
+	}
+	node.mIndex = static_cast<tbCore::uint32>(first);
+	node.mCount = 0;
+	node.mAxis = 0;
+	node.mUnused = 0;
+
+	size_t bestAxis = 3;
+	size_t bestSplit = 0;
+	iceScalar bestCost = std::numeric_limits<iceScalar>::max();
+
+	if (count > 1 && depth < kMaximumDepth)
+	{
+		for (size_t axis = 0; axis < 3; ++axis)
+		{
+			const iceScalar extent = centroidBounds.mMaximum[axis] - centroidBounds.mMinimum[axis];
+			if (extent <= 0.0)
+			{
+				continue;
+			}
+
+			std::array<Bounds, kNumberOfBins> binBounds;
+			std::array<size_t, kNumberOfBins> binCounts;
+			binBounds.fill(EmptyBounds());
+			binCounts.fill(0);
+
+			const iceScalar binScale = static_cast<iceScalar>(kNumberOfBins) / extent;
+			for (size_t entryIndex = first; entryIndex < first + count; ++entryIndex)
+			{
+				const size_t bin = std::min(kNumberOfBins - 1, static_cast<size_t>(
+					(entries[entryIndex].mCentroid[axis] - centroidBounds.mMinimum[axis]) * binScale));
+				GrowBounds(binBounds[bin], entries[entryIndex].mBounds);
+				++binCounts[bin];
+			}
+
+			//Sweep from the right to know the cost of everything right of each split, then from the left to finish.
+			std::array<iceScalar, kNumberOfBins> rightCosts;
+			Bounds rightBounds = EmptyBounds();
+			size_t rightCount = 0;
+			for (size_t bin = kNumberOfBins - 1; bin > 0; --bin)
+			{
+				GrowBounds(rightBounds, binBounds[bin]);
+				rightCount += binCounts[bin];
+				rightCosts[bin] = (0 == rightCount) ? -1.0 : SurfaceArea(rightBounds) * static_cast<iceScalar>(rightCount);
+			}
+
+			Bounds leftBounds = EmptyBounds();
+			size_t leftCount = 0;
+			for (size_t split = 1; split < kNumberOfBins; ++split)
+			{
+				GrowBounds(leftBounds, binBounds[split - 1]);
+				leftCount += binCounts[split - 1];
+				if (0 == leftCount || rightCosts[split] < 0.0)
+				{
+					continue;
+				}
+
+				const iceScalar cost = SurfaceArea(leftBounds) * static_cast<iceScalar>(leftCount) + rightCosts[split];
+				if (cost < bestCost)
+				{
+					bestCost = cost;
+					bestAxis = axis;
+					bestSplit = split;
+				}
+			}
+		}
+	}
+
+	const iceScalar leafCost = SurfaceArea(bounds) * static_cast<iceScalar>(count);
+	const bool isSplitCheaper = (bestCost + kTraversalCost * SurfaceArea(bounds) < leafCost);
+	if (bestAxis > 2 || (count <= kMaximumLeafTriangles && false == isSplitCheaper))
+	{
+		tb_error_if(count > std::numeric_limits<tbCore::uint16>::max(), "Too many triangles share a spot in the BoundingVolumeHierarchy.");
+		node.mCount = static_cast<tbCore::uint16>(count);
+		return nodeIndex;
+	}
+
+	const iceScalar binScale = static_cast<iceScalar>(kNumberOfBins) / (centroidBounds.mMaximum[bestAxis] - centroidBounds.mMinimum[bestAxis]);
+	const iceScalar minimum = centroidBounds.mMinimum[bestAxis];
+	const std::vector<BuildEntry>::iterator middle = std::partition(entries.begin() + first, entries.begin() + first + count,
+		[bestAxis, bestSplit, binScale, minimum](const BuildEntry& entry) {
+			return std::min(kNumberOfBins - 1, static_cast<size_t>((entry.mCentroid[bestAxis] - minimum) * binScale)) < bestSplit;
+		});
+
+	const size_t leftCount = static_cast<size_t>(middle - (entries.begin() + first));
+	node.mAxis = static_cast<tbCore::uint8>(bestAxis);
+
+	//The node reference may not survive the children being added, from here on it is looked up again.
+	BuildNode(entries, first, leftCount, depth + 1);
+	const size_t rightIndex = BuildNode(entries, first + leftCount, count - leftCount, depth + 1);
+	mNodes[nodeIndex].mIndex = static_cast<tbCore::uint32>(rightIndex);
+	return nodeIndex;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void LudumDare56::GameState::BoundingVolumeHierarchy::GetBounds(iceVector3& minimum, iceVector3& maximum) const
+{
+	tb_error_if(true == mNodes.empty(), "Expected the BoundingVolumeHierarchy to be built before getting the bounds.");
+	const Node& root = mNodes.front();
+	minimum = iceVector3(root.mMinimum[0], root.mMinimum[1], root.mMinimum[2]);
+	maximum = iceVector3(root.mMaximum[0], root.mMaximum[1], root.mMaximum[2]);
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+bool LudumDare56::GameState::BoundingVolumeHierarchy::CastRay(const iceVector3& origin, const iceVector3& direction,
+	const iceScalar maximumDistance, RayHit& hit) const
+{
+	if (true == mNodes.empty())
+	{
+		return false;
+	}
+
+	const iceScalar rayOrigin[3] = { origin.x, origin.y, origin.z };
+	const iceScalar rayDirection[3] = { direction.x, direction.y, direction.z };
+
+	//A huge number instead of infinity for flat directions keeps the slabs from turning into 0 * infinity.
+	iceScalar inverseDirection[3];
+	for (size_t axis = 0; axis < 3; ++axis)
+	{
+		inverseDirection[axis] = (0.0 == rayDirection[axis]) ? std::numeric_limits<iceScalar>::max() : 1.0 / rayDirection[axis];
+	}
+
+	iceScalar closestDistance = maximumDistance;
+	const Triangle* closestTriangle = nullptr;
+
+	std::array<tbCore::uint32, kMaximumDepth> nodeStack;
+	size_t stackSize = 0;
+	tbCore::uint32 nodeIndex = 0;
+
+	while (true)
+	{
+		const Node& node = mNodes[nodeIndex];
+
+		iceScalar entryDistance = 0.0;
+		iceScalar exitDistance = closestDistance;
+		for (size_t axis = 0; axis < 3; ++axis)
+		{
+			iceScalar nearDistance = (static_cast<iceScalar>(node.mMinimum[axis]) - rayOrigin[axis]) * inverseDirection[axis];
+			iceScalar farDistance = (static_cast<iceScalar>(node.mMaximum[axis]) - rayOrigin[axis]) * inverseDirection[axis];
+			if (inverseDirection[axis] < 0.0)
+			{
+				std::swap(nearDistance, farDistance);
+			}
+
+			entryDistance = std::max(entryDistance, nearDistance);
+			exitDistance = std::min(exitDistance, farDistance);
+		}
+
+		if (entryDistance <= exitDistance)
+		{
+			if (0 != node.mCount)
+			{
+				for (size_t triangleIndex = node.mIndex; triangleIndex < node.mIndex + node.mCount; ++triangleIndex)
+				{
+					iceScalar distance = 0.0;
+					if (true == IntersectTriangle(mTriangles[triangleIndex], rayOrigin, rayDirection, closestDistance, distance))
+					{
+						closestDistance = distance;
+						closestTriangle = &mTriangles[triangleIndex];
+					}
+				}
+			}
+			else
+			{	//Visit the child on the side the ray comes from first, so the far one is more likely to be skipped.
+				tbCore::uint32 nearChild = nodeIndex + 1;
+				tbCore::uint32 farChild = node.mIndex;
+				if (rayDirection[node.mAxis] < 0.0)
+				{
+					std::swap(nearChild, farChild);
+				}
+
+				nodeStack[stackSize++] = farChild;
+				nodeIndex = nearChild;
+				continue;
+			}
+		}
+
+		if (0 == stackSize)
+		{
+			break;
+		}
+
+		nodeIndex = nodeStack[--stackSize];
+	}
+
+	if (nullptr == closestTriangle)
+	{
+		return false;
+	}
+
+	hit.mPoint = origin + direction * closestDistance;
+	hit.mDistance = closestDistance;
+	hit.mTriangleIndex = closestTriangle->mTriangleIndex;
+	return true;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+bool LudumDare56::GameState::BoundingVolumeHierarchy::CastRayAgainstAllTriangles(const iceVector3& origin,
+	const iceVector3& direction, const iceScalar maximumDistance, RayHit& hit) const
+{
+	const iceScalar rayOrigin[3] = { origin.x, origin.y, origin.z };
+	const iceScalar rayDirection[3] = { direction.x, direction.y, direction.z };
+
+	iceScalar closestDistance = maximumDistance;
+	const Triangle* closestTriangle = nullptr;
+
+	for (const Triangle& triangle : mTriangles)
+	{
+		iceScalar distance = 0.0;
+		if (true == IntersectTriangle(triangle, rayOrigin, rayDirection, closestDistance, distance))
+		{
+			closestDistance = distance;
+			closestTriangle = &triangle;
+		}
+	}
+
+	if (nullptr == closestTriangle)
+	{
+		return false;
+	}
+
+	hit.mPoint = origin + direction * closestDistance;
+	hit.mDistance = closestDistance;
+	hit.mTriangleIndex = closestTriangle->mTriangleIndex;
+	return true;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+bool LudumDare56::GameState::BoundingVolumeHierarchy::IntersectTriangle(const Triangle& triangle, const iceScalar origin[3],
+	const iceScalar direction[3], const iceScalar maximumDistance, iceScalar& distance)
+{	//Moller-Trumbore, without culling either side of the triangle.
+	iceScalar directionCrossAC[3];
+	Cross(direction, triangle.mEdgeAC, directionCrossAC);
+
+	const iceScalar determinant = Dot(triangle.mEdgeAB, directionCrossAC);
+	if (std::abs(determinant) < kParallelEpsilon)
+	{
+		return false;
+	}
+
+	const iceScalar inverseDeterminant = 1.0 / determinant;
+	const iceScalar fromVertex[3] = {
+		origin[0] - triangle.mVertex[0], origin[1] - triangle.mVertex[1], origin[2] - triangle.mVertex[2]
+	};
+
+	const iceScalar u = Dot(fromVertex, directionCrossAC) * inverseDeterminant;
+	if (u < 0.0 || u > 1.0)
+	{
+		return false;
+	}
+
+	iceScalar fromVertexCrossAB[3];
+	Cross(fromVertex, triangle.mEdgeAB, fromVertexCrossAB);
+
+	const iceScalar v = Dot(direction, fromVertexCrossAB) * inverseDeterminant;
+	if (v < 0.0 || u + v > 1.0)
+	{
+		return false;
+	}
+
+	const iceScalar hitDistance = Dot(triangle.mEdgeAC, fromVertexCrossAB) * inverseDeterminant;
+	if (hitDistance < 0.0 || hitDistance >= maximumDistance)
+	{
+		return false;
+	}
+
+	distance = hitDistance;
+	return true;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
+
+class BoundingVolumeHierarchyTest : tbCore::UnitTest::TestCaseInterface
+{
+public:
+	BoundingVolumeHierarchyTest(void) :
+		tbCore::UnitTest::TestCaseInterface("BoundingVolumeHierarchyTest")
+	{
+	}
+
+	~BoundingVolumeHierarchyTest(void)
+	{
+	}
+
+protected:
+	virtual bool OnRunTest(void) override
+	{
+		using namespace LudumDare56::GameState;
+
+		BoundingVolumeHierarchy::RayHit hit;
+
+		BoundingVolumeHierarchy hierarchy;
+		ExpectedValue(hierarchy.CastRay(iceVector3(0.0, 1.0, 0.0), iceVector3(0.0, -1.0, 0.0), 10.0, hit), false,
+			"An empty hierarchy is expected to never be hit.");
+
+		hierarchy.AddTriangle(iceVector3(-1.0, 0.0, -1.0), iceVector3(1.0, 0.0, -1.0), iceVector3(0.0, 0.0, 1.0));
+		hierarchy.Build();
+		ExpectedValue(hierarchy.CastRay(iceVector3(0.0, 2.0, 0.0), iceVector3(0.0, -1.0, 0.0), 10.0, hit), true,
+			"A ray straight down onto a single triangle is expected to hit it.");
+		ExpectedValue(std::abs(hit.mDistance - 2.0) < 1.0e-12, true, "Expected to hit the triangle 2m below, not %f.", hit.mDistance);
+		ExpectedValue(hierarchy.CastRay(iceVector3(0.0, 2.0, 0.0), iceVector3(0.0, -1.0, 0.0), 1.5, hit), false,
+			"A triangle beyond the maximum distance is expected to be missed.");
+
+		for (tbCore::uint32 seed = 0; seed < 4; ++seed)
+		{
+			RunRandomTerrain(seed);
+		}
+
+		return true;
+	}
+
+private:
+	///
+	/// @details Builds a bumpy ground, a lot like a racetrack surface, with random triangles floating above it. Then
+	///   casts rays down at it, like the ground probes, and in every direction, comparing each against every triangle.
+	///
+	void RunRandomTerrain(const tbCore::uint32 seed)
+	{
+		using namespace LudumDare56::GameState;
+
+		std::mt19937 generator(seed);
+		std::uniform_real_distribution<iceScalar> bump(-0.25, 0.25);
+		std::uniform_real_distribution<iceScalar> spread(-50.0, 50.0);
+		std::uniform_real_distribution<iceScalar> height(0.0, 10.0);
+		std::uniform_real_distribution<iceScalar> unit(-1.0, 1.0);
+
+		const int kGridSize = 40;
+		const iceScalar kCellSize = 2.5;
+		std::vector<iceScalar> heights((kGridSize + 1) * (kGridSize + 1));
+		for (iceScalar& value : heights)
+		{
+			value = bump(generator);
+		}
+
+		BoundingVolumeHierarchy hierarchy;
+		const auto corner = [&heights, kGridSize, kCellSize](const int x, const int z) {
+			return iceVector3((x - kGridSize / 2) * kCellSize, heights[z * (kGridSize + 1) + x], (z - kGridSize / 2) * kCellSize);
+		};
+
+		for (int z = 0; z < kGridSize; ++z)
+		{
+			for (int x = 0; x < kGridSize; ++x)
+			{
+				hierarchy.AddTriangle(corner(x, z), corner(x + 1, z), corner(x, z + 1));
+				hierarchy.AddTriangle(corner(x + 1, z), corner(x + 1, z + 1), corner(x, z + 1));
+			}
+		}
+
+		for (int triangle = 0; triangle < 300; ++triangle)
+		{
+			const iceVector3 center(spread(generator), height(generator), spread(generator));
+			hierarchy.AddTriangle(center + iceVector3(unit(generator), unit(generator), unit(generator)) * 2.0,
+				center + iceVector3(unit(generator), unit(generator), unit(generator)) * 2.0,
+				center + iceVector3(unit(generator), unit(generator), unit(generator)) * 2.0);
+		}
+
+		hierarchy.Build();
+		ExpectedValue(hierarchy.GetNumberOfNodes() > 1, true, "Expected the hierarchy (seed %d) to split the triangles.", seed);
+
+		int numberOfHits = 0;
+		for (int rayIndex = 0; rayIndex < 4000; ++rayIndex)
+		{
+			const iceVector3 origin(spread(generator), height(generator) + 0.5, spread(generator));
+
+			iceVector3 direction(0.0, -1.0, 0.0);
+			iceScalar maximumDistance = 2.1;
+			if (0 != rayIndex % 2)
+			{
+				direction = iceVector3(unit(generator), unit(generator), unit(generator));
+				if (direction.MagnitudeSquared() < 0.01)
+				{
+					direction = iceVector3(1.0, 0.0, 0.0);
+				}
+
+				direction = direction.GetNormalized();
+				maximumDistance = 200.0;
+			}
+
+			BoundingVolumeHierarchy::RayHit expected = { iceVector3::Zero(), 0.0, 0 };
+			BoundingVolumeHierarchy::RayHit actual = { iceVector3::Zero(), 0.0, 0 };
+			const bool expectedHit = hierarchy.CastRayAgainstAllTriangles(origin, direction, maximumDistance, expected);
+			const bool actualHit = hierarchy.CastRay(origin, direction, maximumDistance, actual);
+
+			ExpectedValue(actualHit, expectedHit, "Ray %d (seed %d) was expected to %s.", rayIndex, seed,
+				(true == expectedHit) ? "hit" : "miss");
+			if (true == expectedHit && true == actualHit)
+			{
+				ExpectedValue(actual.mDistance == expected.mDistance, true,
+					"Ray %d (seed %d) hit at %f, expected the closest hit at %f.", rayIndex, seed, actual.mDistance, expected.mDistance);
+				++numberOfHits;
+			}
+		}
+
+		ExpectedValue(numberOfHits > 1000, true, "Expected most of the rays (seed %d) to hit something, only %d did.", seed, numberOfHits);
+	}
+};
+
+BoundingVolumeHierarchyTest theBoundingVolumeHierarchyTest;
+
+//--------------------------------------------------------------------------------------------------------------------//
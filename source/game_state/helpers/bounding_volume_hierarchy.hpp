@@ -0,0 +1,121 @@
+///
+/// @file
+/// @details A static bounding volume hierarchy of triangles to quickly cast rays against the racetrack surface.
+///
+/// <!-- Copyright (c) 2024 Tyre Bytes LLC - All Rights Reserved -->
+///------------------------------------------------------------------------------------------------------------------///
+
+#ifndef LudumDare56_BoundingVolumeHierarchy_hpp
+#define LudumDare56_BoundingVolumeHierarchy_hpp
+
+#include "../../ludumdare56.hpp"
+
+#include <turtle_brains/core/tb_types.hpp>
+
+#include <vector>
+
+namespace LudumDare56::GameState
+{
+
+	///
+	/// @details Triangles are added once, then Build() splits them with the surface area heuristic into a tree that is
+	///   flattened depth first; the left child of a node always directly follows it, and each node is 32 bytes so two
+	///   share a cache line. Nothing can be added or moved after building, it is meant for static geometry such as the
+	///   racetrack, and once built any number of threads may cast rays at the same time.
+	///
+	/// @note Only Build() allocates, casting a ray never does.
+	///
+	class BoundingVolumeHierarchy
+	{
+	public:
+		typedef tbCore::uint32 TriangleIndex;
+
+		struct RayHit
+		{
+			iceVector3 mPoint;
+			iceScalar mDistance;
+			TriangleIndex mTriangleIndex;  //In the order the triangles were added.
+		};
+
+		BoundingVolumeHierarchy(void);
+		~BoundingVolumeHierarchy(void);
+
+		///
+		/// @details Removes all the triangles and nodes, the hierarchy will then be empty until built again.
+		///
+		void Clear(void);
+
+		///
+		/// @details Adds a triangle to be part of the next Build(), either winding is hit by rays.
+		///
+		void AddTriangle(const iceVector3& a, const iceVector3& b, const iceVector3& c);
+
+		///
+		/// @details Builds the hierarchy from every triangle that was added, this can be slow for large meshes and is
+		///   expected to be done once when loading.
+		///
+		void Build(void);
+
+		inline bool IsEmpty(void) const { return mNodes.empty(); }
+		inline size_t GetNumberOfTriangles(void) const { return mTriangles.size(); }
+		inline size_t GetNumberOfNodes(void) const { return mNodes.size(); }
+
+		///
+		/// @details Gets the box around every triangle in the hierarchy, only meaningful when it is not empty.
+		///
+		void GetBounds(iceVector3& minimum, iceVector3& maximum) const;
+
+		///
+		/// @details Finds the closest triangle hit by the ray within maximumDistance of the origin. The direction is
+		///   expected to be normalized, the distance is then in meters.
+		///
+		/// @return true if a triangle was hit, in which case the hit is filled in, otherwise the hit is left alone.
+		///
+		bool CastRay(const iceVector3& origin, const iceVector3& direction, const iceScalar maximumDistance, RayHit& hit) const;
+
+		///
+		/// @details Gives the exact same results as CastRay() by testing every triangle, one after another. This is the
+		///   reference to test and benchmark the hierarchy against and should not be used for anything else.
+		///
+		bool CastRayAgainstAllTriangles(const iceVector3& origin, const iceVector3& direction, const iceScalar maximumDistance,
+			RayHit& hit) const;
+
+	private:
+		struct Triangle
+		{
+			iceScalar mVertex[3];
+			iceScalar mEdgeAB[3];
+			iceScalar mEdgeAC[3];
+			TriangleIndex mTriangleIndex;
+		};
+
+		///
+		/// @details A leaf when mCount is not zero, holding triangles mIndex to mIndex + mCount. Otherwise the left child
+		///   is the next node and mIndex is the right child, mAxis is the axis the children were split along.
+		///
+		struct Node
+		{
+			float mMinimum[3];
+			float mMaximum[3];
+			tbCore::uint32 mIndex;
+			tbCore::uint16 mCount;
+			tbCore::uint8 mAxis;
+			tbCore::uint8 mUnused;
+		};
+
+		static_assert(sizeof(Node) == 32, "Expected the BoundingVolumeHierarchy nodes to be 32 bytes.");
+
+		struct BuildEntry;
+
+		size_t BuildNode(std::vector<BuildEntry>& entries, const size_t first, const size_t count, const size_t depth);
+
+		static bool IntersectTriangle(const Triangle& triangle, const iceScalar origin[3], const iceScalar direction[3],
+			const iceScalar maximumDistance, iceScalar& distance);
+
+		std::vector<Triangle> mTriangles;
+		std::vector<Node> mNodes;
+	};
+
+};	//namespace LudumDare56::GameState
+
+#endif /* LudumDare56_BoundingVolumeHierarchy_hpp */
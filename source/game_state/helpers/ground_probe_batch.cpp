@@ -0,0 +1,145 @@
+///
+/// @file
+/// @details Collects the downward ground probes of a swarm so they can be cast together in a single stage.
+///
+/// <!-- Copyright (c) 2024 Tyre Bytes LLC - All Rights Reserved -->
+///------------------------------------------------------------------------------------------------------------------///
+
+#include "../../game_state/helpers/ground_probe_batch.hpp"
+
+#include "../../logging.hpp"
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+LudumDare56::GameState::GroundProbeBatch::GroundProbeBatch(const iceScalar probeHeight, const iceScalar probeReach) :
+	mProbeHeight(probeHeight),
+	mProbeReach(probeReach),
+	mProbeEntries(),
+	mOriginX(),
+	mOriginY(),
+	mOriginZ(),
+	mResults(),
+	mGroundHeight()
+{
+	tb_error_if(probeReach < probeHeight, "Expected the GroundProbeBatch to reach at least as far as the probe height.");
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+LudumDare56::GameState::GroundProbeBatch::~GroundProbeBatch(void)
+{
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void LudumDare56::GameState::GroundProbeBatch::Reset(const size_t numberOfEntries)
+{
+	mProbeEntries.clear();
+	mOriginX.clear();
+	mOriginY.clear();
+	mOriginZ.clear();
+
+	mProbeEntries.reserve(numberOfEntries);
+	mOriginX.reserve(numberOfEntries);
+	mOriginY.reserve(numberOfEntries);
+	mOriginZ.reserve(numberOfEntries);
+
+	mResults.assign(numberOfEntries, kNotProbed);
+	mGroundHeight.assign(numberOfEntries, 0.0);
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void LudumDare56::GameState::GroundProbeBatch::AddProbe(const EntryIndex entryIndex, const iceVector3& positionInWorld)
+{
+	tb_error_if(entryIndex >= mResults.size(), "Expected the GroundProbeBatch to be reset to hold entry %d.", entryIndex);
+	tb_error_if(kNotProbed != mResults[entryIndex], "Expected only one probe per entry within a GroundProbeBatch.");
+
+	//Marked as a miss until the probe gets cast, which also catches adding the entry a second time.
+	mResults[entryIndex] = kMissedGround;
+
+	mProbeEntries.push_back(entryIndex);
+	mOriginX.push_back(positionInWorld.x);
+	mOriginY.push_back(positionInWorld.y + mProbeHeight);
+	mOriginZ.push_back(positionInWorld.z);
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void LudumDare56::GameState::GroundProbeBatch::CastProbes(icePhysics::World& physicalWorld)
+{
+	//The physical world does not (yet) take a batch of rays, so this walks the packed probes one after another. When
+	//  there is a racetrack surface the hierarchy version below is much faster.
+	iceScalar fraction = 0.0;
+	iceVector3 intersectionPoint = iceVector3::Zero();
+
+	const size_t numberOfProbes = mProbeEntries.size();
+	for (size_t probeIndex = 0; probeIndex < numberOfProbes; ++probeIndex)
+	{
+		const iceVector3 origin(mOriginX[probeIndex], mOriginY[probeIndex], mOriginZ[probeIndex]);
+		if (true == physicalWorld.HackyAPI_CastRay(origin, Vector3::Down(), intersectionPoint, fraction) && fraction < mProbeReach)
+		{
+			const EntryIndex entryIndex = mProbeEntries[probeIndex];
+			mResults[entryIndex] = kHitGround;
+			mGroundHeight[entryIndex] = intersectionPoint.y;
+		}
+	}
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void LudumDare56::GameState::GroundProbeBatch::CastProbes(const BoundingVolumeHierarchy& hierarchy)
+{
+	const iceVector3 down(0.0, -1.0, 0.0);
+	BoundingVolumeHierarchy::RayHit hit;
+
+	const size_t numberOfProbes = mProbeEntries.size();
+	for (size_t probeIndex = 0; probeIndex < numberOfProbes; ++probeIndex)
+	{
+		const iceVector3 origin(mOriginX[probeIndex], mOriginY[probeIndex], mOriginZ[probeIndex]);
+		if (true == hierarchy.CastRay(origin, down, mProbeReach, hit))
+		{
+			const EntryIndex entryIndex = mProbeEntries[probeIndex];
+			mResults[entryIndex] = kHitGround;
+			mGroundHeight[entryIndex] = hit.mPoint.y;
+		}
+	}
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void LudumDare56::GameState::GroundProbeBatch::CastProbes(const TrackSurfaceTable& trackSurface)
+{
+	TrackSurfaceTable::SurfaceSample sample;
+
+	//The probes the table cannot answer are packed to the front, in order, so they can still be cast afterwards.
+	size_t remainingProbes = 0;
+
+	const size_t numberOfProbes = mProbeEntries.size();
+	for (size_t probeIndex = 0; probeIndex < numberOfProbes; ++probeIndex)
+	{
+		const iceVector3 origin(mOriginX[probeIndex], mOriginY[probeIndex], mOriginZ[probeIndex]);
+		const EntryIndex entryIndex = mProbeEntries[probeIndex];
+
+		if (false == trackSurface.QuerySurface(origin, sample) || false == sample.mHasSurface)
+		{
+			mProbeEntries[remainingProbes] = entryIndex;
+			mOriginX[remainingProbes] = mOriginX[probeIndex];
+			mOriginY[remainingProbes] = mOriginY[probeIndex];
+			mOriginZ[remainingProbes] = mOriginZ[probeIndex];
+			++remainingProbes;
+		}
+		else if (sample.mGroundHeight <= origin.y && origin.y - sample.mGroundHeight < mProbeReach)
+		{
+			mResults[entryIndex] = kHitGround;
+			mGroundHeight[entryIndex] = sample.mGroundHeight;
+		}
+	}
+
+	mProbeEntries.resize(remainingProbes);
+	mOriginX.resize(remainingProbes);
+	mOriginY.resize(remainingProbes);
+	mOriginZ.resize(remainingProbes);
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
@@ -0,0 +1,102 @@
+///
+/// @file
+/// @details Collects the downward ground probes of a swarm so they can be cast together in a single stage.
+///
+/// <!-- Copyright (c) 2024 Tyre Bytes LLC - All Rights Reserved -->
+///------------------------------------------------------------------------------------------------------------------///
+
+#ifndef LudumDare56_GroundProbeBatch_hpp
+#define LudumDare56_GroundProbeBatch_hpp
+
+#include "../../game_state/helpers/bounding_volume_hierarchy.hpp"
+#include "../../game_state/helpers/track_surface_table.hpp"
+#include "../../ludumdare56.hpp"
+
+#include <turtle_brains/core/tb_types.hpp>
+
+#include <ice/physics/ice_physical_world.hpp>
+
+#include <vector>
+
+namespace LudumDare56::GameState
+{
+
+	///
+	/// @details Each entry (creature) can add at most one probe per batch. A probe starts mProbeHeight above the entry
+	///   position and looks straight down, finding ground if something is hit within mProbeReach of the start.
+	///
+	/// @note The batch does not allocate once it has been reset to hold the largest number of entries it has seen.
+	///
+	class GroundProbeBatch
+	{
+	public:
+		typedef tbCore::uint32 EntryIndex;
+
+		enum ProbeResult : tbCore::uint8
+		{
+			kNotProbed = 0,
+			kMissedGround = 1,
+			kHitGround = 2,
+		};
+
+		GroundProbeBatch(const iceScalar probeHeight, const iceScalar probeReach);
+		~GroundProbeBatch(void);
+
+		///
+		/// @details Clears all probes and results, preparing to hold up to numberOfEntries probes.
+		///
+		void Reset(const size_t numberOfEntries);
+
+		///
+		/// @details Adds a probe beneath the positionInWorld of the entry. It is an error condition to add more than one
+		///   probe for the same entry within a batch.
+		///
+		void AddProbe(const EntryIndex entryIndex, const iceVector3& positionInWorld);
+
+		///
+		/// @details Casts every probe in the batch against the physical world and stores the results for each entry.
+		///
+		void CastProbes(icePhysics::World& physicalWorld);
+
+		///
+		/// @details Casts every probe in the batch against only the triangles of the hierarchy, such as the racetrack
+		///   surface, and stores the results for each entry.
+		///
+		void CastProbes(const BoundingVolumeHierarchy& hierarchy);
+
+		///
+		/// @details Looks up every probe in the batch from the precomputed racetrack surface rather than casting rays.
+		///   The probes the table answers are removed from the batch, while any probe beyond the shoulders of the track,
+		///   or without surface beneath it in the table, stays a miss and remains in the batch. Another CastProbes()
+		///   against the racetrack hierarchy or physical world afterwards casts only those remaining probes.
+		///
+		void CastProbes(const TrackSurfaceTable& trackSurface);
+
+		inline ProbeResult GetResult(const EntryIndex entryIndex) const { return static_cast<ProbeResult>(mResults[entryIndex]); }
+
+		///
+		/// @details Returns the height of the ground beneath the entry, only meaningful when the result is kHitGround.
+		///
+		inline iceScalar GetGroundHeight(const EntryIndex entryIndex) const { return mGroundHeight[entryIndex]; }
+
+		///
+		/// @details Returns the number of probes in the batch that still need casting, see CastProbes() with the table.
+		///
+		inline size_t GetNumberOfProbes(void) const { return mProbeEntries.size(); }
+
+	private:
+		const iceScalar mProbeHeight;
+		const iceScalar mProbeReach;
+
+		std::vector<EntryIndex> mProbeEntries;
+		std::vector<iceScalar> mOriginX;
+		std::vector<iceScalar> mOriginY;
+		std::vector<iceScalar> mOriginZ;
+
+		std::vector<tbCore::uint8> mResults;   //ProbeResult for each entry.
+		std::vector<iceScalar> mGroundHeight;  //Height of the ground for each entry.
+	};
+
+};	//namespace LudumDare56::GameState
+
+#endif /* LudumDare56_GroundProbeBatch_hpp */
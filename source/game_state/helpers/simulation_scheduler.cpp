@@ -0,0 +1,183 @@
+///
+/// @file
+/// @details Runs the subsystems of a fixed-step simulation, each at its own fraction of the simulation rate.
+///
+/// <!-- Copyright (c) 2024 Tyre Bytes LLC - All Rights Reserved -->
+///------------------------------------------------------------------------------------------------------------------///
+
+#include "../../game_state/helpers/simulation_scheduler.hpp"
+
+#include "../../logging.hpp"
+
+#include <turtle_brains/core/unit_test/tb_unit_test.hpp>
+
+#include <array>
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+LudumDare56::GameState::SimulationScheduler::SimulationScheduler(void) :
+	mSubsystems()
+{
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+LudumDare56::GameState::SimulationScheduler::~SimulationScheduler(void)
+{
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void LudumDare56::GameState::SimulationScheduler::Clear(void)
+{
+	mSubsystems.clear();
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+LudumDare56::GameState::SimulationScheduler::SubsystemIndex LudumDare56::GameState::SimulationScheduler::AddSubsystem(
+	const tbCore::tbString& name, const Tick divisor, const Tick phase, const SubsystemFunction& function)
+{
+	tb_error_if(0 == divisor, "Expected the divisor of subsystem %s to be 1 or more.", name.c_str());
+	tb_error_if(phase >= divisor, "Expected the phase of subsystem %s to be less than the divisor.", name.c_str());
+	tb_error_if(nullptr == function, "Expected subsystem %s to have a function to run.", name.c_str());
+
+	Subsystem subsystem;
+	subsystem.mName = name;
+	subsystem.mFunction = function;
+	subsystem.mDivisor = divisor;
+	subsystem.mPhase = phase;
+#if defined(development_build)
+	subsystem.mProfiler.reset(new TyreBytes::Core::Development::TimeProfiler(name));
+#endif /* development_build */
+
+	mSubsystems.push_back(std::move(subsystem));
+	return mSubsystems.size() - 1;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+LudumDare56::GameState::SimulationScheduler::Tick LudumDare56::GameState::SimulationScheduler::FindQuietestPhase(
+	const Tick divisor) const
+{
+	tb_error_if(0 == divisor, "Expected the divisor to be 1 or more.");
+
+	Tick quietestPhase = 0;
+	double quietestLoad = -1.0;
+
+	for (Tick phase = 0; phase < divisor; ++phase)
+	{
+		double load = 0.0;
+		for (const Subsystem& subsystem : mSubsystems)
+		{
+			if (1 == subsystem.mDivisor)
+			{
+				continue;
+			}
+
+			//Within divisor * mDivisor ticks the pattern of both repeats, and this phase has mDivisor ticks in it.
+			Tick sharedTicks = 0;
+			for (Tick tick = phase; tick < divisor * subsystem.mDivisor; tick += divisor)
+			{
+				if (subsystem.mPhase == tick % subsystem.mDivisor)
+				{
+					++sharedTicks;
+				}
+			}
+
+			load += static_cast<double>(sharedTicks) / static_cast<double>(subsystem.mDivisor);
+		}
+
+		if (quietestLoad < 0.0 || load < quietestLoad)
+		{
+			quietestPhase = phase;
+			quietestLoad = load;
+		}
+	}
+
+	return quietestPhase;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void LudumDare56::GameState::SimulationScheduler::Simulate(const Tick tick)
+{
+	for (Subsystem& subsystem : mSubsystems)
+	{
+		if (subsystem.mPhase != tick % subsystem.mDivisor)
+		{
+			continue;
+		}
+
+#if defined(development_build)
+		subsystem.mProfiler->Start();
+		subsystem.mFunction();
+		subsystem.mProfiler->Stop();
+#else
+		subsystem.mFunction();
+#endif /* development_build */
+	}
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
+
+class SimulationSchedulerTest : tbCore::UnitTest::TestCaseInterface
+{
+public:
+	SimulationSchedulerTest(void) :
+		tbCore::UnitTest::TestCaseInterface("SimulationSchedulerTest")
+	{
+	}
+
+	~SimulationSchedulerTest(void)
+	{
+	}
+
+protected:
+	virtual bool OnRunTest(void) override
+	{
+		using namespace LudumDare56::GameState;
+
+		std::array<int, 3> runCounts = { 0, 0, 0 };
+		std::array<SimulationScheduler::Tick, 3> lastTicks = { 0, 0, 0 };
+		SimulationScheduler::Tick currentTick = 0;
+
+		SimulationScheduler scheduler;
+		scheduler.AddSubsystem("Every", 1, 0, [&]() { ++runCounts[0]; lastTicks[0] = currentTick; });
+		scheduler.AddSubsystem("Tenth", 10, 3, [&]() { ++runCounts[1]; lastTicks[1] = currentTick; });
+		scheduler.AddSubsystem("Fifth", 5, 4, [&]() { ++runCounts[2]; lastTicks[2] = currentTick; });
+
+		for (currentTick = 0; currentTick < 100; ++currentTick)
+		{
+			scheduler.Simulate(currentTick);
+		}
+
+		ExpectedValue(runCounts[0], 100, "Expected the full rate subsystem to run every tick.");
+		ExpectedValue(runCounts[1], 10, "Expected the tenth rate subsystem to run every 10th tick.");
+		ExpectedValue(runCounts[2], 20, "Expected the fifth rate subsystem to run every 5th tick.");
+		ExpectedValue(lastTicks[1], SimulationScheduler::Tick(93), "Expected the tenth rate subsystem to last run on tick 93.");
+		ExpectedValue(lastTicks[2], SimulationScheduler::Tick(99), "Expected the fifth rate subsystem to last run on tick 99.");
+
+		SimulationScheduler spreading;
+		spreading.AddSubsystem("Always", 1, 0, []() { });
+		ExpectedValue(spreading.FindQuietestPhase(4), SimulationScheduler::Tick(0), "Expected full rate subsystems not to count.");
+
+		spreading.AddSubsystem("First", 4, spreading.FindQuietestPhase(4), []() { });
+		spreading.AddSubsystem("Second", 4, spreading.FindQuietestPhase(4), []() { });
+		spreading.AddSubsystem("Third", 2, spreading.FindQuietestPhase(2), []() { });
+		ExpectedValue(spreading.GetPhase(1), SimulationScheduler::Tick(0), "Expected the first subsystem on phase 0.");
+		ExpectedValue(spreading.GetPhase(2), SimulationScheduler::Tick(1), "Expected the second subsystem beside the first.");
+		ExpectedValue(spreading.GetPhase(3), SimulationScheduler::Tick(0), "Expected the half rate subsystem on phase 0.");
+
+		//Phase 3 of 4 is the only one left without any of the slower subsystems.
+		ExpectedValue(spreading.FindQuietestPhase(4), SimulationScheduler::Tick(3), "Expected phase 3 of 4 to be quietest.");
+		ExpectedValue(spreading.IsDue(3, 6), true, "Expected the half rate subsystem to be due on tick 6.");
+		ExpectedValue(spreading.IsDue(3, 7), false, "Expected the half rate subsystem not to be due on tick 7.");
+
+		return true;
+	}
+};
+
+SimulationSchedulerTest theSimulationSchedulerTest;
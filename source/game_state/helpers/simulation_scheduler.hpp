@@ -0,0 +1,102 @@
+///
+/// @file
+/// @details Runs the subsystems of a fixed-step simulation, each at its own fraction of the simulation rate.
+///
+/// <!-- Copyright (c) 2024 Tyre Bytes LLC - All Rights Reserved -->
+///------------------------------------------------------------------------------------------------------------------///
+
+#ifndef LudumDare56_SimulationScheduler_hpp
+#define LudumDare56_SimulationScheduler_hpp
+
+#include "../../core/development/time_profiler.hpp"
+
+#include <turtle_brains/core/tb_types.hpp>
+#include <turtle_brains/core/tb_string.hpp>
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace LudumDare56::GameState
+{
+
+	///
+	/// @details Each subsystem runs on the ticks where the tick modulo its divisor equals its phase, so a divisor of 1
+	///   runs every tick and a divisor of 10 with a phase of 3 runs on ticks 3, 13, 23 and so on. The subsystems run in
+	///   the order they were added, and the tick comes from the simulation so the same ticks run the same subsystems on
+	///   every machine and again after restoring a snapshot.
+	///
+	///   In a development_build each subsystem is timed with its own TimeProfiler, named after the subsystem.
+	///
+	class SimulationScheduler
+	{
+	public:
+		typedef tbCore::uint32 Tick;
+		typedef size_t SubsystemIndex;
+		typedef std::function<void(void)> SubsystemFunction;
+
+		SimulationScheduler(void);
+		~SimulationScheduler(void);
+
+		SimulationScheduler(const SimulationScheduler& other) = delete;
+		SimulationScheduler& operator=(const SimulationScheduler& other) = delete;
+
+		///
+		/// @details Removes every subsystem.
+		///
+		void Clear(void);
+
+		///
+		/// @param divisor how many ticks between each run of the subsystem, 1 or more.
+		/// @param phase which tick within the divisor the subsystem runs on, less than the divisor.
+		///
+		SubsystemIndex AddSubsystem(const tbCore::tbString& name, const Tick divisor, const Tick phase,
+			const SubsystemFunction& function);
+
+		///
+		/// @details Returns the phase for a new subsystem with the divisor that shares its ticks with the fewest of the
+		///   subsystems already added, so the slower work gets spread across the ticks instead of bunched on one.
+		///   Subsystems that run every tick are the same on each phase and don't count.
+		///
+		Tick FindQuietestPhase(const Tick divisor) const;
+
+		///
+		/// @details Runs every subsystem that is due on the tick.
+		///
+		void Simulate(const Tick tick);
+
+		inline bool IsDue(const SubsystemIndex subsystemIndex, const Tick tick) const
+		{
+			return (tick % mSubsystems[subsystemIndex].mDivisor) == mSubsystems[subsystemIndex].mPhase;
+		}
+
+		inline size_t GetNumberOfSubsystems(void) const { return mSubsystems.size(); }
+		inline const tbCore::tbString& GetName(const SubsystemIndex subsystemIndex) const { return mSubsystems[subsystemIndex].mName; }
+		inline Tick GetDivisor(const SubsystemIndex subsystemIndex) const { return mSubsystems[subsystemIndex].mDivisor; }
+		inline Tick GetPhase(const SubsystemIndex subsystemIndex) const { return mSubsystems[subsystemIndex].mPhase; }
+
+#if defined(development_build)
+		inline const TyreBytes::Core::Development::TimeProfiler& GetProfiler(const SubsystemIndex subsystemIndex) const
+		{
+			return *mSubsystems[subsystemIndex].mProfiler;
+		}
+#endif /* development_build */
+
+	private:
+		struct Subsystem
+		{
+			tbCore::tbString mName;
+			SubsystemFunction mFunction;
+			Tick mDivisor;
+			Tick mPhase;
+#if defined(development_build)
+			std::unique_ptr<TyreBytes::Core::Development::TimeProfiler> mProfiler;
+#endif /* development_build */
+		};
+
+		std::vector<Subsystem> mSubsystems;
+	};
+
+};	//namespace LudumDare56::GameState
+
+#endif /* LudumDare56_SimulationScheduler_hpp */
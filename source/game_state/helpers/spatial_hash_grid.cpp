@@ -0,0 +1,166 @@
+///
+/// @file
+/// @details A uniform hash grid on the ground plane for quickly finding nearby swarm creatures.
+///
+/// <!-- Copyright (c) 2024 Tyre Bytes LLC - All Rights Reserved -->
+///------------------------------------------------------------------------------------------------------------------///
+
+#include "../../game_state/helpers/spatial_hash_grid.hpp"
+
+#include "../../logging.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+LudumDare56::GameState::SpatialHashGrid::SpatialHashGrid(void) :
+	mBucketStart(),
+	mEntryBucket(),
+	mSortedEntries(),
+	mCellSize(1.0),
+	mInverseCellSize(1.0),
+	mBucketMask(0),
+	mNumberOfEntries(0)
+{
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+LudumDare56::GameState::SpatialHashGrid::~SpatialHashGrid(void)
+{
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void LudumDare56::GameState::SpatialHashGrid::BeginRebuild(const iceScalar cellSize, const size_t numberOfEntries,
+	const size_t numberOfBucketedEntries, const bool clearEntries)
+{
+	tb_error_if(cellSize <= 0.0, "Expected the cell size of the SpatialHashGrid to be greater than zero.");
+	tb_error_if(numberOfBucketedEntries > numberOfEntries, "Expected the SpatialHashGrid to bucket at most every entry.");
+
+	mCellSize = cellSize;
+	mInverseCellSize = iceScalar(1.0) / cellSize;
+	mNumberOfEntries = static_cast<tbCore::uint32>(numberOfEntries);
+
+	//Keep roughly two buckets per entry so collisions between unrelated cells stay rare, and a power of two to allow
+	//  masking instead of the modulo.
+	tbCore::uint32 numberOfBuckets = 64;
+	while (numberOfBuckets < numberOfBucketedEntries * 2)
+	{
+		numberOfBuckets *= 2;
+	}
+
+	mBucketMask = numberOfBuckets - 1;
+	mBucketStart.assign(numberOfBuckets + 1, 0);
+	if (true == clearEntries)
+	{
+		mEntryBucket.assign(numberOfEntries, kExcludedEntry);
+	}
+	else
+	{
+		mEntryBucket.resize(numberOfEntries);
+	}
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void LudumDare56::GameState::SpatialHashGrid::AddEntry(const EntryIndex entryIndex, const iceVector3& position)
+{
+	const tbCore::uint32 bucket = ComputeBucket(ComputeCell(position.x), ComputeCell(position.z));
+	mEntryBucket[entryIndex] = bucket;
+	++mBucketStart[bucket];
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void LudumDare56::GameState::SpatialHashGrid::FinishRebuild(void)
+{
+	mSortedEntries.resize(FinishBucketCounts());
+	for (EntryIndex entryIndex = mNumberOfEntries; entryIndex > 0; --entryIndex)
+	{
+		const tbCore::uint32 bucket = mEntryBucket[entryIndex - 1];
+		if (kExcludedEntry != bucket)
+		{
+			mSortedEntries[--mBucketStart[bucket]] = entryIndex - 1;
+		}
+	}
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void LudumDare56::GameState::SpatialHashGrid::FinishRebuild(const tbCore::uint16* includedEntries, const size_t numberOfIncludedEntries)
+{
+	//Walking the included entries backwards leaves them in ascending order within a bucket, same as FinishRebuild().
+	mSortedEntries.resize(FinishBucketCounts());
+	for (size_t includedIndex = numberOfIncludedEntries; includedIndex > 0; --includedIndex)
+	{
+		const EntryIndex entryIndex = includedEntries[includedIndex - 1];
+		mSortedEntries[--mBucketStart[mEntryBucket[entryIndex]]] = entryIndex;
+	}
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+tbCore::uint32 LudumDare56::GameState::SpatialHashGrid::FinishBucketCounts(void)
+{
+	const tbCore::uint32 numberOfBuckets = mBucketMask + 1;
+
+	//Turn the counts into the (exclusive) end of each bucket, then the entries are placed into each bucket from the
+	//  back which leaves mBucketStart holding the first entry of each bucket.
+	tbCore::uint32 total = 0;
+	for (tbCore::uint32 bucket = 0; bucket < numberOfBuckets; ++bucket)
+	{
+		total += mBucketStart[bucket];
+		mBucketStart[bucket] = total;
+	}
+	mBucketStart[numberOfBuckets] = total;
+	return total;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+tbCore::uint32 LudumDare56::GameState::SpatialHashGrid::ComputeBucket(const tbCore::int32 cellX, const tbCore::int32 cellZ) const
+{
+	const tbCore::uint32 hash = (static_cast<tbCore::uint32>(cellX) * 73856093u) ^ (static_cast<tbCore::uint32>(cellZ) * 19349663u);
+	return hash & mBucketMask;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+tbCore::int32 LudumDare56::GameState::SpatialHashGrid::ComputeCell(const iceScalar value) const
+{
+	return static_cast<tbCore::int32>(std::floor(value * mInverseCellSize));
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+size_t LudumDare56::GameState::SpatialHashGrid::GatherNearbyBuckets(const iceVector3& position,
+	std::array<tbCore::uint32, 9>& buckets) const
+{
+	if (mSortedEntries.empty())
+	{
+		return 0;
+	}
+
+	const tbCore::int32 cellX = ComputeCell(position.x);
+	const tbCore::int32 cellZ = ComputeCell(position.z);
+
+	size_t numberOfBuckets = 0;
+	for (tbCore::int32 offsetZ = -1; offsetZ <= 1; ++offsetZ)
+	{
+		for (tbCore::int32 offsetX = -1; offsetX <= 1; ++offsetX)
+		{
+			const tbCore::uint32 bucket = ComputeBucket(cellX + offsetX, cellZ + offsetZ);
+			if (buckets.begin() + numberOfBuckets == std::find(buckets.begin(), buckets.begin() + numberOfBuckets, bucket))
+			{
+				buckets[numberOfBuckets] = bucket;
+				++numberOfBuckets;
+			}
+		}
+	}
+
+	return numberOfBuckets;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
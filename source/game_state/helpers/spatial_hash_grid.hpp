@@ -0,0 +1,133 @@
+///
+/// @file
+/// @details A uniform hash grid on the ground plane for quickly finding nearby swarm creatures.
+///
+/// <!-- Copyright (c) 2024 Tyre Bytes LLC - All Rights Reserved -->
+///------------------------------------------------------------------------------------------------------------------///
+
+#ifndef LudumDare56_SpatialHashGrid_hpp
+#define LudumDare56_SpatialHashGrid_hpp
+
+#include "../../ludumdare56.hpp"
+
+#include <turtle_brains/core/tb_types.hpp>
+
+#include <array>
+#include <vector>
+
+namespace LudumDare56::GameState
+{
+
+	///
+	/// @details Buckets entries by the x/z cell they are in so a neighbor query only needs to look at the 3x3 cells
+	///   surrounding a position rather than every entry. Any query range must be less than or equal to the cell size
+	///   or neighbors will be missed. The y axis is ignored for bucketing since the swarm is mostly flat.
+	///
+	/// @note Rebuild() does not allocate once the grid has grown to hold the largest number of entries it has seen.
+	///
+	class SpatialHashGrid
+	{
+	public:
+		typedef tbCore::uint32 EntryIndex;
+
+		SpatialHashGrid(void);
+		~SpatialHashGrid(void);
+
+		///
+		/// @details Clears the grid and re-inserts every entry for which includeEntry(entryIndex, position) returns
+		///   true, filling in the position of that entry.
+		///
+		template<typename IncludeFunction> void Rebuild(const iceScalar cellSize, const size_t numberOfEntries,
+			IncludeFunction includeEntry)
+		{
+			BeginRebuild(cellSize, numberOfEntries, numberOfEntries, true);
+
+			iceVector3 position = iceVector3::Zero();
+			for (EntryIndex entryIndex = 0; entryIndex < numberOfEntries; ++entryIndex)
+			{
+				if (true == includeEntry(entryIndex, position))
+				{
+					AddEntry(entryIndex, position);
+				}
+			}
+
+			FinishRebuild();
+		}
+
+		///
+		/// @details Clears the grid and inserts only the includedEntries, which must be in increasing order and less than
+		///   numberOfEntries, calling entryPosition(entryIndex, position) to fill in the position of each. The cost of
+		///   this follows the number of included entries rather than numberOfEntries.
+		///
+		template<typename PositionFunction> void Rebuild(const iceScalar cellSize, const size_t numberOfEntries,
+			const tbCore::uint16* includedEntries, const size_t numberOfIncludedEntries, PositionFunction entryPosition)
+		{
+			BeginRebuild(cellSize, numberOfEntries, numberOfIncludedEntries, false);
+
+			iceVector3 position = iceVector3::Zero();
+			for (size_t includedIndex = 0; includedIndex < numberOfIncludedEntries; ++includedIndex)
+			{
+				const EntryIndex entryIndex = includedEntries[includedIndex];
+				entryPosition(entryIndex, position);
+				AddEntry(entryIndex, position);
+			}
+
+			FinishRebuild(includedEntries, numberOfIncludedEntries);
+		}
+
+		///
+		/// @details Calls visitor(entryIndex) for every entry inside the 3x3 cells around position. Entries farther
+		///   than the cell size may be visited, so the visitor is still expected to perform its own distance checks.
+		///
+		template<typename VisitorFunction> void ForEachNearby(const iceVector3& position, VisitorFunction visitor) const
+		{
+			std::array<tbCore::uint32, 9> buckets;
+			const size_t numberOfBuckets = GatherNearbyBuckets(position, buckets);
+
+			for (size_t index = 0; index < numberOfBuckets; ++index)
+			{
+				const tbCore::uint32 bucket = buckets[index];
+				for (tbCore::uint32 entry = mBucketStart[bucket]; entry < mBucketStart[bucket + 1]; ++entry)
+				{
+					visitor(mSortedEntries[entry]);
+				}
+			}
+		}
+
+		inline iceScalar GetCellSize(void) const { return mCellSize; }
+
+	private:
+		///
+		/// @details Prepares buckets for numberOfBucketedEntries. Clearing the entries is only needed when FinishRebuild()
+		///   will walk every entry, otherwise only the included entries are ever written and read.
+		///
+		void BeginRebuild(const iceScalar cellSize, const size_t numberOfEntries, const size_t numberOfBucketedEntries,
+			const bool clearEntries);
+		void AddEntry(const EntryIndex entryIndex, const iceVector3& position);
+		void FinishRebuild(void);
+		void FinishRebuild(const tbCore::uint16* includedEntries, const size_t numberOfIncludedEntries);
+		tbCore::uint32 FinishBucketCounts(void);
+
+		tbCore::uint32 ComputeBucket(const tbCore::int32 cellX, const tbCore::int32 cellZ) const;
+		tbCore::int32 ComputeCell(const iceScalar value) const;
+
+		///
+		/// @details Fills buckets with each unique bucket touched by the 3x3 cells around position so an entry is never
+		///   visited twice, even when two cells hash into the same bucket. Returns the number of unique buckets.
+		///
+		size_t GatherNearbyBuckets(const iceVector3& position, std::array<tbCore::uint32, 9>& buckets) const;
+
+		static constexpr tbCore::uint32 kExcludedEntry = ~tbCore::uint32(0);
+
+		std::vector<tbCore::uint32> mBucketStart;   //One per bucket plus one, first entry of each bucket in mSortedEntries.
+		std::vector<tbCore::uint32> mEntryBucket;   //Bucket for each entry, or kExcludedEntry.
+		std::vector<EntryIndex> mSortedEntries;     //Entry indices sorted by bucket.
+		iceScalar mCellSize;
+		iceScalar mInverseCellSize;
+		tbCore::uint32 mBucketMask;
+		tbCore::uint32 mNumberOfEntries;
+	};
+
+};	//namespace LudumDare56::GameState
+
+#endif /* LudumDare56_SpatialHashGrid_hpp */
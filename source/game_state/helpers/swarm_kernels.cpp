@@ -0,0 +1,725 @@
+///
+/// @file
+/// @details Steering and integration kernels for the creature swarm, with SIMD paths chosen at runtime and the scalar
+///   path kept as the reference implementation.
+///
+/// <!-- Copyright (c) 2024 Tyre Bytes LLC - All Rights Reserved -->
+///------------------------------------------------------------------------------------------------------------------///
+
+#include "../../game_state/helpers/swarm_kernels.hpp"
+
+#include "../../logging.hpp"
+
+#include <turtle_brains/core/unit_test/tb_unit_test.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <type_traits>
+
+#if defined(ludumdare56_with_swarm_sse2)
+  #include <emmintrin.h>
+  #if defined(_MSC_VER)
+    #include <intrin.h>
+    #include <immintrin.h>
+  #endif
+#endif
+
+namespace
+{
+	using namespace LudumDare56::GameState::SwarmKernels;
+	using LudumDare56::GameState::SpatialHashGrid;
+
+	//Far enough that padding neighbors never land within any of the swarm distances, but not so far that squaring the
+	//  distance would overflow.
+	const iceScalar kFarAwayNeighbor = 1.0e12;
+
+#if defined(ludumdare56_with_swarm_sse2)
+	bool DetectAVX2(void)
+	{
+		if (false == Implementation::IsBuiltWithAVX2())
+		{
+			return false;
+		}
+
+  #if defined(_MSC_VER)
+		int information[4] = { 0, 0, 0, 0 };
+		__cpuid(information, 0);
+		if (information[0] < 7)
+		{
+			return false;
+		}
+
+		__cpuid(information, 1);
+		const bool hasOperatingSystemSave = (0 != (information[2] & (1 << 27)));
+		const bool hasAVX = (0 != (information[2] & (1 << 28)));
+		if (false == hasOperatingSystemSave || false == hasAVX || 0x6 != (_xgetbv(0) & 0x6))
+		{	//The operating system must also be saving the ymm registers.
+			return false;
+		}
+
+		__cpuidex(information, 7, 0);
+		return (0 != (information[1] & (1 << 5)));
+  #else
+		__builtin_cpu_init();
+		return (0 != __builtin_cpu_supports("avx2"));
+  #endif
+	}
+#endif /* ludumdare56_with_swarm_sse2 */
+
+	InstructionSet BestInstructionSet(void)
+	{
+		if (true == IsSupported(InstructionSet::AVX2))
+		{
+			return InstructionSet::AVX2;
+		}
+		if (true == IsSupported(InstructionSet::SSE2))
+		{
+			return InstructionSet::SSE2;
+		}
+		return InstructionSet::Scalar;
+	}
+
+	InstructionSet& TheInstructionSet(void)
+	{
+		static InstructionSet theInstructionSet = BestInstructionSet();
+		return theInstructionSet;
+	}
+
+	bool theSwarmIsDeterministic = false;
+
+	//----------------------------------------------------------------------------------------------------------------//
+
+	void ComputeSteeringScalar(const SwarmData& swarm, const SpatialHashGrid& grid, const SwarmTuning& tuning,
+		SwarmScratch& scratch)
+	{
+		for (size_t activeIndex = 0; activeIndex < swarm.mNumberOfActiveCreatures; ++activeIndex)
+		{
+			const size_t creatureIndex = swarm.mActiveCreatures[activeIndex];
+			if (kMoveSteering != scratch.mMoveMode[creatureIndex])
+			{
+				continue;
+			}
+
+			const iceVector3 position(swarm.mPositionX[creatureIndex], swarm.mPositionY[creatureIndex], swarm.mPositionZ[creatureIndex]);
+
+			iceVector3 directionToTarget = iceVector3::Zero();
+			const bool isNearTarget = Implementation::IsNearTarget(tuning, position, directionToTarget);
+			const iceScalar visibleDistance = (true == isNearTarget) ? tuning.mNearVisibleDistance : tuning.mVisibleDistance;
+			const iceScalar bubbleDistance = (true == isNearTarget) ? tuning.mNearBubbleDistance : tuning.mBubbleDistance;
+
+			Implementation::SteeringSums sums;
+			sums.mSeparation = iceVector3::Zero();
+			sums.mPositionSum = iceVector3::Zero();
+			sums.mVelocitySum = iceVector3::Zero();
+			sums.mVisibleCount = 0.0;
+
+			grid.ForEachNearby(position, [&](const SpatialHashGrid::EntryIndex otherIndex) {
+				if (otherIndex == creatureIndex)
+				{	//Don't look at ourself!
+					return;
+				}
+
+				const iceVector3 otherPosition(swarm.mPositionX[otherIndex], swarm.mPositionY[otherIndex], swarm.mPositionZ[otherIndex]);
+
+				iceScalar distance = 0.0;
+				const iceVector3 separationDirection = iceVector3::Normalize(position - otherPosition, distance);
+
+				if (distance < visibleDistance)	//used as 'visual range' in https://vanhunteradams.com/Pico/Animal_Movement/Boids-algorithm.html
+				{
+					sums.mPositionSum += otherPosition;
+					sums.mVelocitySum += iceVector3(swarm.mVelocityX[otherIndex], swarm.mVelocityY[otherIndex], swarm.mVelocityZ[otherIndex]);
+					sums.mVisibleCount += 1.0;
+				}
+
+				// The source article adds (position - otherPosition) for separation; but we actually need to invert it so
+				//   that we separate more strongly from the creatures that are closer than the creatures that are near the
+				//   separation 'border'.
+				if (distance < bubbleDistance)
+				{
+					sums.mSeparation += separationDirection * (bubbleDistance - distance);
+				}
+			});
+
+			Implementation::FinishSteering(swarm, tuning, creatureIndex, isNearTarget, directionToTarget, sums, scratch);
+		}
+	}
+
+	//----------------------------------------------------------------------------------------------------------------//
+
+#if defined(ludumdare56_with_swarm_sse2)
+	static_assert(std::is_same<iceScalar, double>::value, "The SIMD swarm kernels expect icePhysics::Scalar to be a double.");
+
+	inline __m128d Select(const __m128d mask, const __m128d ifTrue, const __m128d ifFalse)
+	{
+		return _mm_or_pd(_mm_and_pd(mask, ifTrue), _mm_andnot_pd(mask, ifFalse));
+	}
+
+	inline iceScalar HorizontalSum(const __m128d value)
+	{
+		return _mm_cvtsd_f64(_mm_add_sd(value, _mm_unpackhi_pd(value, value)));
+	}
+
+	inline __m128d MoveModeMask(const tbCore::uint8* moveMode, const size_t index, const bool isSteeringOnly)
+	{
+		const bool first = (true == isSteeringOnly) ? (kMoveSteering == moveMode[index]) : (kDoNotMove != moveMode[index]);
+		const bool second = (true == isSteeringOnly) ? (kMoveSteering == moveMode[index + 1]) : (kDoNotMove != moveMode[index + 1]);
+		return _mm_castsi128_pd(_mm_set_epi64x((true == second) ? -1 : 0, (true == first) ? -1 : 0));
+	}
+
+	void ComputeSteeringSSE2(const SwarmData& swarm, const SpatialHashGrid& grid, const SwarmTuning& tuning,
+		SwarmScratch& scratch)
+	{
+		const __m128d zero = _mm_setzero_pd();
+		const __m128d one = _mm_set1_pd(1.0);
+
+		for (size_t activeIndex = 0; activeIndex < swarm.mNumberOfActiveCreatures; ++activeIndex)
+		{
+			const size_t creatureIndex = swarm.mActiveCreatures[activeIndex];
+			if (kMoveSteering != scratch.mMoveMode[creatureIndex])
+			{
+				continue;
+			}
+
+			const iceVector3 position(swarm.mPositionX[creatureIndex], swarm.mPositionY[creatureIndex], swarm.mPositionZ[creatureIndex]);
+
+			iceVector3 directionToTarget = iceVector3::Zero();
+			const bool isNearTarget = Implementation::IsNearTarget(tuning, position, directionToTarget);
+			const __m128d visibleDistance = _mm_set1_pd((true == isNearTarget) ? tuning.mNearVisibleDistance : tuning.mVisibleDistance);
+			const __m128d bubbleDistance = _mm_set1_pd((true == isNearTarget) ? tuning.mNearBubbleDistance : tuning.mBubbleDistance);
+
+			const size_t numberOfNeighbors = Implementation::GatherNeighbors(swarm, grid, creatureIndex, scratch, 2);
+
+			const __m128d positionX = _mm_set1_pd(position.x);
+			const __m128d positionY = _mm_set1_pd(position.y);
+			const __m128d positionZ = _mm_set1_pd(position.z);
+
+			__m128d separationX = zero, separationY = zero, separationZ = zero;
+			__m128d positionSumX = zero, positionSumY = zero, positionSumZ = zero;
+			__m128d velocitySumX = zero, velocitySumY = zero, velocitySumZ = zero;
+			__m128d visibleCount = zero;
+
+			for (size_t neighbor = 0; neighbor < numberOfNeighbors; neighbor += 2)
+			{
+				const __m128d otherX = _mm_loadu_pd(&scratch.mNeighborPositionX[neighbor]);
+				const __m128d otherY = _mm_loadu_pd(&scratch.mNeighborPositionY[neighbor]);
+				const __m128d otherZ = _mm_loadu_pd(&scratch.mNeighborPositionZ[neighbor]);
+
+				const __m128d deltaX = _mm_sub_pd(positionX, otherX);
+				const __m128d deltaY = _mm_sub_pd(positionY, otherY);
+				const __m128d deltaZ = _mm_sub_pd(positionZ, otherZ);
+				const __m128d distance = _mm_sqrt_pd(_mm_add_pd(_mm_add_pd(_mm_mul_pd(deltaX, deltaX),
+					_mm_mul_pd(deltaY, deltaY)), _mm_mul_pd(deltaZ, deltaZ)));
+
+				const __m128d isVisible = _mm_cmplt_pd(distance, visibleDistance);
+				positionSumX = _mm_add_pd(positionSumX, _mm_and_pd(isVisible, otherX));
+				positionSumY = _mm_add_pd(positionSumY, _mm_and_pd(isVisible, otherY));
+				positionSumZ = _mm_add_pd(positionSumZ, _mm_and_pd(isVisible, otherZ));
+				velocitySumX = _mm_add_pd(velocitySumX, _mm_and_pd(isVisible, _mm_loadu_pd(&scratch.mNeighborVelocityX[neighbor])));
+				velocitySumY = _mm_add_pd(velocitySumY, _mm_and_pd(isVisible, _mm_loadu_pd(&scratch.mNeighborVelocityY[neighbor])));
+				velocitySumZ = _mm_add_pd(velocitySumZ, _mm_and_pd(isVisible, _mm_loadu_pd(&scratch.mNeighborVelocityZ[neighbor])));
+				visibleCount = _mm_add_pd(visibleCount, _mm_and_pd(isVisible, one));
+
+				//Creatures sitting exactly on top of each other have no direction to separate, same as Normalize().
+				const __m128d isSeparating = _mm_and_pd(_mm_cmplt_pd(distance, bubbleDistance), _mm_cmpgt_pd(distance, zero));
+				const __m128d separationScale = _mm_and_pd(isSeparating, _mm_div_pd(_mm_sub_pd(bubbleDistance, distance), distance));
+				separationX = _mm_add_pd(separationX, _mm_mul_pd(deltaX, separationScale));
+				separationY = _mm_add_pd(separationY, _mm_mul_pd(deltaY, separationScale));
+				separationZ = _mm_add_pd(separationZ, _mm_mul_pd(deltaZ, separationScale));
+			}
+
+			Implementation::SteeringSums sums;
+			sums.mSeparation = iceVector3(HorizontalSum(separationX), HorizontalSum(separationY), HorizontalSum(separationZ));
+			sums.mPositionSum = iceVector3(HorizontalSum(positionSumX), HorizontalSum(positionSumY), HorizontalSum(positionSumZ));
+			sums.mVelocitySum = iceVector3(HorizontalSum(velocitySumX), HorizontalSum(velocitySumY), HorizontalSum(velocitySumZ));
+			sums.mVisibleCount = HorizontalSum(visibleCount);
+
+			Implementation::FinishSteering(swarm, tuning, creatureIndex, isNearTarget, directionToTarget, sums, scratch);
+		}
+	}
+
+	void IntegrateSwarmSSE2(SwarmData& swarm, const SwarmTuning& tuning, const SwarmScratch& scratch)
+	{
+		const __m128d fixedTime = _mm_set1_pd(tuning.mFixedTime);
+		const __m128d velocityDrag = _mm_set1_pd(tuning.mVelocityDrag);
+		const __m128d maximumVelocity = _mm_set1_pd(tuning.mMaximumVelocity);
+
+		size_t activeIndex = 0;
+		while (activeIndex < swarm.mNumberOfActiveCreatures)
+		{
+			const size_t creatureIndex = swarm.mActiveCreatures[activeIndex];
+			if (false == Implementation::IsContiguousRun(swarm, activeIndex, 2))
+			{	//Creatures next to a gap in the active list, or at the end of it, are moved one at a time.
+				Implementation::IntegrateCreature(swarm, tuning, scratch, creatureIndex);
+				++activeIndex;
+				continue;
+			}
+
+			activeIndex += 2;
+
+			const __m128d isSteering = MoveModeMask(scratch.mMoveMode.data(), creatureIndex, true);
+			const __m128d isMoving = MoveModeMask(scratch.mMoveMode.data(), creatureIndex, false);
+
+			const __m128d velocityX = _mm_loadu_pd(&swarm.mVelocityX[creatureIndex]);
+			const __m128d velocityY = _mm_loadu_pd(&swarm.mVelocityY[creatureIndex]);
+			const __m128d velocityZ = _mm_loadu_pd(&swarm.mVelocityZ[creatureIndex]);
+
+			const __m128d draggedX = _mm_sub_pd(velocityX, _mm_mul_pd(_mm_mul_pd(velocityX, velocityDrag), fixedTime));
+			const __m128d draggedY = _mm_sub_pd(velocityY, _mm_mul_pd(_mm_mul_pd(velocityY, velocityDrag), fixedTime));
+			const __m128d draggedZ = _mm_sub_pd(velocityZ, _mm_mul_pd(_mm_mul_pd(velocityZ, velocityDrag), fixedTime));
+
+			__m128d flatX = _mm_add_pd(draggedX, _mm_mul_pd(_mm_loadu_pd(&scratch.mSteeringX[creatureIndex]), fixedTime));
+			__m128d flatZ = _mm_add_pd(draggedZ, _mm_mul_pd(_mm_loadu_pd(&scratch.mSteeringZ[creatureIndex]), fixedTime));
+
+			const __m128d speed = _mm_sqrt_pd(_mm_add_pd(_mm_mul_pd(flatX, flatX), _mm_mul_pd(flatZ, flatZ)));
+			const __m128d isTooFast = _mm_cmpgt_pd(speed, maximumVelocity);
+			flatX = Select(isTooFast, _mm_mul_pd(_mm_div_pd(flatX, speed), maximumVelocity), flatX);
+			flatZ = Select(isTooFast, _mm_mul_pd(_mm_div_pd(flatZ, speed), maximumVelocity), flatZ);
+
+			const __m128d finalX = Select(isSteering, flatX, velocityX);
+			const __m128d finalY = Select(isSteering, draggedY, velocityY);
+			const __m128d finalZ = Select(isSteering, flatZ, velocityZ);
+
+			const __m128d positionX = _mm_loadu_pd(&swarm.mPositionX[creatureIndex]);
+			const __m128d positionY = _mm_loadu_pd(&swarm.mPositionY[creatureIndex]);
+			const __m128d positionZ = _mm_loadu_pd(&swarm.mPositionZ[creatureIndex]);
+
+			_mm_storeu_pd(&swarm.mPositionX[creatureIndex], Select(isMoving, _mm_add_pd(positionX, _mm_mul_pd(finalX, fixedTime)), positionX));
+			_mm_storeu_pd(&swarm.mPositionY[creatureIndex], Select(isMoving, _mm_add_pd(positionY, _mm_mul_pd(finalY, fixedTime)), positionY));
+			_mm_storeu_pd(&swarm.mPositionZ[creatureIndex], Select(isMoving, _mm_add_pd(positionZ, _mm_mul_pd(finalZ, fixedTime)), positionZ));
+			_mm_storeu_pd(&swarm.mVelocityX[creatureIndex], finalX);
+			_mm_storeu_pd(&swarm.mVelocityY[creatureIndex], finalY);
+			_mm_storeu_pd(&swarm.mVelocityZ[creatureIndex], finalZ);
+		}
+	}
+#endif /* ludumdare56_with_swarm_sse2 */
+
+};	//namespace
+
+//--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
+
+bool LudumDare56::GameState::SwarmKernels::IsSupported(const InstructionSet instructionSet)
+{
+	switch (instructionSet)
+	{
+	case InstructionSet::Scalar: return true;
+#if defined(ludumdare56_with_swarm_sse2)
+	case InstructionSet::SSE2: return true;
+	case InstructionSet::AVX2: {
+		static const bool theAVX2Support = DetectAVX2();
+		return theAVX2Support;
+	}
+#else
+	case InstructionSet::SSE2: return false;
+	case InstructionSet::AVX2: return false;
+#endif /* ludumdare56_with_swarm_sse2 */
+	};
+
+	return false;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+LudumDare56::GameState::SwarmKernels::InstructionSet LudumDare56::GameState::SwarmKernels::GetInstructionSet(void)
+{
+	return (true == theSwarmIsDeterministic) ? InstructionSet::Scalar : TheInstructionSet();
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void LudumDare56::GameState::SwarmKernels::SetInstructionSet(const InstructionSet instructionSet)
+{
+	tb_error_if(false == IsSupported(instructionSet), "The swarm kernels do not support the %s instruction set here.", ToString(instructionSet));
+	TheInstructionSet() = instructionSet;
+	tb_always_log(LogGame::Info() << "Swarm kernels are using the " << ToString(instructionSet) << " instruction set.");
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void LudumDare56::GameState::SwarmKernels::SetDeterministic(const bool isDeterministic)
+{
+	theSwarmIsDeterministic = isDeterministic;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+bool LudumDare56::GameState::SwarmKernels::IsDeterministic(void)
+{
+	return theSwarmIsDeterministic;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+const char* LudumDare56::GameState::SwarmKernels::ToString(const InstructionSet instructionSet)
+{
+	switch (instructionSet)
+	{
+	case InstructionSet::Scalar: return "Scalar";
+	case InstructionSet::SSE2: return "SSE2";
+	case InstructionSet::AVX2: return "AVX2";
+	};
+
+	return "Unknown";
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void LudumDare56::GameState::SwarmKernels::SwarmScratch::Resize(const size_t numberOfCreatures)
+{
+	//The neighbor arrays get a little extra room for padding out to the widest instruction set.
+	const size_t numberOfNeighbors = numberOfCreatures + 8;
+
+	mMoveMode.resize(numberOfCreatures, kDoNotMove);
+	mSteeringX.resize(numberOfCreatures, 0.0);
+	mSteeringZ.resize(numberOfCreatures, 0.0);
+	mNeighborPositionX.resize(numberOfNeighbors, 0.0);
+	mNeighborPositionY.resize(numberOfNeighbors, 0.0);
+	mNeighborPositionZ.resize(numberOfNeighbors, 0.0);
+	mNeighborVelocityX.resize(numberOfNeighbors, 0.0);
+	mNeighborVelocityY.resize(numberOfNeighbors, 0.0);
+	mNeighborVelocityZ.resize(numberOfNeighbors, 0.0);
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void LudumDare56::GameState::SwarmKernels::ComputeSteering(const SwarmData& swarm, const SpatialHashGrid& grid,
+	const SwarmTuning& tuning, SwarmScratch& scratch, const InstructionSet instructionSet)
+{
+	tb_error_if(scratch.mMoveMode.size() < swarm.mNumberOfCreatures, "Expected the SwarmScratch to be resized to hold the swarm.");
+	tb_error_if(swarm.mNumberOfActiveCreatures > swarm.mNumberOfCreatures, "Expected the active creatures to be part of the swarm.");
+
+	switch (instructionSet)
+	{
+	case InstructionSet::AVX2:
+		Implementation::ComputeSteeringAVX2(swarm, grid, tuning, scratch);
+		break;
+#if defined(ludumdare56_with_swarm_sse2)
+	case InstructionSet::SSE2:
+		ComputeSteeringSSE2(swarm, grid, tuning, scratch);
+		break;
+#endif /* ludumdare56_with_swarm_sse2 */
+	default:
+		ComputeSteeringScalar(swarm, grid, tuning, scratch);
+		break;
+	};
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void LudumDare56::GameState::SwarmKernels::IntegrateSwarm(SwarmData& swarm, const SwarmTuning& tuning,
+	const SwarmScratch& scratch, const InstructionSet instructionSet)
+{
+	tb_error_if(scratch.mMoveMode.size() < swarm.mNumberOfCreatures, "Expected the SwarmScratch to be resized to hold the swarm.");
+	tb_error_if(swarm.mNumberOfActiveCreatures > swarm.mNumberOfCreatures, "Expected the active creatures to be part of the swarm.");
+
+	switch (instructionSet)
+	{
+	case InstructionSet::AVX2:
+		Implementation::IntegrateSwarmAVX2(swarm, tuning, scratch);
+		break;
+#if defined(ludumdare56_with_swarm_sse2)
+	case InstructionSet::SSE2:
+		IntegrateSwarmSSE2(swarm, tuning, scratch);
+		break;
+#endif /* ludumdare56_with_swarm_sse2 */
+	default:
+		for (size_t activeIndex = 0; activeIndex < swarm.mNumberOfActiveCreatures; ++activeIndex)
+		{
+			Implementation::IntegrateCreature(swarm, tuning, scratch, swarm.mActiveCreatures[activeIndex]);
+		}
+		break;
+	};
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
+
+size_t LudumDare56::GameState::SwarmKernels::Implementation::GatherNeighbors(const SwarmData& swarm,
+	const SpatialHashGrid& grid, const size_t creatureIndex, SwarmScratch& scratch, const size_t padToMultiple)
+{
+	const iceVector3 position(swarm.mPositionX[creatureIndex], swarm.mPositionY[creatureIndex], swarm.mPositionZ[creatureIndex]);
+
+	size_t numberOfNeighbors = 0;
+	grid.ForEachNearby(position, [&](const SpatialHashGrid::EntryIndex otherIndex) {
+		if (otherIndex == creatureIndex)
+		{	//Don't look at ourself!
+			return;
+		}
+
+		scratch.mNeighborPositionX[numberOfNeighbors] = swarm.mPositionX[otherIndex];
+		scratch.mNeighborPositionY[numberOfNeighbors] = swarm.mPositionY[otherIndex];
+		scratch.mNeighborPositionZ[numberOfNeighbors] = swarm.mPositionZ[otherIndex];
+		scratch.mNeighborVelocityX[numberOfNeighbors] = swarm.mVelocityX[otherIndex];
+		scratch.mNeighborVelocityY[numberOfNeighbors] = swarm.mVelocityY[otherIndex];
+		scratch.mNeighborVelocityZ[numberOfNeighbors] = swarm.mVelocityZ[otherIndex];
+		++numberOfNeighbors;
+	});
+
+	const size_t paddedNeighbors = ((numberOfNeighbors + padToMultiple - 1) / padToMultiple) * padToMultiple;
+	for (size_t neighbor = numberOfNeighbors; neighbor < paddedNeighbors; ++neighbor)
+	{
+		scratch.mNeighborPositionX[neighbor] = position.x + kFarAwayNeighbor;
+		scratch.mNeighborPositionY[neighbor] = position.y;
+		scratch.mNeighborPositionZ[neighbor] = position.z;
+		scratch.mNeighborVelocityX[neighbor] = 0.0;
+		scratch.mNeighborVelocityY[neighbor] = 0.0;
+		scratch.mNeighborVelocityZ[neighbor] = 0.0;
+	}
+
+	return paddedNeighbors;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+bool LudumDare56::GameState::SwarmKernels::Implementation::IsNearTarget(const SwarmTuning& tuning,
+	const iceVector3& position, iceVector3& directionToTarget)
+{
+	iceScalar distanceToTarget = 0.0;
+	directionToTarget = iceVector3::Normalize(tuning.mTargetPosition - position, distanceToTarget);
+	return (distanceToTarget < tuning.mTargetRange && tuning.mTargetSpeed < tuning.mTargetSpeedThreshold);
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void LudumDare56::GameState::SwarmKernels::Implementation::FinishSteering(const SwarmData& swarm, const SwarmTuning& tuning,
+	const size_t creatureIndex, const bool isNearTarget, const iceVector3& directionToTarget, const SteeringSums& sums,
+	SwarmScratch& scratch)
+{
+	iceVector3 alignment = iceVector3::Zero();
+	iceVector3 cohesion = iceVector3::Zero();
+	if (sums.mVisibleCount > 0.0)
+	{
+		const iceVector3 position(swarm.mPositionX[creatureIndex], swarm.mPositionY[creatureIndex], swarm.mPositionZ[creatureIndex]);
+		const iceVector3 velocity(swarm.mVelocityX[creatureIndex], swarm.mVelocityY[creatureIndex], swarm.mVelocityZ[creatureIndex]);
+
+		alignment = (sums.mVelocitySum / sums.mVisibleCount) - velocity;
+		cohesion = (sums.mPositionSum / sums.mVisibleCount) - position;
+	}
+
+	const iceScalar avoidFactor = (true == isNearTarget) ? tuning.mNearAvoidFactor : tuning.mAvoidFactor;
+	const iceScalar centerFactor = (true == isNearTarget) ? tuning.mNearCenteringFactor : tuning.mCenteringFactor;
+	const iceScalar matchFactor = (true == isNearTarget) ? tuning.mNearMatchingFactor : tuning.mMatchingFactor;
+	const iceScalar targetFactor = (true == isNearTarget) ? tuning.mNearTargetFactor : tuning.mTargetFactor;
+
+	const iceVector3 steering = (cohesion * centerFactor) + (sums.mSeparation * avoidFactor) + (alignment * matchFactor) +
+		directionToTarget * targetFactor;
+
+	//Any Y from the swarm behavior is ignored.
+	scratch.mSteeringX[creatureIndex] = steering.x;
+	scratch.mSteeringZ[creatureIndex] = steering.z;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void LudumDare56::GameState::SwarmKernels::Implementation::IntegrateCreature(SwarmData& swarm, const SwarmTuning& tuning,
+	const SwarmScratch& scratch, const size_t creatureIndex)
+{
+	const tbCore::uint8 moveMode = scratch.mMoveMode[creatureIndex];
+	if (kDoNotMove == moveMode)
+	{
+		return;
+	}
+
+	iceVector3 position(swarm.mPositionX[creatureIndex], swarm.mPositionY[creatureIndex], swarm.mPositionZ[creatureIndex]);
+	iceVector3 velocity(swarm.mVelocityX[creatureIndex], swarm.mVelocityY[creatureIndex], swarm.mVelocityZ[creatureIndex]);
+
+	if (kMoveSteering == moveMode)
+	{
+		velocity -= velocity * tuning.mVelocityDrag * tuning.mFixedTime;
+
+		iceVector3 flatVelocity = velocity;
+		flatVelocity += iceVector3(scratch.mSteeringX[creatureIndex], 0.0, scratch.mSteeringZ[creatureIndex]) * tuning.mFixedTime;
+		flatVelocity.y = 0.0;
+
+		const iceScalar speed = flatVelocity.Magnitude();
+		if (speed > tuning.mMaximumVelocity)
+		{
+			flatVelocity = flatVelocity.GetNormalized() * tuning.mMaximumVelocity;
+		}
+
+		velocity.x = flatVelocity.x;
+		velocity.z = flatVelocity.z;
+	}
+
+	position += velocity * tuning.mFixedTime;
+
+	swarm.mPositionX[creatureIndex] = position.x;
+	swarm.mPositionY[creatureIndex] = position.y;
+	swarm.mPositionZ[creatureIndex] = position.z;
+	swarm.mVelocityX[creatureIndex] = velocity.x;
+	swarm.mVelocityY[creatureIndex] = velocity.y;
+	swarm.mVelocityZ[creatureIndex] = velocity.z;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
+
+class SwarmKernelsTest : tbCore::UnitTest::TestCaseInterface
+{
+public:
+	SwarmKernelsTest(void) :
+		tbCore::UnitTest::TestCaseInterface("SwarmKernelsTest")
+	{
+	}
+
+	~SwarmKernelsTest(void)
+	{
+	}
+
+protected:
+	virtual bool OnRunTest(void) override
+	{
+		using namespace LudumDare56::GameState;
+
+		const std::array<SwarmKernels::InstructionSet, 2> simdInstructionSets = {
+			SwarmKernels::InstructionSet::SSE2, SwarmKernels::InstructionSet::AVX2
+		};
+
+		for (const SwarmKernels::InstructionSet instructionSet : simdInstructionSets)
+		{
+			if (false == SwarmKernels::IsSupported(instructionSet))
+			{
+				tb_log("SwarmKernelsTest is skipping %s, it is not supported here.\n", SwarmKernels::ToString(instructionSet));
+				continue;
+			}
+
+			for (tbCore::uint32 seed = 0; seed < 8; ++seed)
+			{
+				//Odd sized swarms make sure the tail of each SIMD loop gets covered.
+				const size_t numberOfCreatures = 97 + seed * 61;
+				RunRandomSwarm(instructionSet, seed, numberOfCreatures);
+			}
+		}
+
+		const SwarmKernels::InstructionSet chosenInstructionSet = SwarmKernels::GetInstructionSet();
+		SwarmKernels::SetDeterministic(true);
+		ExpectedValue(SwarmKernels::InstructionSet::Scalar == SwarmKernels::GetInstructionSet(), true,
+			"Deterministic swarms are expected to always use the scalar kernels.");
+		SwarmKernels::SetDeterministic(false);
+		ExpectedValue(chosenInstructionSet == SwarmKernels::GetInstructionSet(), true,
+			"Leaving deterministic swarms is expected to return to the chosen instruction set.");
+
+		return true;
+	}
+
+private:
+	struct TestSwarm
+	{
+		std::vector<iceScalar> mPositionX, mPositionY, mPositionZ;
+		std::vector<iceScalar> mVelocityX, mVelocityY, mVelocityZ;
+		std::vector<tbCore::uint16> mActiveCreatures;
+
+		LudumDare56::GameState::SwarmKernels::SwarmData GetData(void)
+		{
+			return { mPositionX.data(), mPositionY.data(), mPositionZ.data(),
+				mVelocityX.data(), mVelocityY.data(), mVelocityZ.data(), mPositionX.size(),
+				mActiveCreatures.data(), mActiveCreatures.size() };
+		}
+	};
+
+	void RunRandomSwarm(const LudumDare56::GameState::SwarmKernels::InstructionSet instructionSet,
+		const tbCore::uint32 seed, const size_t numberOfCreatures)
+	{
+		using namespace LudumDare56::GameState;
+
+		std::mt19937 generator(seed);
+		std::uniform_real_distribution<iceScalar> spread(-6.0, 6.0);
+		std::uniform_real_distribution<iceScalar> height(-0.1, 0.1);
+		std::uniform_real_distribution<iceScalar> speed(-20.0, 20.0);
+		std::uniform_int_distribution<int> moveMode(0, 9);
+
+		TestSwarm swarm;
+		SwarmKernels::SwarmScratch scratch;
+		scratch.Resize(numberOfCreatures);
+
+		for (size_t creatureIndex = 0; creatureIndex < numberOfCreatures; ++creatureIndex)
+		{
+			swarm.mPositionX.push_back(spread(generator));
+			swarm.mPositionY.push_back(height(generator));
+			swarm.mPositionZ.push_back(spread(generator));
+			swarm.mVelocityX.push_back(speed(generator));
+			swarm.mVelocityY.push_back(height(generator));
+			swarm.mVelocityZ.push_back(speed(generator));
+
+			const int mode = moveMode(generator);
+			scratch.mMoveMode[creatureIndex] = (0 == mode) ? SwarmKernels::kDoNotMove :
+				((1 == mode) ? SwarmKernels::kMoveBallistic : SwarmKernels::kMoveSteering);
+
+			//Leaves gaps in the active list, like dead creatures would, while some kDoNotMove creatures stay in it.
+			if (0 != mode || 0 == creatureIndex % 2)
+			{
+				swarm.mActiveCreatures.push_back(static_cast<tbCore::uint16>(creatureIndex));
+			}
+		}
+
+		//Not the game tuning; the target range and visible distance are large enough to cover both sides of each branch.
+		SwarmKernels::SwarmTuning tuning;
+		tuning.mTargetPosition = iceVector3(spread(generator), 0.0, spread(generator));
+		tuning.mTargetSpeed = (0 == seed % 2) ? 0.0 : 10.0;
+		tuning.mFixedTime = 0.01;
+		tuning.mTargetRange = 4.0;
+		tuning.mTargetSpeedThreshold = 0.5;
+		tuning.mVisibleDistance = 1.5;
+		tuning.mBubbleDistance = 1.664;
+		tuning.mAvoidFactor = 5.0;
+		tuning.mMatchingFactor = 1.449;
+		tuning.mCenteringFactor = 0.913;
+		tuning.mTargetFactor = 40.0;
+		tuning.mNearVisibleDistance = 1.0;
+		tuning.mNearBubbleDistance = 0.5;
+		tuning.mNearAvoidFactor = 2.0;
+		tuning.mNearMatchingFactor = 1.25;
+		tuning.mNearCenteringFactor = 0.913;
+		tuning.mNearTargetFactor = 0.25;
+		tuning.mVelocityDrag = 0.89;
+		tuning.mMaximumVelocity = 18.0; //Low enough that some creatures get clamped.
+
+		SpatialHashGrid grid;
+		TestSwarm scalarSwarm = swarm;
+		TestSwarm simdSwarm = swarm;
+		SwarmKernels::SwarmScratch scalarScratch = scratch;
+		SwarmKernels::SwarmScratch simdScratch = scratch;
+
+		SwarmKernels::SwarmData scalarData = scalarSwarm.GetData();
+		SwarmKernels::SwarmData simdData = simdSwarm.GetData();
+
+		grid.Rebuild(1.664, numberOfCreatures, [&swarm](const SpatialHashGrid::EntryIndex entryIndex, iceVector3& position) {
+			position = iceVector3(swarm.mPositionX[entryIndex], swarm.mPositionY[entryIndex], swarm.mPositionZ[entryIndex]);
+			return true;
+		});
+
+		SwarmKernels::ComputeSteering(scalarData, grid, tuning, scalarScratch, SwarmKernels::InstructionSet::Scalar);
+		SwarmKernels::IntegrateSwarm(scalarData, tuning, scalarScratch, SwarmKernels::InstructionSet::Scalar);
+		SwarmKernels::ComputeSteering(simdData, grid, tuning, simdScratch, instructionSet);
+		SwarmKernels::IntegrateSwarm(simdData, tuning, simdScratch, instructionSet);
+
+		for (size_t creatureIndex = 0; creatureIndex < numberOfCreatures; ++creatureIndex)
+		{
+			const std::array<iceScalar, 6> expected = {
+				scalarSwarm.mPositionX[creatureIndex], scalarSwarm.mPositionY[creatureIndex], scalarSwarm.mPositionZ[creatureIndex],
+				scalarSwarm.mVelocityX[creatureIndex], scalarSwarm.mVelocityY[creatureIndex], scalarSwarm.mVelocityZ[creatureIndex],
+			};
+			const std::array<iceScalar, 6> actual = {
+				simdSwarm.mPositionX[creatureIndex], simdSwarm.mPositionY[creatureIndex], simdSwarm.mPositionZ[creatureIndex],
+				simdSwarm.mVelocityX[creatureIndex], simdSwarm.mVelocityY[creatureIndex], simdSwarm.mVelocityZ[creatureIndex],
+			};
+
+			for (size_t component = 0; component < expected.size(); ++component)
+			{
+				const iceScalar tolerance = 1.0e-9 * std::max(iceScalar(1.0), std::abs(expected[component]));
+				ExpectedValue(std::abs(actual[component] - expected[component]) <= tolerance, true,
+					"%s swarm (seed %d) creature %d component %d was %f, expected %f from the scalar reference.",
+					SwarmKernels::ToString(instructionSet), seed, static_cast<int>(creatureIndex), static_cast<int>(component),
+					actual[component], expected[component]);
+			}
+		}
+	}
+};
+
+SwarmKernelsTest theSwarmKernelsTest;
+
+//--------------------------------------------------------------------------------------------------------------------//
@@ -0,0 +1,193 @@
+///
+/// @file
+/// @details Steering and integration kernels for the creature swarm, with SIMD paths chosen at runtime and the scalar
+///   path kept as the reference implementation.
+///
+/// <!-- Copyright (c) 2024 Tyre Bytes LLC - All Rights Reserved -->
+///------------------------------------------------------------------------------------------------------------------///
+
+#ifndef LudumDare56_SwarmKernels_hpp
+#define LudumDare56_SwarmKernels_hpp
+
+#include "../../ludumdare56.hpp"
+#include "../../game_state/helpers/spatial_hash_grid.hpp"
+
+#include <turtle_brains/core/tb_types.hpp>
+
+#include <vector>
+
+#if defined(_M_X64) || defined(__x86_64__) || defined(__SSE2__)
+  #define ludumdare56_with_swarm_sse2
+#endif
+
+namespace LudumDare56::GameState::SwarmKernels
+{
+
+	enum class InstructionSet : tbCore::uint8 { Scalar, SSE2, AVX2 };
+
+	///
+	/// @details Returns true if the kernels were built with, and the processor supports, the instruction set.
+	///
+	bool IsSupported(const InstructionSet instructionSet);
+
+	///
+	/// @details Returns the instruction set the kernels are currently using, which defaults to the best supported.
+	///
+	InstructionSet GetInstructionSet(void);
+
+	///
+	/// @details Forces the kernels to use a specific instruction set, mostly for testing/profiling against the scalar
+	///   reference. It is an error condition to choose an instruction set that is not supported.
+	///
+	void SetInstructionSet(const InstructionSet instructionSet);
+
+	///
+	/// @details While deterministic, GetInstructionSet() is always the scalar reference no matter what was chosen, so
+	///   every machine steps the swarm with the same operations in the same order and ends with the exact same bits.
+	///   The SIMD kernels sum neighbors in lanes, which changes the rounding compared to the scalar kernels.
+	///
+	void SetDeterministic(const bool isDeterministic);
+	bool IsDeterministic(void);
+
+	const char* ToString(const InstructionSet instructionSet);
+
+	///
+	/// @details How each creature should be moved during the integration kernel.
+	///
+	enum MoveMode : tbCore::uint8
+	{
+		kDoNotMove = 0,     //Dead, finished or otherwise not being simulated.
+		kMoveBallistic = 1, //Off the track, or not due for steering, keeps going with whatever velocity it has.
+		kMoveSteering = 2,  //On the track and following the swarm steering toward the target.
+	};
+
+	///
+	/// @details Everything the kernels need to know about the swarm behavior. The 'near' values replace the others when
+	///   a creature is within mTargetRange of a target moving slower than mTargetSpeedThreshold.
+	///
+	struct SwarmTuning
+	{
+		iceVector3 mTargetPosition;
+		iceScalar mTargetSpeed;
+		iceScalar mFixedTime;
+
+		iceScalar mTargetRange;
+		iceScalar mTargetSpeedThreshold;
+
+		iceScalar mVisibleDistance;
+		iceScalar mBubbleDistance;
+		iceScalar mAvoidFactor;
+		iceScalar mMatchingFactor;
+		iceScalar mCenteringFactor;
+		iceScalar mTargetFactor;
+
+		iceScalar mNearVisibleDistance;
+		iceScalar mNearBubbleDistance;
+		iceScalar mNearAvoidFactor;
+		iceScalar mNearMatchingFactor;
+		iceScalar mNearCenteringFactor;
+		iceScalar mNearTargetFactor;
+
+		iceScalar mVelocityDrag;
+		iceScalar mMaximumVelocity;
+	};
+
+	///
+	/// @details A non-owning view of the swarm arrays the kernels read from and write into. The kernels only visit the
+	///   creatures in mActiveCreatures, which must be sorted and hold each creature only once, so the cost follows the
+	///   number of creatures still in the race instead of the size of the swarm. Others are left as if kDoNotMove.
+	///
+	struct SwarmData
+	{
+		iceScalar* mPositionX;
+		iceScalar* mPositionY;
+		iceScalar* mPositionZ;
+		iceScalar* mVelocityX;
+		iceScalar* mVelocityY;
+		iceScalar* mVelocityZ;
+		size_t mNumberOfCreatures;
+
+		const tbCore::uint16* mActiveCreatures;
+		size_t mNumberOfActiveCreatures;
+	};
+
+	///
+	/// @details Working memory for the kernels, owned by the caller so the kernels never allocate once it has been
+	///   resized to hold the swarm. mMoveMode is filled in by the caller before running the kernels.
+	///
+	struct SwarmScratch
+	{
+		std::vector<tbCore::uint8> mMoveMode;
+		std::vector<iceScalar> mSteeringX;
+		std::vector<iceScalar> mSteeringZ;
+
+		std::vector<iceScalar> mNeighborPositionX;
+		std::vector<iceScalar> mNeighborPositionY;
+		std::vector<iceScalar> mNeighborPositionZ;
+		std::vector<iceScalar> mNeighborVelocityX;
+		std::vector<iceScalar> mNeighborVelocityY;
+		std::vector<iceScalar> mNeighborVelocityZ;
+
+		void Resize(const size_t numberOfCreatures);
+	};
+
+	///
+	/// @details Computes the flat steering acceleration from alignment, cohesion, separation and the pull toward the
+	///   target for each creature with kMoveSteering. The grid is expected to hold only the creatures that other
+	///   creatures should react to, and every creature reads the positions as they were before any creature moved.
+	///
+	void ComputeSteering(const SwarmData& swarm, const SpatialHashGrid& grid, const SwarmTuning& tuning,
+		SwarmScratch& scratch, const InstructionSet instructionSet = GetInstructionSet());
+
+	///
+	/// @details Applies drag and the steering acceleration to the velocity of each creature with kMoveSteering, clamps
+	///   the flat speed to the maximum and then moves all creatures that are not kDoNotMove.
+	///
+	void IntegrateSwarm(SwarmData& swarm, const SwarmTuning& tuning, const SwarmScratch& scratch,
+		const InstructionSet instructionSet = GetInstructionSet());
+
+	namespace Implementation
+	{
+		struct SteeringSums
+		{
+			iceVector3 mSeparation;
+			iceVector3 mPositionSum;
+			iceVector3 mVelocitySum;
+			iceScalar mVisibleCount;
+		};
+
+		///
+		/// @details Fills the neighbor arrays of the scratch with every creature near creatureIndex, except itself, and
+		///   pads them with far-away entries to a multiple of padToMultiple. Returns the padded number of neighbors.
+		///
+		size_t GatherNeighbors(const SwarmData& swarm, const SpatialHashGrid& grid, const size_t creatureIndex,
+			SwarmScratch& scratch, const size_t padToMultiple);
+
+		bool IsNearTarget(const SwarmTuning& tuning, const iceVector3& position, iceVector3& directionToTarget);
+
+		///
+		/// @details Turns the sums from the neighbors into the steering acceleration, shared by all instruction sets.
+		///
+		void FinishSteering(const SwarmData& swarm, const SwarmTuning& tuning, const size_t creatureIndex,
+			const bool isNearTarget, const iceVector3& directionToTarget, const SteeringSums& sums, SwarmScratch& scratch);
+
+		void IntegrateCreature(SwarmData& swarm, const SwarmTuning& tuning, const SwarmScratch& scratch, const size_t creatureIndex);
+
+		///
+		/// @details Returns true when the runLength active creatures starting at activeIndex are also next to each other
+		///   in the swarm arrays, so the SIMD kernels can load them together.
+		///
+		inline bool IsContiguousRun(const SwarmData& swarm, const size_t activeIndex, const size_t runLength)
+		{
+			return activeIndex + runLength <= swarm.mNumberOfActiveCreatures && swarm.mActiveCreatures[activeIndex] +
+				runLength - 1 == swarm.mActiveCreatures[activeIndex + runLength - 1];
+		}
+
+		void ComputeSteeringAVX2(const SwarmData& swarm, const SpatialHashGrid& grid, const SwarmTuning& tuning, SwarmScratch& scratch);
+		void IntegrateSwarmAVX2(SwarmData& swarm, const SwarmTuning& tuning, const SwarmScratch& scratch);
+		bool IsBuiltWithAVX2(void);
+	};
+
+};	//namespace LudumDare56::GameState::SwarmKernels
+
+#endif /* LudumDare56_SwarmKernels_hpp */
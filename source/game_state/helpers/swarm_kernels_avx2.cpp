@@ -0,0 +1,217 @@
+///
+/// @file
+/// @details The AVX2 paths of the swarm kernels, kept in their own file so only this file needs to be built with AVX2
+///   enabled; the rest of the game must still run on processors without it.
+///
+/// <!-- Copyright (c) 2024 Tyre Bytes LLC - All Rights Reserved -->
+///------------------------------------------------------------------------------------------------------------------///
+
+#include "../../game_state/helpers/swarm_kernels.hpp"
+
+#include "../../logging.hpp"
+
+#include <type_traits>
+
+#if defined(__AVX2__) || (defined(_MSC_VER) && defined(_M_X64))
+  #define ludumdare56_with_swarm_avx2
+  #include <immintrin.h>
+#endif
+
+#if defined(ludumdare56_with_swarm_avx2)
+
+namespace
+{
+	using namespace LudumDare56::GameState::SwarmKernels;
+	using LudumDare56::GameState::SpatialHashGrid;
+
+	static_assert(std::is_same<iceScalar, double>::value, "The SIMD swarm kernels expect icePhysics::Scalar to be a double.");
+
+	inline iceScalar HorizontalSum(const __m256d value)
+	{
+		const __m128d pair = _mm_add_pd(_mm256_castpd256_pd128(value), _mm256_extractf128_pd(value, 1));
+		return _mm_cvtsd_f64(_mm_add_sd(pair, _mm_unpackhi_pd(pair, pair)));
+	}
+
+	inline __m256d MoveModeMask(const tbCore::uint8* moveMode, const size_t index, const bool isSteeringOnly)
+	{
+		tbCore::int64 lanes[4];
+		for (size_t lane = 0; lane < 4; ++lane)
+		{
+			const bool isSet = (true == isSteeringOnly) ? (kMoveSteering == moveMode[index + lane]) : (kDoNotMove != moveMode[index + lane]);
+			lanes[lane] = (true == isSet) ? -1 : 0;
+		}
+
+		return _mm256_castsi256_pd(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(lanes)));
+	}
+
+};	//namespace
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void LudumDare56::GameState::SwarmKernels::Implementation::ComputeSteeringAVX2(const SwarmData& swarm,
+	const SpatialHashGrid& grid, const SwarmTuning& tuning, SwarmScratch& scratch)
+{
+	const __m256d zero = _mm256_setzero_pd();
+	const __m256d one = _mm256_set1_pd(1.0);
+
+	for (size_t activeIndex = 0; activeIndex < swarm.mNumberOfActiveCreatures; ++activeIndex)
+	{
+		const size_t creatureIndex = swarm.mActiveCreatures[activeIndex];
+		if (kMoveSteering != scratch.mMoveMode[creatureIndex])
+		{
+			continue;
+		}
+
+		const iceVector3 position(swarm.mPositionX[creatureIndex], swarm.mPositionY[creatureIndex], swarm.mPositionZ[creatureIndex]);
+
+		iceVector3 directionToTarget = iceVector3::Zero();
+		const bool isNearTarget = IsNearTarget(tuning, position, directionToTarget);
+		const __m256d visibleDistance = _mm256_set1_pd((true == isNearTarget) ? tuning.mNearVisibleDistance : tuning.mVisibleDistance);
+		const __m256d bubbleDistance = _mm256_set1_pd((true == isNearTarget) ? tuning.mNearBubbleDistance : tuning.mBubbleDistance);
+
+		const size_t numberOfNeighbors = GatherNeighbors(swarm, grid, creatureIndex, scratch, 4);
+
+		const __m256d positionX = _mm256_set1_pd(position.x);
+		const __m256d positionY = _mm256_set1_pd(position.y);
+		const __m256d positionZ = _mm256_set1_pd(position.z);
+
+		__m256d separationX = zero, separationY = zero, separationZ = zero;
+		__m256d positionSumX = zero, positionSumY = zero, positionSumZ = zero;
+		__m256d velocitySumX = zero, velocitySumY = zero, velocitySumZ = zero;
+		__m256d visibleCount = zero;
+
+		for (size_t neighbor = 0; neighbor < numberOfNeighbors; neighbor += 4)
+		{
+			const __m256d otherX = _mm256_loadu_pd(&scratch.mNeighborPositionX[neighbor]);
+			const __m256d otherY = _mm256_loadu_pd(&scratch.mNeighborPositionY[neighbor]);
+			const __m256d otherZ = _mm256_loadu_pd(&scratch.mNeighborPositionZ[neighbor]);
+
+			const __m256d deltaX = _mm256_sub_pd(positionX, otherX);
+			const __m256d deltaY = _mm256_sub_pd(positionY, otherY);
+			const __m256d deltaZ = _mm256_sub_pd(positionZ, otherZ);
+			const __m256d distance = _mm256_sqrt_pd(_mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(deltaX, deltaX),
+				_mm256_mul_pd(deltaY, deltaY)), _mm256_mul_pd(deltaZ, deltaZ)));
+
+			const __m256d isVisible = _mm256_cmp_pd(distance, visibleDistance, _CMP_LT_OQ);
+			positionSumX = _mm256_add_pd(positionSumX, _mm256_and_pd(isVisible, otherX));
+			positionSumY = _mm256_add_pd(positionSumY, _mm256_and_pd(isVisible, otherY));
+			positionSumZ = _mm256_add_pd(positionSumZ, _mm256_and_pd(isVisible, otherZ));
+			velocitySumX = _mm256_add_pd(velocitySumX, _mm256_and_pd(isVisible, _mm256_loadu_pd(&scratch.mNeighborVelocityX[neighbor])));
+			velocitySumY = _mm256_add_pd(velocitySumY, _mm256_and_pd(isVisible, _mm256_loadu_pd(&scratch.mNeighborVelocityY[neighbor])));
+			velocitySumZ = _mm256_add_pd(velocitySumZ, _mm256_and_pd(isVisible, _mm256_loadu_pd(&scratch.mNeighborVelocityZ[neighbor])));
+			visibleCount = _mm256_add_pd(visibleCount, _mm256_and_pd(isVisible, one));
+
+			//Creatures sitting exactly on top of each other have no direction to separate, same as Normalize().
+			const __m256d isSeparating = _mm256_and_pd(_mm256_cmp_pd(distance, bubbleDistance, _CMP_LT_OQ),
+				_mm256_cmp_pd(distance, zero, _CMP_GT_OQ));
+			const __m256d separationScale = _mm256_and_pd(isSeparating, _mm256_div_pd(_mm256_sub_pd(bubbleDistance, distance), distance));
+			separationX = _mm256_add_pd(separationX, _mm256_mul_pd(deltaX, separationScale));
+			separationY = _mm256_add_pd(separationY, _mm256_mul_pd(deltaY, separationScale));
+			separationZ = _mm256_add_pd(separationZ, _mm256_mul_pd(deltaZ, separationScale));
+		}
+
+		SteeringSums sums;
+		sums.mSeparation = iceVector3(HorizontalSum(separationX), HorizontalSum(separationY), HorizontalSum(separationZ));
+		sums.mPositionSum = iceVector3(HorizontalSum(positionSumX), HorizontalSum(positionSumY), HorizontalSum(positionSumZ));
+		sums.mVelocitySum = iceVector3(HorizontalSum(velocitySumX), HorizontalSum(velocitySumY), HorizontalSum(velocitySumZ));
+		sums.mVisibleCount = HorizontalSum(visibleCount);
+
+		FinishSteering(swarm, tuning, creatureIndex, isNearTarget, directionToTarget, sums, scratch);
+	}
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void LudumDare56::GameState::SwarmKernels::Implementation::IntegrateSwarmAVX2(SwarmData& swarm,
+	const SwarmTuning& tuning, const SwarmScratch& scratch)
+{
+	const __m256d fixedTime = _mm256_set1_pd(tuning.mFixedTime);
+	const __m256d velocityDrag = _mm256_set1_pd(tuning.mVelocityDrag);
+	const __m256d maximumVelocity = _mm256_set1_pd(tuning.mMaximumVelocity);
+
+	size_t activeIndex = 0;
+	while (activeIndex < swarm.mNumberOfActiveCreatures)
+	{
+		const size_t creatureIndex = swarm.mActiveCreatures[activeIndex];
+		if (false == IsContiguousRun(swarm, activeIndex, 4))
+		{	//Creatures next to a gap in the active list, or at the end of it, are moved one at a time.
+			IntegrateCreature(swarm, tuning, scratch, creatureIndex);
+			++activeIndex;
+			continue;
+		}
+
+		activeIndex += 4;
+
+		const __m256d isSteering = MoveModeMask(scratch.mMoveMode.data(), creatureIndex, true);
+		const __m256d isMoving = MoveModeMask(scratch.mMoveMode.data(), creatureIndex, false);
+
+		const __m256d velocityX = _mm256_loadu_pd(&swarm.mVelocityX[creatureIndex]);
+		const __m256d velocityY = _mm256_loadu_pd(&swarm.mVelocityY[creatureIndex]);
+		const __m256d velocityZ = _mm256_loadu_pd(&swarm.mVelocityZ[creatureIndex]);
+
+		const __m256d draggedX = _mm256_sub_pd(velocityX, _mm256_mul_pd(_mm256_mul_pd(velocityX, velocityDrag), fixedTime));
+		const __m256d draggedY = _mm256_sub_pd(velocityY, _mm256_mul_pd(_mm256_mul_pd(velocityY, velocityDrag), fixedTime));
+		const __m256d draggedZ = _mm256_sub_pd(velocityZ, _mm256_mul_pd(_mm256_mul_pd(velocityZ, velocityDrag), fixedTime));
+
+		__m256d flatX = _mm256_add_pd(draggedX, _mm256_mul_pd(_mm256_loadu_pd(&scratch.mSteeringX[creatureIndex]), fixedTime));
+		__m256d flatZ = _mm256_add_pd(draggedZ, _mm256_mul_pd(_mm256_loadu_pd(&scratch.mSteeringZ[creatureIndex]), fixedTime));
+
+		const __m256d speed = _mm256_sqrt_pd(_mm256_add_pd(_mm256_mul_pd(flatX, flatX), _mm256_mul_pd(flatZ, flatZ)));
+		const __m256d isTooFast = _mm256_cmp_pd(speed, maximumVelocity, _CMP_GT_OQ);
+		flatX = _mm256_blendv_pd(flatX, _mm256_mul_pd(_mm256_div_pd(flatX, speed), maximumVelocity), isTooFast);
+		flatZ = _mm256_blendv_pd(flatZ, _mm256_mul_pd(_mm256_div_pd(flatZ, speed), maximumVelocity), isTooFast);
+
+		const __m256d finalX = _mm256_blendv_pd(velocityX, flatX, isSteering);
+		const __m256d finalY = _mm256_blendv_pd(velocityY, draggedY, isSteering);
+		const __m256d finalZ = _mm256_blendv_pd(velocityZ, flatZ, isSteering);
+
+		const __m256d positionX = _mm256_loadu_pd(&swarm.mPositionX[creatureIndex]);
+		const __m256d positionY = _mm256_loadu_pd(&swarm.mPositionY[creatureIndex]);
+		const __m256d positionZ = _mm256_loadu_pd(&swarm.mPositionZ[creatureIndex]);
+
+		_mm256_storeu_pd(&swarm.mPositionX[creatureIndex], _mm256_blendv_pd(positionX, _mm256_add_pd(positionX, _mm256_mul_pd(finalX, fixedTime)), isMoving));
+		_mm256_storeu_pd(&swarm.mPositionY[creatureIndex], _mm256_blendv_pd(positionY, _mm256_add_pd(positionY, _mm256_mul_pd(finalY, fixedTime)), isMoving));
+		_mm256_storeu_pd(&swarm.mPositionZ[creatureIndex], _mm256_blendv_pd(positionZ, _mm256_add_pd(positionZ, _mm256_mul_pd(finalZ, fixedTime)), isMoving));
+		_mm256_storeu_pd(&swarm.mVelocityX[creatureIndex], finalX);
+		_mm256_storeu_pd(&swarm.mVelocityY[creatureIndex], finalY);
+		_mm256_storeu_pd(&swarm.mVelocityZ[creatureIndex], finalZ);
+	}
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+bool LudumDare56::GameState::SwarmKernels::Implementation::IsBuiltWithAVX2(void)
+{
+	return true;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+#else /* ludumdare56_with_swarm_avx2 */
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void LudumDare56::GameState::SwarmKernels::Implementation::ComputeSteeringAVX2(const SwarmData&,
+	const SpatialHashGrid&, const SwarmTuning&, SwarmScratch&)
+{
+	tb_error("The swarm kernels were not built with AVX2 support.");
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void LudumDare56::GameState::SwarmKernels::Implementation::IntegrateSwarmAVX2(SwarmData&, const SwarmTuning&,
+	const SwarmScratch&)
+{
+	tb_error("The swarm kernels were not built with AVX2 support.");
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+bool LudumDare56::GameState::SwarmKernels::Implementation::IsBuiltWithAVX2(void)
+{
+	return false;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+#endif /* ludumdare56_with_swarm_avx2 */
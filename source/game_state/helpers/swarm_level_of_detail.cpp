@@ -0,0 +1,217 @@
+///
+/// @file
+/// @details Decides how often each creature of a swarm gets its expensive update (ground probe and neighbor steering)
+///   based on how far it is from its racecar, whether a client could see it and whether it has settled down.
+///
+/// <!-- Copyright (c) 2024 Tyre Bytes LLC - All Rights Reserved -->
+///------------------------------------------------------------------------------------------------------------------///
+
+#include "../../game_state/helpers/swarm_level_of_detail.hpp"
+
+#include "../../logging.hpp"
+
+#include <algorithm>
+#include <vector>
+
+namespace
+{
+	using LudumDare56::GameState::SwarmLevelOfDetail;
+
+	//Distances are measured flat, ignoring the height, from the racecar the swarm is following.
+	const iceScalar kFullRateDistance = 10.0;
+	const iceScalar kHalfRateDistance = 20.0;
+	const iceScalar kQuarterRateDistance = 40.0;
+
+	//A creature moving slower than this has settled into the swarm and is not likely to need steering each tick.
+	const iceScalar kSettledSpeed = 0.5;
+
+	//Roughly a 120 degree cone, wider than any camera so creatures at the edge of the screen are not demoted.
+	const iceScalar kClientViewCosine = 0.5;
+
+	struct FocusZone
+	{
+		SwarmLevelOfDetail::FocusZoneKey mKey;
+		iceVector3 mPosition;
+		iceScalar mSquaredRadius;
+	};
+
+	std::vector<FocusZone> theFocusZones;
+	SwarmLevelOfDetail::FocusZoneKey theNextFocusZoneKey = 0;
+
+	bool theClientViewIsSet = false;
+	bool theScheduleIsDeterministic = false;
+	iceVector3 theClientViewPosition = iceVector3::Zero();
+	iceVector3 theClientViewDirection = iceVector3::Zero();
+
+	inline iceScalar SquaredFlatDistance(const iceVector3& a, const iceVector3& b)
+	{
+		const iceScalar deltaX = a.x - b.x;
+		const iceScalar deltaZ = a.z - b.z;
+		return deltaX * deltaX + deltaZ * deltaZ;
+	}
+
+	bool IsWithinFocusZone(const iceVector3& positionInWorld)
+	{
+		for (const FocusZone& focusZone : theFocusZones)
+		{
+			if (positionInWorld.SquaredDistanceTo(focusZone.mPosition) < focusZone.mSquaredRadius)
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	bool IsOutsideClientView(const iceVector3& positionInWorld)
+	{
+		if (false == theClientViewIsSet || true == theScheduleIsDeterministic)
+		{
+			return false;
+		}
+
+		const iceVector3 toPosition = positionInWorld - theClientViewPosition;
+		const iceScalar distanceAlongView = iceVector3::Dot(toPosition, theClientViewDirection);
+		if (distanceAlongView <= 0.0)
+		{
+			return true;
+		}
+
+		//Same as comparing the cosine of the angle to the view direction without needing a square root.
+		return distanceAlongView * distanceAlongView < kClientViewCosine * kClientViewCosine * toPosition.MagnitudeSquared();
+	}
+
+};	//namespace
+
+//--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
+
+LudumDare56::GameState::SwarmLevelOfDetail::FocusZoneKey LudumDare56::GameState::SwarmLevelOfDetail::AddFocusZone(
+	const iceVector3& positionInWorld, const iceScalar radius)
+{
+	tb_error_if(radius <= 0.0, "Expected the focus zone to have a positive radius.");
+
+	const FocusZoneKey focusZone = theNextFocusZoneKey++;
+	theFocusZones.push_back(FocusZone{ focusZone, positionInWorld, radius * radius });
+	return focusZone;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void LudumDare56::GameState::SwarmLevelOfDetail::RemoveFocusZone(const FocusZoneKey focusZone)
+{
+	theFocusZones.erase(std::remove_if(theFocusZones.begin(), theFocusZones.end(),
+		[focusZone](const FocusZone& zone) { return zone.mKey == focusZone; }), theFocusZones.end());
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void LudumDare56::GameState::SwarmLevelOfDetail::SetClientView(const iceVector3& viewPositionInWorld, const iceVector3& viewDirection)
+{
+	theClientViewIsSet = true;
+	theClientViewPosition = viewPositionInWorld;
+	theClientViewDirection = viewDirection.GetNormalized();
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void LudumDare56::GameState::SwarmLevelOfDetail::ClearClientView(void)
+{
+	theClientViewIsSet = false;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void LudumDare56::GameState::SwarmLevelOfDetail::SetDeterministic(const bool isDeterministic)
+{
+	theScheduleIsDeterministic = isDeterministic;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
+
+LudumDare56::GameState::SwarmLevelOfDetail::SwarmLevelOfDetail(void) :
+	mFocusPosition(iceVector3::Zero()),
+	mTierCounts(),
+	mUpdatedCount(0),
+	mTick(0)
+{
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+LudumDare56::GameState::SwarmLevelOfDetail::~SwarmLevelOfDetail(void)
+{
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void LudumDare56::GameState::SwarmLevelOfDetail::Reset(void)
+{
+	mTierCounts.fill(0);
+	mUpdatedCount = 0;
+	mTick = 0;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void LudumDare56::GameState::SwarmLevelOfDetail::BeginTick(const iceVector3& focusPositionInWorld)
+{
+	mFocusPosition = focusPositionInWorld;
+	mTierCounts.fill(0);
+	mUpdatedCount = 0;
+	++mTick;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+LudumDare56::GameState::SwarmLevelOfDetail::Update LudumDare56::GameState::SwarmLevelOfDetail::ScheduleEntry(
+	const EntryIndex entryIndex, const iceVector3& positionInWorld, const iceVector3& velocity)
+{
+	const iceScalar squaredDistance = SquaredFlatDistance(positionInWorld, mFocusPosition);
+
+	Tier groundTier = kFullRate;
+	Tier tier = kFullRate;
+	if (squaredDistance >= kFullRateDistance * kFullRateDistance && false == IsWithinFocusZone(positionInWorld))
+	{
+		int demotion = (squaredDistance < kHalfRateDistance * kHalfRateDistance) ? 1 :
+			(squaredDistance < kQuarterRateDistance * kQuarterRateDistance) ? 2 : 3;
+
+		const iceScalar squaredFlatSpeed = velocity.x * velocity.x + velocity.z * velocity.z;
+		if (squaredFlatSpeed < kSettledSpeed * kSettledSpeed)
+		{
+			++demotion;
+		}
+
+		groundTier = static_cast<Tier>(std::min(demotion, static_cast<int>(kEighthRate)));
+
+		//The client view only holds back the steering, never the ground probes, or the camera would decide how long
+		//  a creature could wander off the track before it fell.
+		if (true == IsOutsideClientView(positionInWorld))
+		{
+			++demotion;
+		}
+
+		tier = static_cast<Tier>(std::min(demotion, static_cast<int>(kEighthRate)));
+	}
+
+	++mTierCounts[tier];
+
+	//The periods are powers of two, so an entry due on its tier is always due on any faster tier as well.
+	if (0 != ((mTick + entryIndex) & (GetTierPeriod(groundTier) - 1)))
+	{
+		return kSkipUpdate;
+	}
+
+	if (0 != ((mTick + entryIndex) & (GetTierPeriod(tier) - 1)))
+	{
+		return kProbeGround;
+	}
+
+	++mUpdatedCount;
+	return kFullUpdate;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
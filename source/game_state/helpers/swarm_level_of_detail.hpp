@@ -0,0 +1,116 @@
+///
+/// @file
+/// @details Decides how often each creature of a swarm gets its expensive update (ground probe and neighbor steering)
+///   based on how far it is from its racecar, whether a client could see it and whether it has settled down.
+///
+/// <!-- Copyright (c) 2024 Tyre Bytes LLC - All Rights Reserved -->
+///------------------------------------------------------------------------------------------------------------------///
+
+#ifndef LudumDare56_SwarmLevelOfDetail_hpp
+#define LudumDare56_SwarmLevelOfDetail_hpp
+
+#include "../../ludumdare56.hpp"
+
+#include <turtle_brains/core/tb_types.hpp>
+
+#include <array>
+
+namespace LudumDare56::GameState
+{
+
+	///
+	/// @details Each tick the scheduler is started with BeginTick() and then every creature is scheduled, which places
+	///   it into a tier and returns which part of its update is due this tick. A creature that is not due keeps its last
+	///   ground result and carries on with its current velocity until it is due again.
+	///
+	///   The ground probes are what decide whether a creature falls off the track, so they are only ever scheduled by
+	///   the distance, settling and focus zones, which every machine agrees on. The client view only holds back the
+	///   steering, see SetClientView().
+	///
+	///   The updates within a tier are staggered by the entry index so only a fraction of the far creatures are updated
+	///   on any given tick instead of all of them every eighth tick.
+	///
+	class SwarmLevelOfDetail
+	{
+	public:
+		typedef tbCore::uint32 EntryIndex;
+		typedef tbCore::uint32 FocusZoneKey;
+
+		enum Tier : tbCore::uint8
+		{
+			kFullRate = 0,     //Updated every tick.
+			kHalfRate = 1,     //Updated every 2nd tick.
+			kQuarterRate = 2,  //Updated every 4th tick.
+			kEighthRate = 3,   //Updated every 8th tick.
+			kNumberOfTiers
+		};
+
+		enum Update : tbCore::uint8
+		{
+			kSkipUpdate = 0,   //Not due, carries on with its velocity and last ground result.
+			kProbeGround = 1,  //Only the ground probe is due, the client view held back the steering.
+			kFullUpdate = 2,   //Both the ground probe and the steering are due.
+		};
+
+		static constexpr tbCore::uint32 GetTierPeriod(const Tier tier) { return tbCore::uint32(1) << tier; }
+
+		///
+		/// @details Creatures within the radius of any focus zone always run at the full rate, this is for places like
+		///   the finish line where skipping an update could change the outcome of the race.
+		///
+		static FocusZoneKey AddFocusZone(const iceVector3& positionInWorld, const iceScalar radius);
+		static void RemoveFocusZone(const FocusZoneKey focusZone);
+
+		///
+		/// @details Creatures outside of the client view drop a tier for their steering only, their ground probes stay
+		///   on the tier the server would use so where the camera looks never changes when a creature is caught going
+		///   off the track. Nothing sets the client view in a headless build.
+		///
+		static void SetClientView(const iceVector3& viewPositionInWorld, const iceVector3& viewDirection);
+		static void ClearClientView(void);
+
+		///
+		/// @details While deterministic the client view is ignored, since each client looks from somewhere else, so
+		///   every machine schedules the exact same creatures each tick.
+		///
+		static void SetDeterministic(const bool isDeterministic);
+
+		SwarmLevelOfDetail(void);
+		~SwarmLevelOfDetail(void);
+
+		///
+		/// @details Restarts the stagger and clears the counters, typically when the swarm is placed on the grid.
+		///
+		void Reset(void);
+
+		///
+		/// @details Advances to the next tick and clears the per-tick counters. The focusPositionInWorld is the position
+		///   the creatures are following, the racecar, which keeps nearby creatures at the full rate.
+		///
+		void BeginTick(const iceVector3& focusPositionInWorld);
+
+		///
+		/// @details Places the entry into a tier for this tick and returns which part of its update is due.
+		///
+		Update ScheduleEntry(const EntryIndex entryIndex, const iceVector3& positionInWorld, const iceVector3& velocity);
+
+		///
+		/// @details Returns how many entries were placed into the tier during the current tick.
+		///
+		inline tbCore::uint32 GetTierCount(const Tier tier) const { return mTierCounts[tier]; }
+
+		///
+		/// @details Returns how many entries were due for a full update during the current tick.
+		///
+		inline tbCore::uint32 GetUpdatedCount(void) const { return mUpdatedCount; }
+
+	private:
+		iceVector3 mFocusPosition;
+		std::array<tbCore::uint32, kNumberOfTiers> mTierCounts;
+		tbCore::uint32 mUpdatedCount;
+		tbCore::uint32 mTick;
+	};
+
+};	//namespace LudumDare56::GameState
+
+#endif /* LudumDare56_SwarmLevelOfDetail_hpp */
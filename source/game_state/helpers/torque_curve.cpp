@@ -39,6 +39,8 @@ LudumDare56::GameState::TorqueCurve LudumDare56::GameState::TorqueCurve::MiataTo
 
 LudumDare56::GameState::TorqueCurve::TorqueCurve(void) :
 	mTorqueTable(),
+	mBakedTable(),
+	mBakedInverseSpacing(0.0),
 	mMaximumTorque(0.0),
 	mIsNormalized(false)
 {
@@ -77,6 +79,15 @@ void LudumDare56::GameState::TorqueCurve::NormalizeTorqueCurve(void)
 	std::sort(mTorqueTable.begin(), mTorqueTable.end(), [](PlotPoint& a, PlotPoint& b) { return a.first < b.first; });
 	std::for_each(mTorqueTable.begin(), mTorqueTable.end(), [this](PlotPoint& pt) { pt.second /= mMaximumTorque; });
 
+	const icePhysics::Scalar minimumRPM = mTorqueTable.front().first;
+	const icePhysics::Scalar rangeRPM = mTorqueTable.back().first - minimumRPM;
+	for (size_t bakedIndex = 0; bakedIndex < kBakedTableSize; ++bakedIndex)
+	{
+		const icePhysics::Scalar fraction = static_cast<icePhysics::Scalar>(bakedIndex) / static_cast<icePhysics::Scalar>(kBakedTableSize - 1);
+		mBakedTable[bakedIndex] = GetPlottedOutputValue(minimumRPM + rangeRPM * fraction);
+	}
+
+	mBakedInverseSpacing = (rangeRPM > 0.0) ? static_cast<icePhysics::Scalar>(kBakedTableSize - 1) / rangeRPM : icePhysics::Scalar(0.0);
 	mIsNormalized = true;
 }
 
@@ -96,17 +107,45 @@ icePhysics::Scalar LudumDare56::GameState::TorqueCurve::GetOutputTorque(const ic
 
 //--------------------------------------------------------------------------------------------------------------------//
 
+icePhysics::Scalar LudumDare56::GameState::TorqueCurve::GetPlottedOutputTorque(const icePhysics::Scalar engineSpeedRPM) const
+{
+	tb_error_if(false == mIsNormalized, "Cannot get output of a TorqueCurve that has not been normalized. Call NormalizeTorqueCurve().");
+	return GetPlottedOutputValue(engineSpeedRPM) * mMaximumTorque;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
 icePhysics::Scalar LudumDare56::GameState::TorqueCurve::GetOutputValue(const icePhysics::Scalar engineSpeedRPM) const
 {
 	tb_error_if(false == mIsNormalized, "Cannot get output of a TorqueCurve that has not been normalized. Call NormalizeTorqueCurve().");
 
+	const icePhysics::Scalar position = (engineSpeedRPM - mTorqueTable.front().first) * mBakedInverseSpacing;
+	if (false == (position > icePhysics::Scalar(0.0)))
+	{	//The RPM of the engine is lower than the lowest in torque table, this also catches NaN.
+		return mBakedTable.front();
+	}
+
+	if (position >= static_cast<icePhysics::Scalar>(kBakedTableSize - 1))
+	{
+		return mBakedTable.back();
+	}
+
+	const size_t index = static_cast<size_t>(position);
+	const icePhysics::Scalar percentage = position - static_cast<icePhysics::Scalar>(index);
+	return mBakedTable[index] + (mBakedTable[index + 1] - mBakedTable[index]) * percentage;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+icePhysics::Scalar LudumDare56::GameState::TorqueCurve::GetPlottedOutputValue(const icePhysics::Scalar engineSpeedRPM) const
+{
 	PlotPoint previousPoint = mTorqueTable.front();
 	if (engineSpeedRPM < previousPoint.first)
 	{	//The RPM of the engine is lower than the lowest in torque table.
 		return previousPoint.second;
 	}
 
-	for (size_t index(1); index < kTorqueTableSize; ++index)
+	for (size_t index(1); index < mTorqueTable.size(); ++index)
 	{
 		const PlotPoint& currentPoint(mTorqueTable[index]);
 		const icePhysics::Scalar& currentRPM(currentPoint.first);
@@ -124,12 +163,20 @@ icePhysics::Scalar LudumDare56::GameState::TorqueCurve::GetOutputValue(const ice
 		return previousTorque + ((currentTorque - previousTorque) * percentage);
 	}
 
-	tb_debug_log(LogPhysics::Warning() << "Value not found for RPM: " << engineSpeedRPM << " in torque table.");
+	//Above the table holds the last value without a warning, the racecars hit this every step on the rev limiter.
 	return mTorqueTable.back().second;
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
 
+icePhysics::Scalar LudumDare56::GameState::TorqueCurve::GetMinimumRPM(void) const
+{
+	tb_error_if(false == mIsNormalized, "Cannot get the Minimum RPM of a TorqueCurve that has not been normalized. Call NormalizeTorqueCurve().");
+	return mTorqueTable.front().first;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
 icePhysics::Scalar LudumDare56::GameState::TorqueCurve::GetMaximumRPM(void) const
 {
 	tb_error_if(false == mIsNormalized, "Cannot get the Maximum RPM of a TorqueCurve that has not been normalized. Call NormalizeTorqueCurve().");
@@ -10,6 +10,7 @@
 
 #include <ice/physics/ice_physical_types.hpp>
 
+#include <array>
 #include <vector>
 
 namespace LudumDare56
@@ -36,7 +37,9 @@ namespace LudumDare56
 			void AddPlotPoint(const icePhysics::Scalar engineSpeedRPM, const icePhysics::Scalar torque);
 
 			///
-			/// @details Finds the maximum torque value in the table and normalizes all values to be within 0.0 to 1.0.
+			/// @details Finds the maximum torque value in the table and normalizes all values to be within 0.0 to 1.0,
+			///   then bakes the plotted points into a table sampled at evenly spaced engine speeds so each lookup after
+			///   is a single interpolation rather than a search through the plotted points.
 			///
 			void NormalizeTorqueCurve(void);
 
@@ -52,22 +55,37 @@ namespace LudumDare56
 
 			///
 			/// @details Returns the maximum torque output of the engine at the given engine speed in Nm (Newton-meters).
+			///   Below the lowest plotted engine speed this is the torque at the lowest, and above the highest it is the
+			///   torque at the highest.
 			///
 			icePhysics::Scalar GetOutputTorque(const icePhysics::Scalar engineSpeedRPM) const;
 
+			///
+			/// @details Returns the same as GetOutputTorque() straight from the plotted points instead of the baked table,
+			///   which is much slower and only meant for checking the baked table against.
+			///
+			icePhysics::Scalar GetPlottedOutputTorque(const icePhysics::Scalar engineSpeedRPM) const;
+
+			icePhysics::Scalar GetMinimumRPM(void) const;
 			icePhysics::Scalar GetMaximumRPM(void) const;
 
+			///
+			/// @details The number of evenly spaced engine speeds in the baked table, from GetMinimumRPM() to GetMaximumRPM().
+			///
+			static constexpr size_t kBakedTableSize = 1024;
+
 		private:
 
 			///
 			/// @details Returns a value from 0 to 1 representing a percentage of the maximum torque at this given engine speed.
 			///
 			icePhysics::Scalar GetOutputValue(const icePhysics::Scalar engineSpeedRPM) const;
-
-			static const size_t kTorqueTableSize = 16;
+			icePhysics::Scalar GetPlottedOutputValue(const icePhysics::Scalar engineSpeedRPM) const;
 
 			typedef std::pair<icePhysics::Scalar, icePhysics::Scalar> PlotPoint; //RPM, NormalizedTorque
 			std::vector<PlotPoint> mTorqueTable;
+			std::array<icePhysics::Scalar, kBakedTableSize> mBakedTable; //NormalizedTorque at evenly spaced RPM.
+			icePhysics::Scalar mBakedInverseSpacing;  //Table entries per RPM.
 			icePhysics::Scalar mMaximumTorque;  //In Nm
 			bool mIsNormalized;
 		};
@@ -0,0 +1,571 @@
+///
+/// @file
+/// @details A precomputed table of the ground height and on-track flags of the racetrack in spline-space, so the ground
+///   beneath any position can be found without touching the physical world.
+///
+/// <!-- Copyright (c) 2024 Tyre Bytes LLC - All Rights Reserved -->
+///------------------------------------------------------------------------------------------------------------------///
+
+#include "../../game_state/helpers/track_surface_table.hpp"
+
+#include "../../logging.hpp"
+
+#include <turtle_brains/core/unit_test/tb_unit_test.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+
+namespace
+{
+	//The TrackNodeEdges are roughly 10m apart, so this samples the surface about every meter along the track.
+	const size_t kRowsPerSegment = 10;
+
+	const iceScalar kColumnSpacing = 0.5;
+
+	//Creatures and racecars do wander off the edge of the track, the table keeps sampling this far beyond the widest
+	//  cross section so they still find the ground, or find there is none, without asking the physical world.
+	const iceScalar kShoulderWidth = 2.0;
+
+	//Rays sampling the surface hierarchy start this far above the expected surface and reach twice as far down. This
+	//  needs to stay below the clearance of any bridge or the track beneath would be sampled at the bridge height.
+	const iceScalar kSurfaceSearchHeight = 2.0;
+
+	//Size of the grid cells on the ground plane that hold the segments that could be found in that cell.
+	const iceScalar kLookupCellSize = 10.0;
+
+	const iceScalar kDegenerateEpsilon = 1.0e-9;
+
+	iceScalar Lerp(const iceScalar from, const iceScalar to, const iceScalar fraction)
+	{
+		return from + (to - from) * fraction;
+	}
+
+};	//namespace
+
+//--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
+
+LudumDare56::GameState::TrackSurfaceTable::TrackSurfaceTable(void) :
+	mCrossSections(),
+	mLateralExtent(0.0),
+	mNumberOfColumns(0),
+	mRowHeights(),
+	mRowSurface(),
+	mGridMinimumX(0.0),
+	mGridMinimumZ(0.0),
+	mGridColumns(0),
+	mGridRows(0),
+	mCellStart(),
+	mCellSegments()
+{
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+LudumDare56::GameState::TrackSurfaceTable::~TrackSurfaceTable(void)
+{
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void LudumDare56::GameState::TrackSurfaceTable::Clear(void)
+{
+	mCrossSections.clear();
+	mLateralExtent = 0.0;
+	mNumberOfColumns = 0;
+	mRowHeights.clear();
+	mRowSurface.clear();
+	mGridColumns = 0;
+	mGridRows = 0;
+	mCellStart.clear();
+	mCellSegments.clear();
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void LudumDare56::GameState::TrackSurfaceTable::AddCrossSection(const iceVector3& left, const iceVector3& center,
+	const iceVector3& right)
+{
+	const iceScalar acrossX = right.x - left.x;
+	const iceScalar acrossZ = right.z - left.z;
+	const iceScalar flatWidth = std::sqrt(acrossX * acrossX + acrossZ * acrossZ);
+	tb_error_if(flatWidth < kDegenerateEpsilon, "Error: Expected the cross section of the track to have some width.");
+
+	CrossSection crossSection;
+	crossSection.mCenter[0] = center.x;
+	crossSection.mCenter[1] = center.y;
+	crossSection.mCenter[2] = center.z;
+	crossSection.mRight[0] = acrossX / flatWidth;
+	crossSection.mRight[1] = acrossZ / flatWidth;
+	crossSection.mHalfWidth = flatWidth * 0.5;
+	crossSection.mSlope = (right.y - left.y) / flatWidth;
+	crossSection.mDistanceAlongTrack = 0.0;
+	mCrossSections.push_back(crossSection);
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void LudumDare56::GameState::TrackSurfaceTable::Build(const BoundingVolumeHierarchy& surface)
+{
+	mRowHeights.clear();
+	mRowSurface.clear();
+	mCellStart.clear();
+	mCellSegments.clear();
+	mGridColumns = 0;
+	mGridRows = 0;
+
+	const size_t numberOfSegments = GetNumberOfSegments();
+	if (0 == numberOfSegments)
+	{
+		return;
+	}
+
+	iceScalar widestHalfWidth = mCrossSections[0].mHalfWidth;
+	for (size_t index = 1; index < mCrossSections.size(); ++index)
+	{
+		const CrossSection& trailing = mCrossSections[index - 1];
+		CrossSection& leading = mCrossSections[index];
+
+		const iceScalar deltaX = leading.mCenter[0] - trailing.mCenter[0];
+		const iceScalar deltaY = leading.mCenter[1] - trailing.mCenter[1];
+		const iceScalar deltaZ = leading.mCenter[2] - trailing.mCenter[2];
+		leading.mDistanceAlongTrack = trailing.mDistanceAlongTrack + std::sqrt(deltaX * deltaX + deltaY * deltaY + deltaZ * deltaZ);
+		widestHalfWidth = std::max(widestHalfWidth, leading.mHalfWidth);
+	}
+
+	//The center line is always a column, with the same number of columns to the left and right.
+	const size_t sideColumns = static_cast<size_t>(std::ceil((widestHalfWidth + kShoulderWidth) / kColumnSpacing));
+	mLateralExtent = static_cast<iceScalar>(sideColumns) * kColumnSpacing;
+	mNumberOfColumns = sideColumns * 2 + 1;
+
+	const size_t numberOfRows = numberOfSegments * kRowsPerSegment + 1;
+	mRowHeights.resize(numberOfRows * mNumberOfColumns);
+	mRowSurface.resize(numberOfRows * mNumberOfColumns);
+
+	const iceVector3 down(0.0, -1.0, 0.0);
+	BoundingVolumeHierarchy::RayHit hit;
+
+	for (size_t row = 0; row < numberOfRows; ++row)
+	{
+		const size_t segmentIndex = std::min(row / kRowsPerSegment, numberOfSegments - 1);
+		const iceScalar fraction = static_cast<iceScalar>(row - segmentIndex * kRowsPerSegment) / static_cast<iceScalar>(kRowsPerSegment);
+
+		iceScalar center[3];
+		iceScalar right[2];
+		iceScalar halfWidth = 0.0;
+		iceScalar slope = 0.0;
+		Interpolate(static_cast<SegmentIndex>(segmentIndex), fraction, center, right, halfWidth, slope);
+
+		for (size_t column = 0; column < mNumberOfColumns; ++column)
+		{
+			const iceScalar lateral = static_cast<iceScalar>(column) * kColumnSpacing - mLateralExtent;
+			const iceScalar expectedHeight = center[1] + slope * lateral;
+
+			iceScalar height = expectedHeight;
+			bool hasSurface = false;
+			if (true == surface.IsEmpty())
+			{
+				hasSurface = (std::abs(lateral) <= halfWidth);
+			}
+			else
+			{
+				const iceVector3 origin(center[0] + right[0] * lateral, expectedHeight + kSurfaceSearchHeight, center[2] + right[1] * lateral);
+				if (true == surface.CastRay(origin, down, kSurfaceSearchHeight * 2.0, hit))
+				{
+					height = hit.mPoint.y;
+					hasSurface = true;
+				}
+			}
+
+			const size_t sampleIndex = row * mNumberOfColumns + column;
+			mRowHeights[sampleIndex] = static_cast<float>(height);
+			mRowSurface[sampleIndex] = (true == hasSurface) ? 1 : 0;
+		}
+	}
+
+	{	//Build the lookup grid, each segment is placed in every cell its corners (shoulders included) reach.
+		iceScalar minimumX = std::numeric_limits<iceScalar>::max();
+		iceScalar minimumZ = std::numeric_limits<iceScalar>::max();
+		iceScalar maximumX = -std::numeric_limits<iceScalar>::max();
+		iceScalar maximumZ = -std::numeric_limits<iceScalar>::max();
+
+		for (const CrossSection& crossSection : mCrossSections)
+		{
+			for (const iceScalar side : { -mLateralExtent, mLateralExtent })
+			{
+				const iceScalar x = crossSection.mCenter[0] + crossSection.mRight[0] * side;
+				const iceScalar z = crossSection.mCenter[2] + crossSection.mRight[1] * side;
+				minimumX = std::min(minimumX, x);
+				minimumZ = std::min(minimumZ, z);
+				maximumX = std::max(maximumX, x);
+				maximumZ = std::max(maximumZ, z);
+			}
+		}
+
+		mGridMinimumX = minimumX;
+		mGridMinimumZ = minimumZ;
+		mGridColumns = static_cast<size_t>((maximumX - minimumX) / kLookupCellSize) + 1;
+		mGridRows = static_cast<size_t>((maximumZ - minimumZ) / kLookupCellSize) + 1;
+
+		const auto forEachCellOfSegment = [this](const size_t segmentIndex, const auto& callback) {
+			iceScalar segmentMinimumX = std::numeric_limits<iceScalar>::max();
+			iceScalar segmentMinimumZ = std::numeric_limits<iceScalar>::max();
+			iceScalar segmentMaximumX = -std::numeric_limits<iceScalar>::max();
+			iceScalar segmentMaximumZ = -std::numeric_limits<iceScalar>::max();
+
+			for (size_t index = segmentIndex; index <= segmentIndex + 1; ++index)
+			{
+				const CrossSection& crossSection = mCrossSections[index];
+				for (const iceScalar side : { -mLateralExtent, mLateralExtent })
+				{
+					const iceScalar x = crossSection.mCenter[0] + crossSection.mRight[0] * side;
+					const iceScalar z = crossSection.mCenter[2] + crossSection.mRight[1] * side;
+					segmentMinimumX = std::min(segmentMinimumX, x);
+					segmentMinimumZ = std::min(segmentMinimumZ, z);
+					segmentMaximumX = std::max(segmentMaximumX, x);
+					segmentMaximumZ = std::max(segmentMaximumZ, z);
+				}
+			}
+
+			const size_t firstColumn = static_cast<size_t>((segmentMinimumX - mGridMinimumX) / kLookupCellSize);
+			const size_t lastColumn = std::min(mGridColumns - 1, static_cast<size_t>((segmentMaximumX - mGridMinimumX) / kLookupCellSize));
+			const size_t firstRow = static_cast<size_t>((segmentMinimumZ - mGridMinimumZ) / kLookupCellSize);
+			const size_t lastRow = std::min(mGridRows - 1, static_cast<size_t>((segmentMaximumZ - mGridMinimumZ) / kLookupCellSize));
+
+			for (size_t row = firstRow; row <= lastRow; ++row)
+			{
+				for (size_t column = firstColumn; column <= lastColumn; ++column)
+				{
+					callback(row * mGridColumns + column);
+				}
+			}
+		};
+
+		mCellStart.assign(mGridColumns * mGridRows + 1, 0);
+		for (size_t segmentIndex = 0; segmentIndex < numberOfSegments; ++segmentIndex)
+		{
+			forEachCellOfSegment(segmentIndex, [this](const size_t cellIndex) { ++mCellStart[cellIndex + 1]; });
+		}
+
+		for (size_t cellIndex = 1; cellIndex < mCellStart.size(); ++cellIndex)
+		{
+			mCellStart[cellIndex] += mCellStart[cellIndex - 1];
+		}
+
+		std::vector<tbCore::uint32> cellCursor(mCellStart.begin(), mCellStart.end() - 1);
+		mCellSegments.resize(mCellStart.back());
+		for (size_t segmentIndex = 0; segmentIndex < numberOfSegments; ++segmentIndex)
+		{
+			forEachCellOfSegment(segmentIndex, [this, &cellCursor, segmentIndex](const size_t cellIndex) {
+				mCellSegments[cellCursor[cellIndex]++] = static_cast<SegmentIndex>(segmentIndex);
+			});
+		}
+	}
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+bool LudumDare56::GameState::TrackSurfaceTable::QuerySurface(const iceVector3& positionInWorld, SurfaceSample& sample) const
+{
+	if (true == IsEmpty())
+	{
+		return false;
+	}
+
+	const iceScalar cellX = std::floor((positionInWorld.x - mGridMinimumX) / kLookupCellSize);
+	const iceScalar cellZ = std::floor((positionInWorld.z - mGridMinimumZ) / kLookupCellSize);
+	if (cellX < 0.0 || cellZ < 0.0 || cellX >= static_cast<iceScalar>(mGridColumns) || cellZ >= static_cast<iceScalar>(mGridRows))
+	{
+		return false;
+	}
+
+	const size_t cellIndex = static_cast<size_t>(cellZ) * mGridColumns + static_cast<size_t>(cellX);
+
+	//More than one segment can hold the position where the track crosses over itself, or on the inside of a bend
+	//  tighter than the shoulders. Closest to the expected surface, then to the center line, is the one picked.
+	SegmentIndex bestSegment = 0;
+	iceScalar bestFraction = 0.0;
+	iceScalar bestLateral = 0.0;
+	iceScalar bestScore = std::numeric_limits<iceScalar>::max();
+
+	for (tbCore::uint32 cellSegment = mCellStart[cellIndex]; cellSegment < mCellStart[cellIndex + 1]; ++cellSegment)
+	{
+		const SegmentIndex segmentIndex = mCellSegments[cellSegment];
+
+		iceScalar fraction = 0.0;
+		iceScalar lateral = 0.0;
+		if (false == LocateInSegment(segmentIndex, positionInWorld.x, positionInWorld.z, fraction, lateral))
+		{
+			continue;
+		}
+
+		const CrossSection& trailing = mCrossSections[segmentIndex];
+		const CrossSection& leading = mCrossSections[segmentIndex + 1];
+		const iceScalar expectedHeight = Lerp(trailing.mCenter[1], leading.mCenter[1], fraction) +
+			Lerp(trailing.mSlope, leading.mSlope, fraction) * lateral;
+		const iceScalar heightAbove = positionInWorld.y - expectedHeight;
+		const iceScalar score = heightAbove * heightAbove + lateral * lateral;
+		if (score < bestScore)
+		{
+			bestSegment = segmentIndex;
+			bestFraction = fraction;
+			bestLateral = lateral;
+			bestScore = score;
+		}
+	}
+
+	if (std::numeric_limits<iceScalar>::max() == bestScore)
+	{
+		return false;
+	}
+
+	const size_t numberOfRows = mRowHeights.size() / mNumberOfColumns;
+	const iceScalar rowPosition = (static_cast<iceScalar>(bestSegment) + bestFraction) * static_cast<iceScalar>(kRowsPerSegment);
+	const iceScalar columnPosition = (bestLateral + mLateralExtent) / kColumnSpacing;
+
+	const size_t row = std::min(static_cast<size_t>(rowPosition), numberOfRows - 2);
+	const size_t column = std::min(static_cast<size_t>(std::max(columnPosition, 0.0)), mNumberOfColumns - 2);
+	const iceScalar rowFraction = std::clamp(rowPosition - static_cast<iceScalar>(row), 0.0, 1.0);
+	const iceScalar columnFraction = std::clamp(columnPosition - static_cast<iceScalar>(column), 0.0, 1.0);
+
+	const size_t sampleIndex = row * mNumberOfColumns + column;
+	const iceScalar trailingHeight = Lerp(mRowHeights[sampleIndex], mRowHeights[sampleIndex + 1], columnFraction);
+	const iceScalar leadingHeight = Lerp(mRowHeights[sampleIndex + mNumberOfColumns], mRowHeights[sampleIndex + mNumberOfColumns + 1], columnFraction);
+
+	const size_t nearestIndex = sampleIndex + ((rowFraction < 0.5) ? 0 : mNumberOfColumns) + ((columnFraction < 0.5) ? 0 : 1);
+
+	const CrossSection& trailing = mCrossSections[bestSegment];
+	const CrossSection& leading = mCrossSections[bestSegment + 1];
+	const iceScalar halfWidth = Lerp(trailing.mHalfWidth, leading.mHalfWidth, bestFraction);
+
+	sample.mGroundHeight = Lerp(trailingHeight, leadingHeight, rowFraction);
+	sample.mDistanceAlongTrack = Lerp(trailing.mDistanceAlongTrack, leading.mDistanceAlongTrack, bestFraction);
+	sample.mLateralOffset = bestLateral;
+	sample.mSegmentFraction = bestFraction;
+	sample.mSegmentIndex = bestSegment;
+	sample.mHasSurface = (0 != mRowSurface[nearestIndex]);
+	sample.mIsOnTrack = (true == sample.mHasSurface && std::abs(bestLateral) <= halfWidth);
+	return true;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+bool LudumDare56::GameState::TrackSurfaceTable::LocateInSegment(const SegmentIndex segmentIndex, const iceScalar x,
+	const iceScalar z, iceScalar& fraction, iceScalar& lateral) const
+{
+	const CrossSection& trailing = mCrossSections[segmentIndex];
+	const CrossSection& leading = mCrossSections[segmentIndex + 1];
+
+	//Forward is the right direction turned a quarter to the left, each cross section is a line across the track so
+	//  neighboring segments share a boundary and together cover the bends without any gaps.
+	const iceScalar distanceFromTrailing = (x - trailing.mCenter[0]) * trailing.mRight[1] - (z - trailing.mCenter[2]) * trailing.mRight[0];
+	const iceScalar distanceToLeading = (leading.mCenter[0] - x) * leading.mRight[1] - (leading.mCenter[2] - z) * leading.mRight[0];
+	if (distanceFromTrailing < 0.0 || distanceToLeading < 0.0)
+	{
+		return false;
+	}
+
+	const iceScalar segmentLength = distanceFromTrailing + distanceToLeading;
+	if (segmentLength < kDegenerateEpsilon)
+	{
+		return false;
+	}
+
+	fraction = distanceFromTrailing / segmentLength;
+
+	iceScalar center[3];
+	iceScalar right[2];
+	iceScalar halfWidth = 0.0;
+	iceScalar slope = 0.0;
+	Interpolate(segmentIndex, fraction, center, right, halfWidth, slope);
+
+	lateral = (x - center[0]) * right[0] + (z - center[2]) * right[1];
+	return (std::abs(lateral) <= mLateralExtent);
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void LudumDare56::GameState::TrackSurfaceTable::Interpolate(const SegmentIndex segmentIndex, const iceScalar fraction,
+	iceScalar center[3], iceScalar right[2], iceScalar& halfWidth, iceScalar& slope) const
+{
+	const CrossSection& trailing = mCrossSections[segmentIndex];
+	const CrossSection& leading = mCrossSections[segmentIndex + 1];
+
+	for (size_t axis = 0; axis < 3; ++axis)
+	{
+		center[axis] = Lerp(trailing.mCenter[axis], leading.mCenter[axis], fraction);
+	}
+
+	right[0] = Lerp(trailing.mRight[0], leading.mRight[0], fraction);
+	right[1] = Lerp(trailing.mRight[1], leading.mRight[1], fraction);
+	const iceScalar length = std::sqrt(right[0] * right[0] + right[1] * right[1]);
+	if (length > kDegenerateEpsilon)
+	{
+		right[0] /= length;
+		right[1] /= length;
+	}
+	else
+	{	//The track turned completely around in a single segment, not much else to do than keep the trailing direction.
+		right[0] = trailing.mRight[0];
+		right[1] = trailing.mRight[1];
+	}
+
+	halfWidth = Lerp(trailing.mHalfWidth, leading.mHalfWidth, fraction);
+	slope = Lerp(trailing.mSlope, leading.mSlope, fraction);
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
+
+class TrackSurfaceTableTest : tbCore::UnitTest::TestCaseInterface
+{
+public:
+	TrackSurfaceTableTest(void) :
+		tbCore::UnitTest::TestCaseInterface("TrackSurfaceTableTest")
+	{
+	}
+
+	~TrackSurfaceTableTest(void)
+	{
+	}
+
+protected:
+	virtual bool OnRunTest(void) override
+	{
+		using namespace LudumDare56::GameState;
+
+		TrackSurfaceTable::SurfaceSample sample;
+
+		TrackSurfaceTable table;
+		table.Build(BoundingVolumeHierarchy());
+		ExpectedValue(table.QuerySurface(iceVector3::Zero(), sample), false, "An empty table is expected to never find the surface.");
+
+		RunCircularTrack();
+		RunSlopedSurface();
+
+		return true;
+	}
+
+private:
+	///
+	/// @details Builds a flat ring of track every 10m around a circle, like the TrackNodeEdges, and checks the distance
+	///   along the track, lateral offset and on-track flags of random positions against the exact circle.
+	///
+	void RunCircularTrack(void)
+	{
+		using namespace LudumDare56::GameState;
+
+		const iceScalar kRadius = 100.0;
+		const iceScalar kHalfWidth = 4.75;
+		const iceScalar kTrackHeight = 3.0;
+		const iceScalar kPi = 3.14159265358979323846;
+
+		TrackSurfaceTable table;
+		const size_t numberOfSections = 63;
+		for (size_t index = 0; index <= numberOfSections; ++index)
+		{	//Going around this way the right edge is away from the center of the circle.
+			const iceScalar angle = -2.0 * kPi * static_cast<iceScalar>(index) / static_cast<iceScalar>(numberOfSections);
+			const iceVector3 outward(std::cos(angle), 0.0, std::sin(angle));
+			const iceVector3 center = outward * kRadius + iceVector3(0.0, kTrackHeight, 0.0);
+			table.AddCrossSection(center - outward * kHalfWidth, center, center + outward * kHalfWidth);
+		}
+		table.Build(BoundingVolumeHierarchy());
+
+		ExpectedValue(table.GetNumberOfSegments(), numberOfSections, "Expected a segment between each cross section.");
+
+		TrackSurfaceTable::SurfaceSample sample;
+		ExpectedValue(table.QuerySurface(iceVector3(0.0, kTrackHeight, 0.0), sample), false,
+			"The center of the circle is expected to be far from the track.");
+
+		const iceScalar chordLength = 2.0 * kRadius * std::sin(kPi / static_cast<iceScalar>(numberOfSections));
+		std::mt19937 generator(56);
+		size_t onTrackCount = 0;
+		for (size_t test = 0; test < 2000; ++test)
+		{
+			const iceScalar angle = 2.0 * kPi * static_cast<iceScalar>(generator() % 100000) / 100000.0;
+			const iceScalar offset = (static_cast<iceScalar>(generator() % 100000) / 100000.0 - 0.5) * 12.0;
+			const iceVector3 outward(std::cos(-angle), 0.0, std::sin(-angle));
+			const iceVector3 position = outward * (kRadius + offset) + iceVector3(0.0, kTrackHeight + 0.5, 0.0);
+
+			const bool isFound = table.QuerySurface(position, sample);
+			ExpectedValue(isFound, true, "Expected to find the track at angle %f offset %f.", angle, offset);
+			if (false == isFound)
+			{
+				continue;
+			}
+
+			//The table follows the chords between cross sections, which are inside the circle by at most this much.
+			const iceScalar chordSag = kRadius * (1.0 - std::cos(kPi / static_cast<iceScalar>(numberOfSections)));
+			ExpectedValue(std::abs(sample.mLateralOffset - offset) < chordSag + 0.01, true,
+				"Expected lateral offset %f to be near %f.", sample.mLateralOffset, offset);
+			ExpectedValue(std::abs(sample.mGroundHeight - kTrackHeight) < 1.0e-4, true,
+				"Expected the flat track to be at height %f, not %f.", kTrackHeight, sample.mGroundHeight);
+
+			const iceScalar expectedDistance = angle / (2.0 * kPi) * chordLength * static_cast<iceScalar>(numberOfSections);
+			ExpectedValue(std::abs(sample.mDistanceAlongTrack - expectedDistance) < 0.25, true,
+				"Expected distance along track %f to be near %f.", sample.mDistanceAlongTrack, expectedDistance);
+
+			if (std::abs(offset) < kHalfWidth - chordSag - 0.01)
+			{
+				ExpectedValue(sample.mIsOnTrack, true, "Expected offset %f to be on the track.", offset);
+			}
+			else if (std::abs(offset) > kHalfWidth + 0.6)
+			{
+				ExpectedValue(sample.mIsOnTrack, false, "Expected offset %f to be off the track.", offset);
+				ExpectedValue(sample.mHasSurface, false, "Expected no surface at offset %f.", offset);
+			}
+
+			onTrackCount += (true == sample.mIsOnTrack) ? 1 : 0;
+		}
+
+		ExpectedValue(onTrackCount > 0, true, "Expected some of the positions to be on the track.");
+	}
+
+	///
+	/// @details A straight track on a sloped surface hierarchy that only covers the right side of the track, so the
+	///   heights must come from the surface and there is no surface on the left.
+	///
+	void RunSlopedSurface(void)
+	{
+		using namespace LudumDare56::GameState;
+
+		BoundingVolumeHierarchy surface;
+		const auto slopedPoint = [](const iceScalar x, const iceScalar z) { return iceVector3(x, 1.0 + 0.1 * x - 0.05 * z, z); };
+		surface.AddTriangle(slopedPoint(0.0, 10.0), slopedPoint(20.0, 10.0), slopedPoint(0.0, -110.0));
+		surface.AddTriangle(slopedPoint(20.0, 10.0), slopedPoint(20.0, -110.0), slopedPoint(0.0, -110.0));
+		surface.Build();
+
+		TrackSurfaceTable table;
+		for (int index = 0; index <= 10; ++index)
+		{	//Forward is -Z so right is +X.
+			const iceScalar z = -10.0 * static_cast<iceScalar>(index);
+			table.AddCrossSection(iceVector3(-5.0, 1.0 - 0.05 * z, z), iceVector3(0.0, 1.0 - 0.05 * z, z), iceVector3(5.0, 1.0 - 0.05 * z, z));
+		}
+		table.Build(surface);
+
+		TrackSurfaceTable::SurfaceSample sample;
+		for (int test = 0; test < 200; ++test)
+		{
+			const iceScalar x = 0.6 + 0.03 * static_cast<iceScalar>(test % 100);
+			const iceScalar z = -0.5 * static_cast<iceScalar>(test);
+			ExpectedValue(table.QuerySurface(iceVector3(x, 5.0, z), sample), true, "Expected to find the track at %f, %f.", x, z);
+			ExpectedValue(sample.mHasSurface, true, "Expected the right side to have a surface at %f, %f.", x, z);
+			ExpectedValue(std::abs(sample.mGroundHeight - slopedPoint(x, z).y) < 1.0e-3, true,
+				"Expected height %f at %f, %f not %f.", slopedPoint(x, z).y, x, z, sample.mGroundHeight);
+			const iceScalar expectedDistance = -z * std::sqrt(1.0 + 0.05 * 0.05);
+			ExpectedValue(std::abs(sample.mDistanceAlongTrack - expectedDistance) < 1.0e-6, true,
+				"Expected to be %f along the track, not %f.", expectedDistance, sample.mDistanceAlongTrack);
+		}
+
+		ExpectedValue(table.QuerySurface(iceVector3(-3.0, 5.0, -50.0), sample), true, "Expected to find the left side of the track.");
+		ExpectedValue(sample.mHasSurface, false, "Expected the left side to have no surface.");
+		ExpectedValue(sample.mIsOnTrack, false, "Expected the left side to not be on the track without a surface.");
+		ExpectedValue(table.QuerySurface(iceVector3(9.0, 5.0, -50.0), sample), false, "Expected to be beyond the shoulder.");
+	}
+};
+
+TrackSurfaceTableTest theTrackSurfaceTableTest;
@@ -0,0 +1,119 @@
+///
+/// @file
+/// @details A precomputed table of the ground height and on-track flags of the racetrack in spline-space, so the ground
+///   beneath any position can be found without touching the physical world.
+///
+/// <!-- Copyright (c) 2024 Tyre Bytes LLC - All Rights Reserved -->
+///------------------------------------------------------------------------------------------------------------------///
+
+#ifndef LudumDare56_TrackSurfaceTable_hpp
+#define LudumDare56_TrackSurfaceTable_hpp
+
+#include "../../game_state/helpers/bounding_volume_hierarchy.hpp"
+#include "../../ludumdare56.hpp"
+
+#include <turtle_brains/core/tb_types.hpp>
+
+#include <vector>
+
+namespace LudumDare56::GameState
+{
+
+	///
+	/// @details Cross sections (left, center and right of the track) are added in order along the track, exactly like
+	///   the TrackNodeEdges, then Build() samples the surface between each pair of them into rows (distance along the
+	///   track) and columns (lateral offset from the center line) reaching a shoulder past the track edges. A coarse
+	///   grid over the ground plane keeps the few segments that can touch each cell so a query only looks at a handful
+	///   of segments no matter how long the track is.
+	///
+	/// @note Only Build() allocates, a query never does and any number of threads may query once built.
+	///
+	class TrackSurfaceTable
+	{
+	public:
+		typedef tbCore::uint32 SegmentIndex;
+
+		struct SurfaceSample
+		{
+			iceScalar mGroundHeight;        //Only meaningful when mHasSurface is true.
+			iceScalar mDistanceAlongTrack;  //Meters along the center line from the first cross section.
+			iceScalar mLateralOffset;       //Meters from the center line, positive to the right.
+			iceScalar mSegmentFraction;     //0 at the trailing cross section of the segment to 1 at the leading.
+			SegmentIndex mSegmentIndex;     //Segment N is between cross section N and N+1, matching the TrackNodeIndex, except the
+			                                //  segment closing a circuit which is one past the last TrackNode.
+			bool mHasSurface;
+			bool mIsOnTrack;
+		};
+
+		TrackSurfaceTable(void);
+		~TrackSurfaceTable(void);
+
+		///
+		/// @details Removes all the cross sections and samples, the table will then be empty until built again.
+		///
+		void Clear(void);
+
+		///
+		/// @details Adds the next cross section along the track, the left and right edges are where the track surface
+		///   ends and are expected to be level with, and perpendicular to, the direction of the track.
+		///
+		void AddCrossSection(const iceVector3& left, const iceVector3& center, const iceVector3& right);
+
+		///
+		/// @details Samples the surface of every segment between the cross sections. When the surface hierarchy is not
+		///   empty the heights come from casting rays down at it, and only where it was hit is there surface, otherwise
+		///   the surface is assumed to span flat from the left to the right edge of each cross section.
+		///
+		void Build(const BoundingVolumeHierarchy& surface);
+
+		inline bool IsEmpty(void) const { return mRowHeights.empty(); }
+		inline size_t GetNumberOfSegments(void) const { return (mCrossSections.size() < 2) ? 0 : mCrossSections.size() - 1; }
+		inline size_t GetNumberOfSamples(void) const { return mRowHeights.size(); }
+
+		///
+		/// @details Finds which segment the position is within and interpolates the table at that spot. The height of
+		///   the position is only used to pick between segments that overlap, like a bridge over the track.
+		///
+		/// @return true if the position is within the sampled area of the track, including the shoulders, in which case
+		///   the sample is filled in, otherwise the sample is left alone.
+		///
+		bool QuerySurface(const iceVector3& positionInWorld, SurfaceSample& sample) const;
+
+	private:
+		struct CrossSection
+		{
+			iceScalar mCenter[3];
+			iceScalar mRight[2];       //Flat and normalized direction from the left edge to the right edge.
+			iceScalar mHalfWidth;
+			iceScalar mSlope;          //Rise in height per meter to the right.
+			iceScalar mDistanceAlongTrack;
+		};
+
+		///
+		/// @details Finds the fraction between the trailing and leading cross sections and the lateral offset from the
+		///   center line, returning false if the position is not within the segment and shoulders.
+		///
+		bool LocateInSegment(const SegmentIndex segmentIndex, const iceScalar x, const iceScalar z,
+			iceScalar& fraction, iceScalar& lateral) const;
+
+		void Interpolate(const SegmentIndex segmentIndex, const iceScalar fraction, iceScalar center[3], iceScalar right[2],
+			iceScalar& halfWidth, iceScalar& slope) const;
+
+		std::vector<CrossSection> mCrossSections;
+
+		iceScalar mLateralExtent;
+		size_t mNumberOfColumns;
+		std::vector<float> mRowHeights;           //Row major, mNumberOfColumns per row and kRowsPerSegment per segment.
+		std::vector<tbCore::uint8> mRowSurface;   //Non-zero for each sample that found the surface.
+
+		iceScalar mGridMinimumX;
+		iceScalar mGridMinimumZ;
+		size_t mGridColumns;
+		size_t mGridRows;
+		std::vector<tbCore::uint32> mCellStart;   //Segments of cell N are mCellSegments[mCellStart[N] to mCellStart[N + 1]].
+		std::vector<SegmentIndex> mCellSegments;
+	};
+
+};	//namespace LudumDare56::GameState
+
+#endif /* LudumDare56_TrackSurfaceTable_hpp */
@@ -0,0 +1,49 @@
+///
+/// @file
+/// @details A small physical world for the unit tests of GameState that drive racecars without loading a racetrack.
+///
+/// <!-- Copyright (c) 2024 Tyre Bytes LLC - All Rights Reserved -->
+///------------------------------------------------------------------------------------------------------------------///
+
+#include "../../game_state/implementation/flat_test_world.hpp"
+
+#include <ice/physics/ice_bounding_volumes.hpp>
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+LudumDare56::GameState::Implementation::FlatTestWorld::FlatTestWorld(void) :
+	mPhysicalWorld(new icePhysics::PhysicalWorld()),
+	mGroundBody(-1.0f),
+	mRacecars()
+{
+	mPhysicalWorld->SetGravity(icePhysics::Vector3(0.0f, -10.0f, 0.0f));
+	mGroundBody.AddBoundingVolume(new icePhysics::BoundingPlane(icePhysics::Vector3::Zero(), icePhysics::Vector3(0.0f, 1.0f, 0.0f)));
+	mPhysicalWorld->AddBody(mGroundBody);
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+LudumDare56::GameState::Implementation::FlatTestWorld::~FlatTestWorld(void)
+{
+	for (std::unique_ptr<RacecarState>& racecar : mRacecars)
+	{
+		racecar->Destroy(*mPhysicalWorld);
+	}
+
+	mPhysicalWorld->RemoveBody(&mGroundBody);
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+LudumDare56::GameState::RacecarState& LudumDare56::GameState::Implementation::FlatTestWorld::CreateRacecar(
+	const RacecarState::CreatureIndex::Integer numberOfCreatures, const iceVector3& position)
+{
+	mRacecars.push_back(std::unique_ptr<RacecarState>(new RacecarState()));
+	RacecarState& racecar = *mRacecars.back();
+	racecar.SetRacecarIndex(0);
+	racecar.Create(*mPhysicalWorld, numberOfCreatures);
+	racecar.ResetRacecar(iceMatrix4::Translation(position));
+	return racecar;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
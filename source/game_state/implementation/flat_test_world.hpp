@@ -0,0 +1,58 @@
+///
+/// @file
+/// @details A small physical world for the unit tests of GameState that drive racecars without loading a racetrack.
+///
+/// <!-- Copyright (c) 2024 Tyre Bytes LLC - All Rights Reserved -->
+///------------------------------------------------------------------------------------------------------------------///
+
+#ifndef LudumDare56_FlatTestWorld_hpp
+#define LudumDare56_FlatTestWorld_hpp
+
+#include "../../game_state/racecar_state.hpp"
+#include "../../ludumdare56.hpp"
+
+#include <turtle_brains/core/tb_noncopyable.hpp>
+
+#include <ice/physics/ice_physical_world.hpp>
+#include <ice/physics/ice_rigid_body.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace LudumDare56
+{
+	namespace GameState
+	{
+		namespace Implementation
+		{
+
+			///
+			/// @details A physical world with gravity and an endless flat ground at a height of zero, so the tests need
+			///   nothing from the data directory. Any racecars created are destroyed along with the world.
+			///
+			class FlatTestWorld : public tbCore::Noncopyable
+			{
+			public:
+				FlatTestWorld(void);
+				~FlatTestWorld(void);
+
+				inline icePhysics::World& GetPhysicalWorld(void) { return *mPhysicalWorld; }
+
+				///
+				/// @details Creates a racecar resting on the ground at the position. It is not one of the racecars of the
+				///   session, so nothing else will touch it.
+				///
+				RacecarState& CreateRacecar(const RacecarState::CreatureIndex::Integer numberOfCreatures,
+					const iceVector3& position = iceVector3(0.0, 0.75, 0.0));
+
+			private:
+				std::unique_ptr<icePhysics::World> mPhysicalWorld;
+				icePhysics::RigidBody mGroundBody;
+				std::vector<std::unique_ptr<RacecarState>> mRacecars; //Far too large for the stack.
+			};
+
+		};	//namespace Implementation
+	};	//namespace GameState
+};	//namespace LudumDare56
+
+#endif /* LudumDare56_FlatTestWorld_hpp */
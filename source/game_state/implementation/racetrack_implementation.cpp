@@ -6,9 +6,17 @@
 ///------------------------------------------------------------------------------------------------------------------///
 
 #include "../../game_state/implementation/racetrack_implementation.hpp"
+#include "../../game_state/helpers/ground_probe_batch.hpp"
+#include "../../core/utilities.hpp"
 #include "../../ludumdare56.hpp"
 #include "../../logging.hpp"
 
+#include <turtle_brains/core/unit_test/tb_unit_test.hpp>
+
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+
 namespace LudumDare56
 {
 	namespace GameState
@@ -21,6 +29,41 @@ namespace LudumDare56
 	};	//namespace GameState
 };	//namespace LudumDare56
 
+namespace
+{
+	using namespace TyreBytes::Core::Utilities;
+
+	const tbCore::uint32 kCookedRacetrackMagic = 0x4B525443; //"CTRK" when read as bytes.
+
+	const tbCore::uint64 kHashOffsetBasis = 14695981039346656037ull;
+	const tbCore::uint64 kHashPrime = 1099511628211ull;
+
+	template <typename Type> void WriteArray(const std::vector<Type>& container, std::ofstream& outputFile)
+	{
+		WriteBinary(static_cast<tbCore::uint32>(container.size()), outputFile);
+		WriteBinary(container.data(), container.size() * sizeof(Type), outputFile);
+	}
+
+	///
+	/// @details The count is checked against what remains of the file before anything is allocated, so a truncated
+	///   or corrupt cooked racetrack is rejected instead of trying to read a ridiculous amount.
+	///
+	template <typename Type> bool ReadArray(std::vector<Type>& container, std::ifstream& inputFile, const std::streamoff fileSize)
+	{
+		const tbCore::uint32 count = ReadBinary<tbCore::uint32>(inputFile);
+		const std::streamoff remainingSize = fileSize - static_cast<std::streamoff>(inputFile.tellg());
+		if (false == inputFile.good() || static_cast<std::streamoff>(count * sizeof(Type)) > remainingSize)
+		{
+			return false;
+		}
+
+		container.resize(count);
+		ReadBinary(container.data(), container.size() * sizeof(Type), inputFile);
+		return inputFile.good();
+	}
+
+};	//namespace
+
 //--------------------------------------------------------------------------------------------------------------------//
 
 const LudumDare56::GameState::Implementation::TrackNodeContainer& LudumDare56::GameState::Implementation::TheTrackNodes(void)
@@ -35,3 +78,387 @@ LudumDare56::GameState::Implementation::TrackNodeContainer& LudumDare56::GameSta
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
+
+LudumDare56::GameState::Implementation::TrackNodePlanes LudumDare56::GameState::Implementation::ComputeTrackNodePlanes(
+	const RacetrackState::TrackNodeEdge& leadingEdge, const RacetrackState::TrackNodeEdge& trailingEdge)
+{
+	TrackNodePlanes planes;
+	planes.mLeadingPoint = leadingEdge[TrackEdge::kCenter];
+	planes.mLeadingNormal = icePhysics::Vector3::Cross(Up(), leadingEdge[TrackEdge::kRight] - leadingEdge[TrackEdge::kLeft]);
+	planes.mTrailingPoint = trailingEdge[TrackEdge::kCenter];
+	planes.mTrailingNormal = icePhysics::Vector3::Cross(trailingEdge[TrackEdge::kRight] - trailingEdge[TrackEdge::kLeft], Up());
+	planes.mLeftPoint = leadingEdge[TrackEdge::kLeft];
+	planes.mLeftNormal = icePhysics::Vector3::Cross(Up(), leadingEdge[TrackEdge::kLeft] - trailingEdge[TrackEdge::kLeft]);
+	planes.mRightPoint = leadingEdge[TrackEdge::kRight];
+	planes.mRightNormal = icePhysics::Vector3::Cross(leadingEdge[TrackEdge::kRight] - trailingEdge[TrackEdge::kRight], Up());
+	return planes;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+LudumDare56::GameState::Implementation::TrackNode LudumDare56::GameState::Implementation::CreateTrackNode(const TrackNodePlanes& planes)
+{
+	return TrackNode{ //leading, trailing, left, right
+		icePhysics::BoundingPlane(planes.mLeadingPoint, planes.mLeadingNormal),
+		icePhysics::BoundingPlane(planes.mTrailingPoint, planes.mTrailingNormal),
+		icePhysics::BoundingPlane(planes.mLeftPoint, planes.mLeftNormal),
+		icePhysics::BoundingPlane(planes.mRightPoint, planes.mRightNormal),
+	};
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void LudumDare56::GameState::Implementation::BuildTrackSurface(const std::vector<RacetrackState::TrackNodeEdge>& trackNodeEdges,
+	const BoundingVolumeHierarchy& surface, TrackSurfaceTable& trackSurface)
+{
+	trackSurface.Clear();
+	for (const RacetrackState::TrackNodeEdge& nodeEdge : trackNodeEdges)
+	{
+		trackSurface.AddCrossSection(nodeEdge[TrackEdge::kLeft], nodeEdge[TrackEdge::kCenter], nodeEdge[TrackEdge::kRight]);
+	}
+
+	if (trackNodeEdges.size() > 2)
+	{	//An edge sitting right on top of the first already closes the circuit, and would only add an empty segment.
+		const RacetrackState::TrackNodeEdge& firstEdge = trackNodeEdges.front();
+		const iceScalar circuitGap = static_cast<iceVector3>(trackNodeEdges.back()[TrackEdge::kCenter] - firstEdge[TrackEdge::kCenter]).Magnitude();
+		if (circuitGap > 0.01 && circuitGap < kMaximumCircuitGap)
+		{
+			trackSurface.AddCrossSection(firstEdge[TrackEdge::kLeft], firstEdge[TrackEdge::kCenter], firstEdge[TrackEdge::kRight]);
+		}
+	}
+
+	trackSurface.Build(surface);
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+LudumDare56::String LudumDare56::GameState::Implementation::ToCookedRacetrackFilepath(const String& racetrackFilepath)
+{
+	const String extension = ".trk";
+	if (racetrackFilepath.size() >= extension.size() &&
+		0 == racetrackFilepath.compare(racetrackFilepath.size() - extension.size(), extension.size(), extension))
+	{
+		return racetrackFilepath.substr(0, racetrackFilepath.size() - extension.size()) + ".ctrk";
+	}
+
+	return racetrackFilepath + ".ctrk";
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+tbCore::uint64 LudumDare56::GameState::Implementation::ComputeContentHash(const String& filepath)
+{
+	tbCore::uint64 hash = kHashOffsetBasis;
+	for (const unsigned char byte : LoadBinaryFileContents(filepath))
+	{
+		hash = (hash ^ byte) * kHashPrime;
+	}
+	return hash;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+bool LudumDare56::GameState::Implementation::SaveCookedRacetrack(const String& cookedFilepath, const CookedRacetrack& cookedRacetrack)
+{
+	std::ofstream outputFile(cookedFilepath, std::ios::binary);
+	if (false == outputFile.is_open())
+	{
+		tb_always_log(LogState::Error() << "Failed to open \"" << cookedFilepath << "\" to save the cooked racetrack.");
+		return false;
+	}
+
+	WriteBinary(kCookedRacetrackMagic, outputFile);
+	WriteBinary(kCookedRacetrackVersion, outputFile);
+	WriteBinary(static_cast<tbCore::uint32>(sizeof(iceVector3)), outputFile);
+	WriteBinary(static_cast<tbCore::uint32>(sizeof(RacetrackState::TrackNodeEdge)), outputFile);
+
+	WriteBinary(static_cast<tbCore::uint32>(cookedRacetrack.mDependencies.size()), outputFile);
+	for (const CookedRacetrack::Dependency& dependency : cookedRacetrack.mDependencies)
+	{
+		WriteBinary(static_cast<tbCore::uint32>(dependency.mFilepath.size()), outputFile);
+		WriteBinary(dependency.mFilepath.data(), dependency.mFilepath.size(), outputFile);
+		WriteBinary(dependency.mContentHash, outputFile);
+	}
+
+	WriteArray(cookedRacetrack.mColliderVertices, outputFile);
+	WriteArray(cookedRacetrack.mColliderIndices, outputFile);
+	WriteArray(cookedRacetrack.mTrackNodeEdges, outputFile);
+	WriteArray(cookedRacetrack.mTrackNodePlanes, outputFile);
+
+	return outputFile.good();
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+bool LudumDare56::GameState::Implementation::LoadCookedRacetrack(const String& cookedFilepath, CookedRacetrack& cookedRacetrack)
+{
+	std::ifstream inputFile(cookedFilepath, std::ios::binary);
+	if (false == inputFile.is_open())
+	{
+		tb_always_log(LogState::Info() << "No cooked racetrack at \"" << cookedFilepath << "\", deriving it from the racetrack.");
+		return false;
+	}
+
+	inputFile.seekg(0, std::ios::end);
+	const std::streamoff fileSize = inputFile.tellg();
+	inputFile.seekg(0, std::ios::beg);
+
+	const tbCore::uint32 magic = ReadBinary<tbCore::uint32>(inputFile);
+	const tbCore::uint32 version = ReadBinary<tbCore::uint32>(inputFile);
+	const tbCore::uint32 vectorSize = ReadBinary<tbCore::uint32>(inputFile);
+	const tbCore::uint32 edgeSize = ReadBinary<tbCore::uint32>(inputFile);
+	if (false == inputFile.good() || kCookedRacetrackMagic != magic || kCookedRacetrackVersion != version ||
+		sizeof(iceVector3) != vectorSize || sizeof(RacetrackState::TrackNodeEdge) != edgeSize)
+	{
+		tb_always_log(LogState::Warning() << "Ignoring the cooked racetrack \"" << cookedFilepath << "\", it was cooked by a different version.");
+		return false;
+	}
+
+	const tbCore::uint32 numberOfDependencies = ReadBinary<tbCore::uint32>(inputFile);
+	for (tbCore::uint32 dependencyIndex = 0; dependencyIndex < numberOfDependencies && true == inputFile.good(); ++dependencyIndex)
+	{
+		const tbCore::uint32 filepathLength = ReadBinary<tbCore::uint32>(inputFile);
+		const std::streamoff remainingSize = fileSize - static_cast<std::streamoff>(inputFile.tellg());
+		if (false == inputFile.good() || static_cast<std::streamoff>(filepathLength) > remainingSize)
+		{
+			break;
+		}
+
+		CookedRacetrack::Dependency dependency;
+		dependency.mFilepath.resize(filepathLength);
+		ReadBinary(dependency.mFilepath.data(), filepathLength, inputFile);
+		ReadBinary(dependency.mContentHash, inputFile);
+
+		if (true == inputFile.good() && ComputeContentHash(dependency.mFilepath) != dependency.mContentHash)
+		{
+			tb_always_log(LogState::Info() << "Ignoring the cooked racetrack \"" << cookedFilepath << "\", \"" <<
+				dependency.mFilepath << "\" has changed since it was cooked.");
+			return false;
+		}
+
+		cookedRacetrack.mDependencies.push_back(dependency);
+	}
+
+	if (cookedRacetrack.mDependencies.size() != numberOfDependencies ||
+		false == ReadArray(cookedRacetrack.mColliderVertices, inputFile, fileSize) ||
+		false == ReadArray(cookedRacetrack.mColliderIndices, inputFile, fileSize) ||
+		false == ReadArray(cookedRacetrack.mTrackNodeEdges, inputFile, fileSize) ||
+		false == ReadArray(cookedRacetrack.mTrackNodePlanes, inputFile, fileSize) ||
+		fileSize != static_cast<std::streamoff>(inputFile.tellg()))
+	{
+		tb_always_log(LogState::Warning() << "Ignoring the cooked racetrack \"" << cookedFilepath << "\", it is truncated or corrupt.");
+		return false;
+	}
+
+	for (const tbCore::uint32 vertexIndex : cookedRacetrack.mColliderIndices)
+	{
+		if (vertexIndex >= cookedRacetrack.mColliderVertices.size())
+		{
+			tb_always_log(LogState::Warning() << "Ignoring the cooked racetrack \"" << cookedFilepath << "\", it is truncated or corrupt.");
+			return false;
+		}
+	}
+
+	return true;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
+
+class CookedRacetrackTest : tbCore::UnitTest::TestCaseInterface
+{
+public:
+	CookedRacetrackTest(void) :
+		tbCore::UnitTest::TestCaseInterface("CookedRacetrackTest")
+	{
+	}
+
+	~CookedRacetrackTest(void)
+	{
+	}
+
+protected:
+	virtual bool OnRunTest(void) override
+	{
+		using namespace LudumDare56;
+		using namespace LudumDare56::GameState;
+		using namespace LudumDare56::GameState::Implementation;
+
+		ExpectedValue(ToCookedRacetrackFilepath("data/racetracks/default.trk") == "data/racetracks/default.ctrk", true,
+			"Expected the cooked racetrack to sit beside the racetrack.");
+
+		const String sourceFilepath = GetSaveDirectory() + "cooked_racetrack_test.trk";
+		const String cookedFilepath = ToCookedRacetrackFilepath(sourceFilepath);
+		TyreBytes::Core::Utilities::SaveStringContentToFile(sourceFilepath, "the racetrack as it was cooked");
+
+		CookedRacetrack cooked;
+		cooked.mDependencies.push_back(CookedRacetrack::Dependency{ sourceFilepath, ComputeContentHash(sourceFilepath) });
+		cooked.mColliderVertices = { iceVector3(0.0, 0.0, 0.0), iceVector3(10.0, 0.0, 0.0), iceVector3(0.0, 0.5, -10.0) };
+		cooked.mColliderIndices = { 0, 1, 2 };
+
+		RacetrackState::TrackNodeEdge nodeEdge;
+		for (int index = 0; index < 3; ++index)
+		{
+			const float z = -10.0f * static_cast<float>(index);
+			nodeEdge[TrackEdge::kLeft] = Vector3(-4.75f, 0.0f, z);
+			nodeEdge[TrackEdge::kCenter] = Vector3(0.0f, 0.0f, z);
+			nodeEdge[TrackEdge::kRight] = Vector3(4.75f, 0.0f, z);
+			cooked.mTrackNodeEdges.push_back(nodeEdge);
+
+			if (index > 0)
+			{
+				cooked.mTrackNodePlanes.push_back(ComputeTrackNodePlanes(cooked.mTrackNodeEdges[index], cooked.mTrackNodeEdges[index - 1]));
+			}
+		}
+
+		ExpectedValue(SaveCookedRacetrack(cookedFilepath, cooked), true, "Expected to save the cooked racetrack.");
+
+		CookedRacetrack loaded;
+		ExpectedValue(LoadCookedRacetrack(cookedFilepath, loaded), true, "Expected to load the cooked racetrack.");
+		ExpectedValue(loaded.mColliderIndices == cooked.mColliderIndices, true, "Expected the collider indices to match.");
+		ExpectedValue(loaded.mColliderVertices.size() == cooked.mColliderVertices.size(), true, "Expected every collider vertex to be loaded.");
+		ExpectedValue(loaded.mTrackNodeEdges.size() == cooked.mTrackNodeEdges.size(), true, "Expected every TrackNodeEdge to be loaded.");
+		ExpectedValue(loaded.mTrackNodePlanes.size() == cooked.mTrackNodePlanes.size(), true, "Expected the planes of every TrackNode to be loaded.");
+
+		for (size_t index = 0; index < loaded.mColliderVertices.size() && index < cooked.mColliderVertices.size(); ++index)
+		{
+			const iceVector3& actual = loaded.mColliderVertices[index];
+			const iceVector3& expected = cooked.mColliderVertices[index];
+			ExpectedValue(actual.x == expected.x && actual.y == expected.y && actual.z == expected.z, true,
+				"Expected collider vertex %d to match.", static_cast<int>(index));
+		}
+
+		for (size_t index = 0; index < loaded.mTrackNodePlanes.size() && index < cooked.mTrackNodePlanes.size(); ++index)
+		{
+			const iceVector3& actual = loaded.mTrackNodePlanes[index].mLeftNormal;
+			const iceVector3& expected = cooked.mTrackNodePlanes[index].mLeftNormal;
+			ExpectedValue(actual.x == expected.x && actual.y == expected.y && actual.z == expected.z, true,
+				"Expected the left plane of TrackNode %d to match.", static_cast<int>(index));
+		}
+
+		for (size_t index = 0; index < loaded.mTrackNodeEdges.size() && index < cooked.mTrackNodeEdges.size(); ++index)
+		{
+			const Vector3& actual = loaded.mTrackNodeEdges[index][TrackEdge::kRight];
+			const Vector3& expected = cooked.mTrackNodeEdges[index][TrackEdge::kRight];
+			ExpectedValue(actual.x == expected.x && actual.y == expected.y && actual.z == expected.z, true,
+				"Expected the right edge of TrackNodeEdge %d to match.", static_cast<int>(index));
+		}
+
+		{	//Chop the end off the cooked racetrack, which must then be ignored.
+			const std::vector<unsigned char> contents = TyreBytes::Core::Utilities::LoadBinaryFileContents(cookedFilepath);
+			std::ofstream truncatedFile(cookedFilepath, std::ios::binary);
+			TyreBytes::Core::Utilities::WriteBinary(contents.data(), contents.size() - 4, truncatedFile);
+		}
+
+		loaded = CookedRacetrack();
+		ExpectedValue(LoadCookedRacetrack(cookedFilepath, loaded), false, "Expected a truncated cooked racetrack to be ignored.");
+
+		ExpectedValue(SaveCookedRacetrack(cookedFilepath, cooked), true, "Expected to save the cooked racetrack again.");
+		TyreBytes::Core::Utilities::SaveStringContentToFile(sourceFilepath, "the racetrack after it was edited");
+		loaded = CookedRacetrack();
+		ExpectedValue(LoadCookedRacetrack(cookedFilepath, loaded), false, "Expected the cooked racetrack to be stale once the racetrack changed.");
+
+		std::remove(cookedFilepath.c_str());
+		std::remove(sourceFilepath.c_str());
+		return true;
+	}
+};
+
+CookedRacetrackTest theCookedRacetrackTest;
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+class TrackSurfaceCircuitTest : tbCore::UnitTest::TestCaseInterface
+{
+public:
+	TrackSurfaceCircuitTest(void) :
+		tbCore::UnitTest::TestCaseInterface("TrackSurfaceCircuitTest")
+	{
+	}
+
+	~TrackSurfaceCircuitTest(void)
+	{
+	}
+
+protected:
+	virtual bool OnRunTest(void) override
+	{
+		using namespace LudumDare56;
+		using namespace LudumDare56::GameState;
+		using namespace LudumDare56::GameState::Implementation;
+
+		const float kRadius = 100.0f;
+		const float kHalfTrackWidth = 4.75f;
+		const float kNodeSpacing = 10.0f;
+		const float kTrackHeight = 2.0f;
+		const float kPi = 3.14159265358979323846f;
+		const float circumference = 2.0f * kPi * kRadius;
+
+		//Just like OnCreateTrackSpline(), the edges are every 10m along the circuit and the last stops short of the first.
+		std::vector<RacetrackState::TrackNodeEdge> trackNodeEdges;
+		for (float distance = 0.0f; distance < circumference; distance += kNodeSpacing)
+		{
+			const float angle = distance / kRadius;
+			const Vector3 center(kRadius * std::cos(angle), kTrackHeight, kRadius * std::sin(angle));
+			const Vector3 tangent(-std::sin(angle), 0.0f, std::cos(angle));
+			const Vector3 trackRightHalfWidth = Vector3::Cross(tangent, Vector3(0.0f, 1.0f, 0.0f)).GetNormalized() * kHalfTrackWidth;
+
+			RacetrackState::TrackNodeEdge nodeEdge;
+			nodeEdge.fill(center);
+			nodeEdge[TrackEdge::kRight] = center + trackRightHalfWidth;
+			nodeEdge[TrackEdge::kLeft] = center - trackRightHalfWidth;
+			trackNodeEdges.push_back(nodeEdge);
+		}
+
+		BoundingVolumeHierarchy surface;
+		{	//A flat ground much larger than the circuit, so the collider is beneath every spot checked below.
+			const iceScalar kGroundSize = 500.0;
+			surface.AddTriangle(iceVector3(-kGroundSize, kTrackHeight, -kGroundSize), iceVector3(kGroundSize, kTrackHeight, -kGroundSize),
+				iceVector3(-kGroundSize, kTrackHeight, kGroundSize));
+			surface.AddTriangle(iceVector3(kGroundSize, kTrackHeight, -kGroundSize), iceVector3(kGroundSize, kTrackHeight, kGroundSize),
+				iceVector3(-kGroundSize, kTrackHeight, kGroundSize));
+			surface.Build();
+		}
+
+		TrackSurfaceTable trackSurface;
+		BuildTrackSurface(trackNodeEdges, surface, trackSurface);
+		ExpectedValue(trackSurface.GetNumberOfSegments() == trackNodeEdges.size(), true,
+			"Expected a segment between each TrackNodeEdge and one more across the start/finish.");
+
+		const float lastAngle = static_cast<float>(trackNodeEdges.size() - 1) * kNodeSpacing / kRadius;
+		TrackSurfaceTable::SurfaceSample sample;
+		for (int step = 0; step <= 20; ++step)
+		{	//From the last edge, across the seam and onto the first segment.
+			const float angle = lastAngle + (2.0f * kPi + 0.05f - lastAngle) * static_cast<float>(step) / 20.0f;
+			for (const float offset : { -3.0f, 0.0f, 3.0f })
+			{
+				const iceVector3 position((kRadius + offset) * std::cos(angle), kTrackHeight + 0.5f, (kRadius + offset) * std::sin(angle));
+				const bool isFound = trackSurface.QuerySurface(position, sample);
+				ExpectedValue(isFound && sample.mIsOnTrack, true, "Expected the track at angle %f offset %f across the start/finish.",
+					static_cast<double>(angle), static_cast<double>(offset));
+			}
+		}
+
+		{	//Beyond the shoulders the table has nothing, so those probes must be left for the racetrack collider.
+			GroundProbeBatch groundProbes(2.0, 2.10);
+			groundProbes.Reset(2);
+			groundProbes.AddProbe(0, iceVector3(kRadius, kTrackHeight + 0.01, 0.0));
+			groundProbes.AddProbe(1, iceVector3(kRadius + 12.0, kTrackHeight + 0.01, 0.0));
+
+			groundProbes.CastProbes(trackSurface);
+			ExpectedValue(groundProbes.GetResult(0) == GroundProbeBatch::kHitGround, true, "Expected the table to find the track.");
+			ExpectedValue(groundProbes.GetNumberOfProbes() == 1, true, "Expected only the probe beyond the table to remain.");
+
+			groundProbes.CastProbes(surface);
+			ExpectedValue(groundProbes.GetResult(1) == GroundProbeBatch::kHitGround, true,
+				"Expected the collider beyond the shoulders to be found once the table had no answer.");
+		}
+
+		return true;
+	}
+};
+
+TrackSurfaceCircuitTest theTrackSurfaceCircuitTest;
@@ -8,6 +8,11 @@
 #ifndef LudumDare56_RacetrackImplementation_hpp
 #define LudumDare56_RacetrackImplementation_hpp
 
+#include "../../game_state/racetrack_state.hpp"
+#include "../../ludumdare56.hpp"
+
+#include <turtle_brains/core/tb_types.hpp>
+
 #include <ice/physics/ice_bounding_volumes.hpp>
 
 #include <vector>
@@ -32,6 +37,80 @@ namespace LudumDare56
 			const TrackNodeContainer& TheTrackNodes(void);
 			TrackNodeContainer& TheMutableTrackNodes(void);
 
+			///
+			/// @details The point and normal of each BoundingPlane in a TrackNode, which is what gets cooked since the
+			///   planes themselves are only ever created from a point and normal.
+			///
+			struct TrackNodePlanes
+			{
+				iceVector3 mLeadingPoint;
+				iceVector3 mLeadingNormal;
+				iceVector3 mTrailingPoint;
+				iceVector3 mTrailingNormal;
+				iceVector3 mLeftPoint;
+				iceVector3 mLeftNormal;
+				iceVector3 mRightPoint;
+				iceVector3 mRightNormal;
+			};
+
+			TrackNodePlanes ComputeTrackNodePlanes(const RacetrackState::TrackNodeEdge& leadingEdge, const RacetrackState::TrackNodeEdge& trailingEdge);
+			TrackNode CreateTrackNode(const TrackNodePlanes& planes);
+
+			///
+			/// @details Fills the table with a cross section for each TrackNodeEdge and builds it against the surface.
+			///   The TrackNodeEdges of a circuit stop short of where they started, so when the last edge is within
+			///   kMaximumCircuitGap of the first, the first edge is added again to give the start/finish a segment.
+			///
+			void BuildTrackSurface(const std::vector<RacetrackState::TrackNodeEdge>& trackNodeEdges,
+				const BoundingVolumeHierarchy& surface, TrackSurfaceTable& trackSurface);
+
+			static const iceScalar kMaximumCircuitGap(15.0);
+
+			///
+			/// @details Everything RacetrackState derives from a racetrack file that is slow to derive again; the collider
+			///   from the spline mesh, the TrackNodeEdges and the planes of each TrackNode. It is cooked offline with
+			///   --cook_racetracks into a .ctrk file beside the .trk and loaded as-is when the files it was cooked from,
+			///   the dependencies, still hash the same.
+			///
+			/// @note Bump kCookedRacetrackVersion whenever the way any of this gets derived, or the layout, changes.
+			///
+			struct CookedRacetrack
+			{
+				struct Dependency
+				{
+					String mFilepath;
+					tbCore::uint64 mContentHash;
+				};
+
+				std::vector<Dependency> mDependencies;
+				std::vector<iceVector3> mColliderVertices;
+				std::vector<tbCore::uint32> mColliderIndices;
+				std::vector<RacetrackState::TrackNodeEdge> mTrackNodeEdges;
+				std::vector<TrackNodePlanes> mTrackNodePlanes;
+			};
+
+			static const tbCore::uint32 kCookedRacetrackVersion(1);
+
+			///
+			/// @details Returns the filepath of the cooked racetrack beside the racetrack, data/racetracks/name.ctrk for
+			///   data/racetracks/name.trk.
+			///
+			String ToCookedRacetrackFilepath(const String& racetrackFilepath);
+
+			///
+			/// @details Hashes the contents of the file, a missing file hashes the same as an empty one.
+			///
+			tbCore::uint64 ComputeContentHash(const String& filepath);
+
+			bool SaveCookedRacetrack(const String& cookedFilepath, const CookedRacetrack& cookedRacetrack);
+
+			///
+			/// @details Returns true only when the cooked racetrack exists, matches the version and layout of this build
+			///   and every dependency still hashes the same as when it was cooked. Anything else returns false and the
+			///   racetrack should be derived from the racetrack file instead.
+			///
+			bool LoadCookedRacetrack(const String& cookedFilepath, CookedRacetrack& cookedRacetrack);
+
 		};	//namespace Implementation
 	};	//namespace GameState
 };	//namespace LudumDare56
@@ -6,7 +6,7 @@
 ///------------------------------------------------------------------------------------------------------------------///
 
 #include "../../game_state/physics/model_extreme_drifting.hpp"
-#include "../../game_state/helpers/torque_curve.hpp"
+#include "../../game_state/physics/wheel_torque_table.hpp"
 #include "../../game_state/racecar_controller_interface.hpp"
 
 namespace
@@ -40,7 +40,7 @@ namespace
 //--------------------------------------------------------------------------------------------------------------------//
 
 LudumDare56::GameState::PhysicsModels::ExtremeDriftingPhysicsModel::ExtremeDriftingPhysicsModel(icePhysics::World& physicalWorld) :
-	RaycastVehiclePhysicsModelInterface(physicalWorld, DefaultVehicle()),
+	RaycastVehiclePhysicsModelInterface(physicalWorld, DefaultVehicle(), PhysicsModel::ExtremeDrifting),
 	mEngineSpeed(0.0),
 
 	mPreviousVelocity(iceVector3::Zero()),
@@ -87,8 +87,6 @@ void LudumDare56::GameState::PhysicsModels::ExtremeDriftingPhysicsModel::OnReset
 
 void LudumDare56::GameState::PhysicsModels::ExtremeDriftingPhysicsModel::OnSimulate(const RacecarControllerInterface& racecarController)
 {
-	RaycastVehiclePhysicsModelInterface::OnSimulate(racecarController);
-
 	mEngineSpeed = mGearBox.SimulateGearBox(mEngineSpeed, kWheelRadius, *this, racecarController);
 	SimulateTireGrip(racecarController);
 	SimulateFizzics(racecarController);
@@ -105,6 +103,46 @@ void LudumDare56::GameState::PhysicsModels::ExtremeDriftingPhysicsModel::OnDebug
 
 //--------------------------------------------------------------------------------------------------------------------//
 
+void LudumDare56::GameState::PhysicsModels::ExtremeDriftingPhysicsModel::OnSaveState(PhysicsModelState& state) const
+{
+	RaycastVehiclePhysicsModelInterface::OnSaveState(state);
+
+	state.mEngineSpeed = mEngineSpeed;
+	state.mPreviousVelocity = mPreviousVelocity;
+	state.mCurrentGear = mGearBox.mCurrentGear;
+	state.mCanShift = mGearBox.mCanShift;
+
+	state.mBodyTilterVelocity = mBodyTilter.mPreviousVelocity;
+	state.mBodyToVehicle = mBodyTilter.mBodyToVehicle;
+	state.mBodyRoll = mBodyTilter.mBodyRoll;
+	state.mBodyPitch = mBodyTilter.mBodyPitch;
+
+	state.mDriftEndedTimer = mDriftEndedTimer;
+	state.mIsHandbrakePulled = mIsHandbrakePulled;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void LudumDare56::GameState::PhysicsModels::ExtremeDriftingPhysicsModel::OnRestoreState(const PhysicsModelState& state)
+{
+	RaycastVehiclePhysicsModelInterface::OnRestoreState(state);
+
+	mEngineSpeed = state.mEngineSpeed;
+	mPreviousVelocity = state.mPreviousVelocity;
+	mGearBox.mCurrentGear = state.mCurrentGear;
+	mGearBox.mCanShift = state.mCanShift;
+
+	mBodyTilter.mPreviousVelocity = state.mBodyTilterVelocity;
+	mBodyTilter.mBodyToVehicle = state.mBodyToVehicle;
+	mBodyTilter.mBodyRoll = state.mBodyRoll;
+	mBodyTilter.mBodyPitch = state.mBodyPitch;
+
+	mDriftEndedTimer = state.mDriftEndedTimer;
+	mIsHandbrakePulled = state.mIsHandbrakePulled;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
 icePhysics::Angle LudumDare56::GameState::PhysicsModels::ExtremeDriftingPhysicsModel::GetSteeringAngle(
 	const iceScalar steeringInput, const iceScalar vehicleGroundSpeed)
 {	//TODO: LudumDare56: Physics: This is definitely NOT a good way to figure out the steering angle, based off Rally of Rockets.
@@ -120,7 +158,7 @@ icePhysics::Angle LudumDare56::GameState::PhysicsModels::ExtremeDriftingPhysicsM
 
 icePhysics::Angle LudumDare56::GameState::PhysicsModels::ExtremeDriftingPhysicsModel::CalculateDriftAngle(void) const
 {
-	const iceVector3 vehicleForward = -mPhysicalVehicle.GetVehicleToWorld().GetBasis(2);
+	const iceVector3 vehicleForward = -GetVehicleToWorld().GetBasis(2);
 	return vehicleForward.AngleTo(GetLinearVelocity());
 }
 
@@ -131,7 +169,7 @@ void LudumDare56::GameState::PhysicsModels::ExtremeDriftingPhysicsModel::Simulat
 	icePhysics::RaycastVehicle& racecar = mPhysicalVehicle;
 
 	icePhysics::RigidBody& rigidBody = *racecar.HackyAPI_GetRigidBody();
-	const iceVector3 vehicleGroundVelocity(rigidBody.GetLinearVelocity().x, 0.0f, rigidBody.GetLinearVelocity().z);
+	const iceVector3 vehicleGroundVelocity(GetLinearVelocity().x, 0.0f, GetLinearVelocity().z);
 	const iceScalar vehicleGroundSpeed = vehicleGroundVelocity.Magnitude();
 
 	iceScalar throttle = racecarController.GetThrottlePercentage();
@@ -172,17 +210,17 @@ void LudumDare56::GameState::PhysicsModels::ExtremeDriftingPhysicsModel::Simulat
 		const iceVector3 lateralGroundVelocity = carRight * Vector3::Dot(carRight, vehicleGroundVelocity);
 		//const iceVector3 lateralGroundVelocity = (vehicleGroundVelocity - forwardGroundVelocity);
 
-		iceVector3 linearVelocity = mPhysicalVehicle.GetLinearVelocity();
-		//linearVelocity -= forwardGroundVelocity * 0.35f * kFixedTime; //Forward drag applied elsewhere?
-		linearVelocity -= lateralGroundVelocity * 1.35f * kFixedTime;
+		iceVector3 linearVelocity = GetLinearVelocity();
+		//linearVelocity -= forwardGroundVelocity * 0.35f * FixedTime(); //Forward drag applied elsewhere?
+		linearVelocity -= lateralGroundVelocity * 1.35f * FixedTime();
 
-		//linearVelocity -= lateralGroundVelocity.GetNormalized() * tbMath::Minimum(0.0, lateralGroundVelocity.Magnitude() * 10.0f * kFixedTime);
-		mPhysicalVehicle.SetLinearVelocity(linearVelocity);
+		//linearVelocity -= lateralGroundVelocity.GetNormalized() * tbMath::Minimum(0.0, lateralGroundVelocity.Magnitude() * 10.0f * FixedTime());
+		SetLinearVelocity(linearVelocity);
 
 		const iceScalar topSpeed = tbMath::Convert::MileHourToMeterSecond(65.0f);
 		const iceAngle rotationAngle = -tbMath::Clamp(vehicleGroundSpeed / topSpeed, iceScalar(0.0), iceScalar(1.0)) *
-			racecarController.GetSteeringPercentage() * iceAngle::Degrees(180.0) * kFixedTime;
-		mPhysicalVehicle.SetVehicleToWorld(iceMatrix4::RotationY(rotationAngle) * mPhysicalVehicle.GetVehicleToWorld());
+			racecarController.GetSteeringPercentage() * iceAngle::Degrees(180.0) * FixedTime();
+		SetVehicleToWorld(iceMatrix4::RotationY(rotationAngle) * GetVehicleToWorld());
 	}
 
 	//NOTE: 2022-08-13: We negate the steering percentage because the steering wheel rotates around the positive up
@@ -196,18 +234,16 @@ void LudumDare56::GameState::PhysicsModels::ExtremeDriftingPhysicsModel::Simulat
 	const iceScalar fluidDensity = iceScalar(1.225);     //kg/meters^3 (Air Density at Sea Level)
 	const iceScalar dragCoefficient = iceScalar(0.37);   //Miata 1999 drag coefficient is 0.37
 	const iceScalar frontalArea = iceScalar(1.7113);     //meters^2 Miata NA frontalArea
-	const iceScalar speedSquared = rigidBody.GetLinearVelocity().MagnitudeSquared();
+	const iceScalar speedSquared = GetLinearVelocity().MagnitudeSquared();
 	const iceScalar dragForce = iceScalar(0.5) * fluidDensity * speedSquared * dragCoefficient * frontalArea;
-	rigidBody.ApplyForce(-rigidBody.GetLinearVelocity().GetNormalized() * dragForce);
+	ApplyForce(-GetLinearVelocity().GetNormalized() * dragForce);
 
 	if (true == isOnThrottle && mEngineSpeed < kEngineRevLimiter)
 	{
 		const iceScalar clampedEngineSpeed = tbMath::Clamp(mEngineSpeed, iceScalar(800), iceScalar(8500));
-		TorqueCurve torqueCurve = TorqueCurve::MiataTorqueCurve();
-
 		const iceScalar driftTorque = (true == IsDrifting()) ? iceScalar(2.0) : iceScalar(1.0);
-		const iceScalar engineTorque = throttle * torqueCurve.GetOutputTorque(clampedEngineSpeed) * driftTorque;
-		const iceScalar wheelTorque = mGearBox.CalculateWheelTorque(engineTorque, GetShifterPosition());
+		const iceScalar wheelTorque = throttle * driftTorque *
+			WheelTorqueTable::Miata().GetWheelTorque(GetShifterPosition(), clampedEngineSpeed);
 		const iceScalar torquePerWheel(wheelTorque / 2.0); //Nm
 
 		racecar.SetEngineTorque(2, torquePerWheel);
@@ -232,19 +268,19 @@ void LudumDare56::GameState::PhysicsModels::ExtremeDriftingPhysicsModel::Simulat
 		const iceScalar vehicleMass = rigidBody.GetMass();
 		const iceScalar rollingResistanceCoefficient = 0.02f; //ordinary car tire on new-ish asphalt.
 		const iceScalar weight = 10.0f * vehicleMass;
-		rigidBody.ApplyForce(-vehicleGroundVelocity.GetNormalized() * weight * rollingResistanceCoefficient);
+		ApplyForce(-vehicleGroundVelocity.GetNormalized() * weight * rollingResistanceCoefficient);
 	}
 
 	if (vehicleGroundSpeed < 0.001f && (false == isOnThrottle))
 	{
-		iceVector3 stoppedOnGround(iceScalar(0.0), iceScalar(rigidBody.GetLinearVelocity().y), iceScalar(0.0));
-		rigidBody.SetLinearVelocity(stoppedOnGround);
+		iceVector3 stoppedOnGround(iceScalar(0.0), iceScalar(GetLinearVelocity().y), iceScalar(0.0));
+		SetLinearVelocity(stoppedOnGround);
 	}
 
 	//This keeps the racecar from turning very slightly forever after releasing steering.
-	if (rigidBody.GetAngularVelocity().Magnitude() < iceScalar(0.1))
+	if (GetAngularVelocity().Magnitude() < iceScalar(0.1))
 	{
-		rigidBody.SetAngularVelocity(icePhysics::Vector3::Zero());
+		SetAngularVelocity(icePhysics::Vector3::Zero());
 	}
 }
 
@@ -336,7 +372,7 @@ void LudumDare56::GameState::PhysicsModels::ExtremeDriftingPhysicsModel::Simulat
 
 	//If this chunk gets uncommented, we may conflict/issues with previous = current velocity, see SimulateBodyRoll()
 	//const iceVector3 currentVelocity = GetLinearVelocity();
-	//const iceVector3 acceleration = (currentVelocity - mPreviousVelocity) / kFixedTime;
+	//const iceVector3 acceleration = (currentVelocity - mPreviousVelocity) / FixedTime();
 	//const iceVector3 accelerationVehicle = GetVehicleToWorld().FastInverse().TransformNormal(acceleration);
 	//mPreviousVelocity = currentVelocity;
 
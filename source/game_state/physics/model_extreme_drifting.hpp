@@ -17,7 +17,7 @@
 namespace LudumDare56::GameState::PhysicsModels
 {
 
-	class ExtremeDriftingPhysicsModel : public RaycastVehiclePhysicsModelInterface
+	class ExtremeDriftingPhysicsModel final : public RaycastVehiclePhysicsModelInterface
 	{
 	public:
 		ExtremeDriftingPhysicsModel(icePhysics::World& physicalWorld);
@@ -29,10 +29,14 @@ namespace LudumDare56::GameState::PhysicsModels
 		inline virtual Gear GetShifterPosition(void) const override { return mGearBox.mCurrentGear; }
 
 	protected:
+		friend class PhysicsModelBatch;
+
 		bool IsDrifting(void) const { return (true == mIsHandbrakePulled || false == mDriftEndedTimer.IsZero()); }
 		virtual void OnResetRacecarForces(void) override;
 		virtual void OnSimulate(const RacecarControllerInterface& racecarController) override;
 		virtual void OnDebugRender(void) const override;
+		virtual void OnSaveState(PhysicsModelState& state) const override;
+		virtual void OnRestoreState(const PhysicsModelState& state) override;
 
 	private:
 		static iceAngle GetSteeringAngle(const iceScalar steeringInput, const iceScalar vehicleGroundSpeed);
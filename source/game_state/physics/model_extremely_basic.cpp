@@ -6,7 +6,7 @@
 ///------------------------------------------------------------------------------------------------------------------///
 
 #include "../../game_state/physics/model_extremely_basic.hpp"
-#include "../../game_state/helpers/torque_curve.hpp"
+#include "../../game_state/physics/wheel_torque_table.hpp"
 #include "../../game_state/racecar_controller_interface.hpp"
 
 namespace
@@ -45,7 +45,7 @@ namespace
 //--------------------------------------------------------------------------------------------------------------------//
 
 LudumDare56::GameState::PhysicsModels::ExtremelyBasicsPhysicsModel::ExtremelyBasicsPhysicsModel(icePhysics::World& physicalWorld) :
-	RaycastVehiclePhysicsModelInterface(physicalWorld, DefaultVehicle()),
+	RaycastVehiclePhysicsModelInterface(physicalWorld, DefaultVehicle(), PhysicsModel::ExtremelyBasic),
 	mEngineSpeed(0.0),
 	mGearBox(Gear::Third)
 {
@@ -84,8 +84,6 @@ void LudumDare56::GameState::PhysicsModels::ExtremelyBasicsPhysicsModel::OnReset
 
 void LudumDare56::GameState::PhysicsModels::ExtremelyBasicsPhysicsModel::OnSimulate(const RacecarControllerInterface& racecarController)
 {
-	RaycastVehiclePhysicsModelInterface::OnSimulate(racecarController);
-
 	mEngineSpeed = mGearBox.SimulateGearBox(mEngineSpeed, kWheelRadius, *this, racecarController);
 	SimulateTireGrip(racecarController);
 	SimulateFizzics(racecarController);
@@ -100,6 +98,30 @@ void LudumDare56::GameState::PhysicsModels::ExtremelyBasicsPhysicsModel::OnDebug
 
 //--------------------------------------------------------------------------------------------------------------------//
 
+void LudumDare56::GameState::PhysicsModels::ExtremelyBasicsPhysicsModel::OnSaveState(PhysicsModelState& state) const
+{
+	RaycastVehiclePhysicsModelInterface::OnSaveState(state);
+
+	state.mEngineSpeed = mEngineSpeed;
+	state.mPreviousVelocity = mPreviousVelocity;
+	state.mCurrentGear = mGearBox.mCurrentGear;
+	state.mCanShift = mGearBox.mCanShift;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void LudumDare56::GameState::PhysicsModels::ExtremelyBasicsPhysicsModel::OnRestoreState(const PhysicsModelState& state)
+{
+	RaycastVehiclePhysicsModelInterface::OnRestoreState(state);
+
+	mEngineSpeed = state.mEngineSpeed;
+	mPreviousVelocity = state.mPreviousVelocity;
+	mGearBox.mCurrentGear = state.mCurrentGear;
+	mGearBox.mCanShift = state.mCanShift;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
 icePhysics::Angle LudumDare56::GameState::PhysicsModels::ExtremelyBasicsPhysicsModel::GetSteeringAngle(
 	const iceScalar steeringInput, const iceScalar vehicleGroundSpeed)
 {	//TODO: LudumDare56: Physics: This is definitely NOT a good way to figure out the steering angle, based off Rally of Rockets.
@@ -121,7 +143,7 @@ void LudumDare56::GameState::PhysicsModels::ExtremelyBasicsPhysicsModel::Simulat
 	//const Scalar forwardSpeed = Vector3::Dot(vehicleForwardDirection, GetLinearVelocity());
 
 	icePhysics::RigidBody& rigidBody = *racecar.HackyAPI_GetRigidBody();
-	const iceVector3 vehicleGroundVelocity(rigidBody.GetLinearVelocity().x, 0.0f, rigidBody.GetLinearVelocity().z);
+	const iceVector3 vehicleGroundVelocity(GetLinearVelocity().x, 0.0f, GetLinearVelocity().z);
 	const iceScalar vehicleGroundSpeed = vehicleGroundVelocity.Magnitude();
 
 	iceScalar throttle = racecarController.GetThrottlePercentage();
@@ -153,9 +175,9 @@ void LudumDare56::GameState::PhysicsModels::ExtremelyBasicsPhysicsModel::Simulat
 	const iceScalar fluidDensity = iceScalar(1.225);     //kg/meters^3 (Air Density at Sea Level)
 	const iceScalar dragCoefficient = iceScalar(0.37);   //Miata 1999 drag coefficient is 0.37
 	const iceScalar frontalArea = iceScalar(1.7113);     //meters^2 Miata NA frontalArea
-	const iceScalar speedSquared = rigidBody.GetLinearVelocity().MagnitudeSquared();
+	const iceScalar speedSquared = GetLinearVelocity().MagnitudeSquared();
 	const iceScalar dragForce = iceScalar(0.5) * fluidDensity * speedSquared * dragCoefficient * frontalArea;
-	rigidBody.ApplyForce(-rigidBody.GetLinearVelocity().GetNormalized() * dragForce);
+	ApplyForce(-GetLinearVelocity().GetNormalized() * dragForce);
 
 	//Attempting to setup more slippery physics... at least on the rear end - absolutely uncontrollable; use CreateRearTyreCurve().
 	for (size_t wheelIndex = 0; wheelIndex < 4; ++wheelIndex)
@@ -173,10 +195,7 @@ void LudumDare56::GameState::PhysicsModels::ExtremelyBasicsPhysicsModel::Simulat
 		if (mEngineSpeed < kEngineRevLimiter)
 		{
 			const iceScalar clampedEngineSpeed = tbMath::Clamp(mEngineSpeed, iceScalar(800), iceScalar(8500));
-			TorqueCurve torqueCurve = TorqueCurve::MiataTorqueCurve();
-
-			const iceScalar engineTorque = throttle * torqueCurve.GetOutputTorque(clampedEngineSpeed);
-			const iceScalar wheelTorque = mGearBox.CalculateWheelTorque(engineTorque, GetShifterPosition());
+			const iceScalar wheelTorque = throttle * WheelTorqueTable::Miata().GetWheelTorque(GetShifterPosition(), clampedEngineSpeed);
 			const iceScalar torquePerWheel(wheelTorque / 2.0); //Nm
 
 			racecar.SetEngineTorque(2, torquePerWheel);
@@ -200,19 +219,19 @@ void LudumDare56::GameState::PhysicsModels::ExtremelyBasicsPhysicsModel::Simulat
 	{
 		const iceScalar rollingResistanceCoefficient = 0.02f; //ordinary car tire on new-ish asphalt.
 		const iceScalar weight = 10.0f * vehicleMass;
-		rigidBody.ApplyForce(-vehicleGroundVelocity.GetNormalized() * weight * rollingResistanceCoefficient);
+		ApplyForce(-vehicleGroundVelocity.GetNormalized() * weight * rollingResistanceCoefficient);
 	}
 
 	if (vehicleGroundSpeed < 0.001f && (false == isOnThrottle))
 	{
-		iceVector3 stoppedOnGround(iceScalar(0.0), iceScalar(rigidBody.GetLinearVelocity().y), iceScalar(0.0));
-		rigidBody.SetLinearVelocity(stoppedOnGround);
+		iceVector3 stoppedOnGround(iceScalar(0.0), iceScalar(GetLinearVelocity().y), iceScalar(0.0));
+		SetLinearVelocity(stoppedOnGround);
 	}
 
 	//This keeps the racecar from turning very slightly forever after releasing steering.
-	if (rigidBody.GetAngularVelocity().Magnitude() < iceScalar(0.1))
+	if (GetAngularVelocity().Magnitude() < iceScalar(0.1))
 	{
-		rigidBody.SetAngularVelocity(icePhysics::Vector3::Zero());
+		SetAngularVelocity(icePhysics::Vector3::Zero());
 	}
 }
 
@@ -270,7 +289,7 @@ void LudumDare56::GameState::PhysicsModels::ExtremelyBasicsPhysicsModel::Simulat
 
 
 	const iceVector3 currentVelocity = GetLinearVelocity();
-	const iceVector3 acceleration = (currentVelocity - mPreviousVelocity) / kFixedTime;
+	const iceVector3 acceleration = (currentVelocity - mPreviousVelocity) / FixedTime();
 	const iceVector3 accelerationVehicle = GetVehicleToWorld().FastInverse().TransformNormal(acceleration);
 	mPreviousVelocity = currentVelocity;
 
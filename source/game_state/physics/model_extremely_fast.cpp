@@ -6,7 +6,7 @@
 ///------------------------------------------------------------------------------------------------------------------///
 
 #include "../../game_state/physics/model_extremely_fast.hpp"
-#include "../../game_state/helpers/torque_curve.hpp"
+#include "../../game_state/physics/wheel_torque_table.hpp"
 #include "../../game_state/racecar_controller_interface.hpp"
 
 namespace
@@ -45,7 +45,7 @@ namespace
 //--------------------------------------------------------------------------------------------------------------------//
 
 LudumDare56::GameState::PhysicsModels::ExtremelyFastPhysicsModel::ExtremelyFastPhysicsModel(icePhysics::World& physicalWorld) :
-	RaycastVehiclePhysicsModelInterface(physicalWorld, DefaultVehicle()),
+	RaycastVehiclePhysicsModelInterface(physicalWorld, DefaultVehicle(), PhysicsModel::ExtremelyFast),
 	mEngineSpeed(0.0),
 	mPreviousVelocity(iceVector3::Zero()),
 	mGearBox(GameState::Gear::Sixth),
@@ -87,8 +87,6 @@ void LudumDare56::GameState::PhysicsModels::ExtremelyFastPhysicsModel::OnResetRa
 
 void LudumDare56::GameState::PhysicsModels::ExtremelyFastPhysicsModel::OnSimulate(const RacecarControllerInterface& racecarController)
 {
-	RaycastVehiclePhysicsModelInterface::OnSimulate(racecarController);
-
 	mEngineSpeed = mGearBox.SimulateGearBox(mEngineSpeed, kWheelRadius, *this, racecarController);
 	SimulateTireGrip(racecarController);
 	SimulateFizzics(racecarController);
@@ -105,6 +103,40 @@ void LudumDare56::GameState::PhysicsModels::ExtremelyFastPhysicsModel::OnDebugRe
 
 //--------------------------------------------------------------------------------------------------------------------//
 
+void LudumDare56::GameState::PhysicsModels::ExtremelyFastPhysicsModel::OnSaveState(PhysicsModelState& state) const
+{
+	RaycastVehiclePhysicsModelInterface::OnSaveState(state);
+
+	state.mEngineSpeed = mEngineSpeed;
+	state.mPreviousVelocity = mPreviousVelocity;
+	state.mCurrentGear = mGearBox.mCurrentGear;
+	state.mCanShift = mGearBox.mCanShift;
+
+	state.mBodyTilterVelocity = mBodyTilter.mPreviousVelocity;
+	state.mBodyToVehicle = mBodyTilter.mBodyToVehicle;
+	state.mBodyRoll = mBodyTilter.mBodyRoll;
+	state.mBodyPitch = mBodyTilter.mBodyPitch;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void LudumDare56::GameState::PhysicsModels::ExtremelyFastPhysicsModel::OnRestoreState(const PhysicsModelState& state)
+{
+	RaycastVehiclePhysicsModelInterface::OnRestoreState(state);
+
+	mEngineSpeed = state.mEngineSpeed;
+	mPreviousVelocity = state.mPreviousVelocity;
+	mGearBox.mCurrentGear = state.mCurrentGear;
+	mGearBox.mCanShift = state.mCanShift;
+
+	mBodyTilter.mPreviousVelocity = state.mBodyTilterVelocity;
+	mBodyTilter.mBodyToVehicle = state.mBodyToVehicle;
+	mBodyTilter.mBodyRoll = state.mBodyRoll;
+	mBodyTilter.mBodyPitch = state.mBodyPitch;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
 icePhysics::Angle LudumDare56::GameState::PhysicsModels::ExtremelyFastPhysicsModel::GetSteeringAngle(
 	const iceScalar steeringInput, const iceScalar vehicleGroundSpeed)
 {	//TODO: LudumDare56: Physics: This is definitely NOT a good way to figure out the steering angle, based off Rally of Rockets.
@@ -126,7 +158,7 @@ void LudumDare56::GameState::PhysicsModels::ExtremelyFastPhysicsModel::SimulateF
 	//const Scalar forwardSpeed = Vector3::Dot(vehicleForwardDirection, GetLinearVelocity());
 
 	icePhysics::RigidBody& rigidBody = *racecar.HackyAPI_GetRigidBody();
-	const iceVector3 vehicleGroundVelocity(rigidBody.GetLinearVelocity().x, 0.0f, rigidBody.GetLinearVelocity().z);
+	const iceVector3 vehicleGroundVelocity(GetLinearVelocity().x, 0.0f, GetLinearVelocity().z);
 	const iceScalar vehicleGroundSpeed = vehicleGroundVelocity.Magnitude();
 
 	iceScalar throttle = racecarController.GetThrottlePercentage();
@@ -158,9 +190,9 @@ void LudumDare56::GameState::PhysicsModels::ExtremelyFastPhysicsModel::SimulateF
 	const iceScalar fluidDensity = iceScalar(1.225);     //kg/meters^3 (Air Density at Sea Level)
 	const iceScalar dragCoefficient = iceScalar(0.37);   //Miata 1999 drag coefficient is 0.37
 	const iceScalar frontalArea = iceScalar(1.7113);     //meters^2 Miata NA frontalArea
-	const iceScalar speedSquared = rigidBody.GetLinearVelocity().MagnitudeSquared();
+	const iceScalar speedSquared = GetLinearVelocity().MagnitudeSquared();
 	const iceScalar dragForce = iceScalar(0.5) * fluidDensity * speedSquared * dragCoefficient * frontalArea;
-	rigidBody.ApplyForce(-rigidBody.GetLinearVelocity().GetNormalized() * dragForce);
+	ApplyForce(-GetLinearVelocity().GetNormalized() * dragForce);
 
 	//Attempting to setup more slippery physics... at least on the rear end - absolutely uncontrollable; use CreateRearTyreCurve().
 	for (size_t wheelIndex = 0; wheelIndex < 4; ++wheelIndex)
@@ -179,10 +211,7 @@ void LudumDare56::GameState::PhysicsModels::ExtremelyFastPhysicsModel::SimulateF
 		if (mEngineSpeed < kEngineRevLimiter)
 		{
 			const iceScalar clampedEngineSpeed = tbMath::Clamp(mEngineSpeed, iceScalar(800), iceScalar(8500));
-			TorqueCurve torqueCurve = TorqueCurve::MiataTorqueCurve();
-
-			const iceScalar engineTorque = throttle * torqueCurve.GetOutputTorque(clampedEngineSpeed);
-			const iceScalar wheelTorque = mGearBox.CalculateWheelTorque(engineTorque, GetShifterPosition());
+			const iceScalar wheelTorque = throttle * WheelTorqueTable::Miata().GetWheelTorque(GetShifterPosition(), clampedEngineSpeed);
 			const iceScalar torquePerWheel(wheelTorque / 2.0); //Nm
 
 			racecar.SetEngineTorque(2, torquePerWheel);
@@ -206,19 +235,19 @@ void LudumDare56::GameState::PhysicsModels::ExtremelyFastPhysicsModel::SimulateF
 	{
 		const iceScalar rollingResistanceCoefficient = 0.02f; //ordinary car tire on new-ish asphalt.
 		const iceScalar weight = 10.0f * vehicleMass;
-		rigidBody.ApplyForce(-vehicleGroundVelocity.GetNormalized() * weight * rollingResistanceCoefficient);
+		ApplyForce(-vehicleGroundVelocity.GetNormalized() * weight * rollingResistanceCoefficient);
 	}
 
 	if (vehicleGroundSpeed < 0.001f && (false == isOnThrottle))
 	{
-		iceVector3 stoppedOnGround(iceScalar(0.0), iceScalar(rigidBody.GetLinearVelocity().y), iceScalar(0.0));
-		rigidBody.SetLinearVelocity(stoppedOnGround);
+		iceVector3 stoppedOnGround(iceScalar(0.0), iceScalar(GetLinearVelocity().y), iceScalar(0.0));
+		SetLinearVelocity(stoppedOnGround);
 	}
 
 	//This keeps the racecar from turning very slightly forever after releasing steering.
-	if (rigidBody.GetAngularVelocity().Magnitude() < iceScalar(0.1))
+	if (GetAngularVelocity().Magnitude() < iceScalar(0.1))
 	{
-		rigidBody.SetAngularVelocity(icePhysics::Vector3::Zero());
+		SetAngularVelocity(icePhysics::Vector3::Zero());
 	}
 }
 
@@ -279,7 +308,7 @@ void LudumDare56::GameState::PhysicsModels::ExtremelyFastPhysicsModel::SimulateT
 
 	//If this chunk gets uncommented, we may conflict/issues with previous = current velocity, see SimulateBodyRoll()
 	//const iceVector3 currentVelocity = GetLinearVelocity();
-	//const iceVector3 acceleration = (currentVelocity - mPreviousVelocity) / kFixedTime;
+	//const iceVector3 acceleration = (currentVelocity - mPreviousVelocity) / FixedTime();
 	//const iceVector3 accelerationVehicle = GetVehicleToWorld().FastInverse().TransformNormal(acceleration);
 	//mPreviousVelocity = currentVelocity;
 
@@ -17,7 +17,7 @@
 namespace LudumDare56::GameState::PhysicsModels
 {
 
-	class ExtremelyFastPhysicsModel : public RaycastVehiclePhysicsModelInterface
+	class ExtremelyFastPhysicsModel final : public RaycastVehiclePhysicsModelInterface
 	{
 	public:
 		ExtremelyFastPhysicsModel(icePhysics::World& physicalWorld);
@@ -29,9 +29,13 @@ namespace LudumDare56::GameState::PhysicsModels
 		inline virtual Gear GetShifterPosition(void) const override { return mGearBox.mCurrentGear; }
 
 	protected:
+		friend class PhysicsModelBatch;
+
 		virtual void OnResetRacecarForces(void) override;
 		virtual void OnSimulate(const RacecarControllerInterface& racecarController) override;
 		virtual void OnDebugRender(void) const override;
+		virtual void OnSaveState(PhysicsModelState& state) const override;
+		virtual void OnRestoreState(const PhysicsModelState& state) override;
 
 	private:
 		static iceAngle GetSteeringAngle(const iceScalar steeringInput, const iceScalar vehicleGroundSpeed);
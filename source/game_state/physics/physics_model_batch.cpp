@@ -0,0 +1,406 @@
+///
+/// @file
+/// @details Steps the physics of every racecar grouped by physics model, rather than one racecar at a time.
+///
+/// <!-- Copyright (c) 2024 Tyre Bytes LLC - All Rights Reserved -->
+///------------------------------------------------------------------------------------------------------------------///
+
+#include "../../game_state/physics/physics_model_batch.hpp"
+#include "../../game_state/implementation/flat_test_world.hpp"
+
+#include <turtle_brains/core/unit_test/tb_unit_test.hpp>
+
+#include <cmath>
+
+namespace
+{
+	//Well beyond the reach of the wheels plus the length of a racecar, and how far either could move in a step, so
+	//  racecars further apart than this cannot touch each other in the physical world during the step.
+	const iceScalar kInteractionDistance(25.0);
+};	//namespace
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+LudumDare56::GameState::PhysicsModels::PhysicsModelBatch::PhysicsModelBatch(void) :
+	mVehicles(),
+	mVehiclePositions(),
+	mCrowdedVehicles(),
+	mExtremelyBasic(),
+	mExtremelyFast(),
+	mExtremeDrifting(),
+	mNumberOfNullModels(0)
+{
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+LudumDare56::GameState::PhysicsModels::PhysicsModelBatch::~PhysicsModelBatch(void)
+{
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void LudumDare56::GameState::PhysicsModels::PhysicsModelBatch::Reset(void)
+{
+	mVehicles.clear();
+	mCrowdedVehicles.clear();
+	mExtremelyBasic.Clear();
+	mExtremelyFast.Clear();
+	mExtremeDrifting.Clear();
+	mNumberOfNullModels = 0;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void LudumDare56::GameState::PhysicsModels::PhysicsModelBatch::AddVehicle(PhysicsModelInterface& physicsModel,
+	const RacecarControllerInterface& racecarController)
+{
+	//A new physics model needs a group of its own, see GroupVehicle() and StepVehicle(), or it would silently never
+	//  be simulated.
+	switch (physicsModel.GetModelType())
+	{
+	case PhysicsModel::NullModel:
+		++mNumberOfNullModels;
+		return;
+	case PhysicsModel::ExtremelyBasic:
+	case PhysicsModel::ExtremelyFast:
+	case PhysicsModel::ExtremeDrifting:
+		mVehicles.push_back(Vehicle{ &physicsModel, &racecarController });
+		return;
+	};
+
+	tb_error("Unknown physics model, did you add a group to the PhysicsModelBatch?");
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void LudumDare56::GameState::PhysicsModels::PhysicsModelBatch::Simulate(TyreBytes::Core::WorkerPool& workers)
+{
+	mExtremelyBasic.Clear();
+	mExtremelyFast.Clear();
+	mExtremeDrifting.Clear();
+	mCrowdedVehicles.clear();
+
+	const size_t numberOfVehicles = mVehicles.size();
+	mVehiclePositions.resize(numberOfVehicles);
+	for (size_t vehicleIndex = 0; vehicleIndex < numberOfVehicles; ++vehicleIndex)
+	{
+		mVehiclePositions[vehicleIndex] = mVehicles[vehicleIndex].mPhysicsModel->GetVehicleToWorld().GetPosition();
+	}
+
+	const iceScalar interactionDistanceSquared = kInteractionDistance * kInteractionDistance;
+	for (size_t vehicleIndex = 0; vehicleIndex < numberOfVehicles; ++vehicleIndex)
+	{
+		bool isCrowded = false;
+		for (size_t otherIndex = 0; otherIndex < numberOfVehicles && false == isCrowded; ++otherIndex)
+		{
+			isCrowded = (otherIndex != vehicleIndex &&
+				(mVehiclePositions[otherIndex] - mVehiclePositions[vehicleIndex]).MagnitudeSquared() < interactionDistanceSquared);
+		}
+
+		if (true == isCrowded || false == PhysicsModelInterface::IsDeferringCommands())
+		{
+			mCrowdedVehicles.push_back(vehicleIndex);
+		}
+		else
+		{
+			GroupVehicle(mVehicles[vehicleIndex]);
+		}
+	}
+
+	//None of the grouped racecars can reach any other racecar, so it does not matter that they step before, or
+	//  alongside, the crowded racecars which step last in the order they were added.
+	BeginGroup(mExtremelyBasic);
+	BeginGroup(mExtremelyFast);
+	BeginGroup(mExtremeDrifting);
+
+	const size_t numberOfGroupedVehicles = mExtremelyBasic.mPhysicsModels.size() + mExtremelyFast.mPhysicsModels.size() +
+		mExtremeDrifting.mPhysicsModels.size();
+	workers.ParallelFor(numberOfGroupedVehicles, [this](const size_t vehicleIndex) {
+		ComputeVehicle(vehicleIndex);
+	});
+
+	EndGroup(mExtremelyBasic);
+	EndGroup(mExtremelyFast);
+	EndGroup(mExtremeDrifting);
+
+	for (const size_t vehicleIndex : mCrowdedVehicles)
+	{
+		StepVehicle(mVehicles[vehicleIndex]);
+	}
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+size_t LudumDare56::GameState::PhysicsModels::PhysicsModelBatch::GetNumberOfVehicles(void) const
+{
+	return mVehicles.size() + mNumberOfNullModels;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void LudumDare56::GameState::PhysicsModels::PhysicsModelBatch::GroupVehicle(const Vehicle& vehicle)
+{	//The model type is set by each constructor, and AddVehicle() only takes those with a group, so the casts are safe.
+	switch (vehicle.mPhysicsModel->GetModelType())
+	{
+	case PhysicsModel::ExtremelyBasic:
+		mExtremelyBasic.Add(static_cast<ExtremelyBasicsPhysicsModel&>(*vehicle.mPhysicsModel), *vehicle.mController);
+		break;
+	case PhysicsModel::ExtremelyFast:
+		mExtremelyFast.Add(static_cast<ExtremelyFastPhysicsModel&>(*vehicle.mPhysicsModel), *vehicle.mController);
+		break;
+	case PhysicsModel::ExtremeDrifting:
+		mExtremeDrifting.Add(static_cast<ExtremeDriftingPhysicsModel&>(*vehicle.mPhysicsModel), *vehicle.mController);
+		break;
+	case PhysicsModel::NullModel:
+		break;
+	};
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void LudumDare56::GameState::PhysicsModels::PhysicsModelBatch::StepVehicle(const Vehicle& vehicle)
+{
+	switch (vehicle.mPhysicsModel->GetModelType())
+	{
+	case PhysicsModel::ExtremelyBasic:
+		StepVehicle(static_cast<ExtremelyBasicsPhysicsModel&>(*vehicle.mPhysicsModel), *vehicle.mController);
+		break;
+	case PhysicsModel::ExtremelyFast:
+		StepVehicle(static_cast<ExtremelyFastPhysicsModel&>(*vehicle.mPhysicsModel), *vehicle.mController);
+		break;
+	case PhysicsModel::ExtremeDrifting:
+		StepVehicle(static_cast<ExtremeDriftingPhysicsModel&>(*vehicle.mPhysicsModel), *vehicle.mController);
+		break;
+	case PhysicsModel::NullModel:
+		break;
+	};
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void LudumDare56::GameState::PhysicsModels::PhysicsModelBatch::ComputeVehicle(size_t vehicleIndex) const
+{
+	if (vehicleIndex < mExtremelyBasic.mPhysicsModels.size())
+	{
+		ComputeGroup(mExtremelyBasic, vehicleIndex);
+		return;
+	}
+
+	vehicleIndex -= mExtremelyBasic.mPhysicsModels.size();
+	if (vehicleIndex < mExtremelyFast.mPhysicsModels.size())
+	{
+		ComputeGroup(mExtremelyFast, vehicleIndex);
+		return;
+	}
+
+	vehicleIndex -= mExtremelyFast.mPhysicsModels.size();
+	ComputeGroup(mExtremeDrifting, vehicleIndex);
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+template<typename ModelType> void LudumDare56::GameState::PhysicsModels::PhysicsModelBatch::BeginGroup(
+	const Group<ModelType>& group)
+{
+	for (ModelType* physicsModel : group.mPhysicsModels)
+	{	//ModelType is final, so these are direct calls rather than through the vtable.
+		physicsModel->ModelType::OnBeginSimulate();
+	}
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+template<typename ModelType> void LudumDare56::GameState::PhysicsModels::PhysicsModelBatch::ComputeGroup(
+	const Group<ModelType>& group, const size_t vehicleIndex)
+{
+	group.mPhysicsModels[vehicleIndex]->ModelType::OnSimulate(*group.mControllers[vehicleIndex]);
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+template<typename ModelType> void LudumDare56::GameState::PhysicsModels::PhysicsModelBatch::EndGroup(
+	const Group<ModelType>& group)
+{
+	for (ModelType* physicsModel : group.mPhysicsModels)
+	{
+		physicsModel->ModelType::OnEndSimulate();
+	}
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+template<typename ModelType> void LudumDare56::GameState::PhysicsModels::PhysicsModelBatch::StepVehicle(
+	ModelType& physicsModel, const RacecarControllerInterface& racecarController)
+{
+	physicsModel.ModelType::OnBeginSimulate();
+	physicsModel.ModelType::OnSimulate(racecarController);
+	physicsModel.ModelType::OnEndSimulate();
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
+
+namespace
+{
+	using namespace LudumDare56;
+	using namespace LudumDare56::GameState;
+
+	const tbCore::uint64 kHashOffsetBasis = 14695981039346656037ull;
+	const tbCore::uint64 kHashPrime = 1099511628211ull;
+
+	tbCore::uint64 HashBytes(tbCore::uint64 hash, const void* data, const size_t numberOfBytes)
+	{
+		const tbCore::uint8* bytes = static_cast<const tbCore::uint8*>(data);
+		for (size_t byteIndex = 0; byteIndex < numberOfBytes; ++byteIndex)
+		{
+			hash = (hash ^ bytes[byteIndex]) * kHashPrime;
+		}
+		return hash;
+	}
+
+	///
+	/// @details Weaves about on the throttle and brake differently for each racecar so the models get some shifting,
+	///   braking and drifting to do, without needing a racetrack to follow.
+	///
+	class ScriptedController : public RacecarControllerInterface
+	{
+	public:
+		explicit ScriptedController(const size_t seed) :
+			mSeed(seed),
+			mStep(0)
+		{
+		}
+
+	protected:
+		virtual void OnUpdateControls(void) override
+		{
+			const size_t phase = (mStep + mSeed * 37) % 400;
+			SetThrottlePercentage((phase < 250) ? 1.0f : 0.0f);
+			SetBrakePercentage((phase >= 320) ? 0.5f : 0.0f);
+			SetSteeringPercentage(std::sin(static_cast<float>(mStep) * 0.01f + static_cast<float>(mSeed)));
+			SetActionDown(DriverAction::Handbrake, (phase >= 250 && phase < 270));
+			++mStep;
+		}
+
+	private:
+		const size_t mSeed;
+		size_t mStep;
+	};
+
+	enum class SteppingMode { Immediate, Batch };
+
+	///
+	/// @details Drives a handful of racecars of every physics model on a flat plane and returns a hash of where each
+	///   ended up, so the different ways of stepping them can be compared bit for bit. The Immediate mode steps each
+	///   racecar one at a time with the models touching the rigid bodies directly, as before the PhysicsModelBatch.
+	///
+	tbCore::uint64 SimulateRacecars(const SteppingMode steppingMode, TyreBytes::Core::WorkerPool& workers)
+	{
+		using namespace LudumDare56::GameState::PhysicsModels;
+
+		const PhysicsModel kModels[] = { PhysicsModel::ExtremelyBasic, PhysicsModel::ExtremelyFast, PhysicsModel::ExtremeDrifting };
+		const size_t kNumberOfTestRacecars = 12;
+		const size_t kNumberOfPackedRacecars = 6;
+		const size_t kNumberOfSteps = 1000;
+
+		PhysicsModelInterface::SetDeferringCommands(SteppingMode::Batch == steppingMode);
+
+		Implementation::FlatTestWorld testWorld;
+
+		std::vector<PhysicsModelInterfacePtr> physicsModels;
+		std::vector<std::unique_ptr<ScriptedController>> controllers;
+		for (size_t racecarIndex = 0; racecarIndex < kNumberOfTestRacecars; ++racecarIndex)
+		{	//The first few are packed side by side so they bump into and cast their wheels against each other, the rest
+			//  are far enough apart that they never do, and are computed on the workers.
+			const iceScalar spacing = (racecarIndex < kNumberOfPackedRacecars) ? iceScalar(2.5) : iceScalar(100.0);
+			physicsModels.push_back(Instantiate(testWorld.GetPhysicalWorld(), kModels[racecarIndex % 3]));
+			physicsModels.back()->SetEnabled(true);
+			physicsModels.back()->SetVehicleToWorld(iceMatrix4::Translation(static_cast<iceScalar>(racecarIndex) * spacing, 0.75, 0.0));
+			controllers.push_back(std::make_unique<ScriptedController>(racecarIndex));
+		}
+
+		PhysicsModelBatch vehiclePhysics;
+		for (size_t step = 0; step < kNumberOfSteps; ++step)
+		{
+			vehiclePhysics.Reset();
+			for (size_t racecarIndex = 0; racecarIndex < kNumberOfTestRacecars; ++racecarIndex)
+			{
+				controllers[racecarIndex]->UpdateControls();
+				if (SteppingMode::Immediate == steppingMode)
+				{
+					physicsModels[racecarIndex]->Simulate(*controllers[racecarIndex]);
+				}
+				else
+				{
+					vehiclePhysics.AddVehicle(*physicsModels[racecarIndex], *controllers[racecarIndex]);
+				}
+			}
+
+			if (SteppingMode::Batch == steppingMode)
+			{
+				vehiclePhysics.Simulate(workers);
+			}
+
+			testWorld.GetPhysicalWorld().Simulate(FixedTime());
+		}
+
+		tbCore::uint64 hash = kHashOffsetBasis;
+		for (const PhysicsModelInterfacePtr& physicsModel : physicsModels)
+		{
+			const iceMatrix4 vehicleToWorld = physicsModel->GetVehicleToWorld();
+			const iceVector3 linearVelocity = physicsModel->GetLinearVelocity();
+			const iceVector3 angularVelocity = physicsModel->GetAngularVelocity();
+			const iceScalar engineSpeed = physicsModel->GetEngineSpeed();
+			hash = HashBytes(hash, &vehicleToWorld, sizeof(vehicleToWorld));
+			hash = HashBytes(hash, &linearVelocity, sizeof(linearVelocity));
+			hash = HashBytes(hash, &angularVelocity, sizeof(angularVelocity));
+			hash = HashBytes(hash, &engineSpeed, sizeof(engineSpeed));
+
+			physicsModel->SetEnabled(false);
+		}
+
+		PhysicsModelInterface::SetDeferringCommands(true);
+		return hash;
+	}
+
+};	//namespace
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+class PhysicsModelBatchTest : tbCore::UnitTest::TestCaseInterface
+{
+public:
+	PhysicsModelBatchTest(void) :
+		tbCore::UnitTest::TestCaseInterface("PhysicsModelBatchTest")
+	{
+	}
+
+	~PhysicsModelBatchTest(void)
+	{
+	}
+
+protected:
+	virtual bool OnRunTest(void) override
+	{
+		TyreBytes::Core::WorkerPool noWorkers(0);
+		TyreBytes::Core::WorkerPool someWorkers(3);
+
+		const tbCore::uint64 immediateHash = SimulateRacecars(SteppingMode::Immediate, noWorkers);
+		const tbCore::uint64 serialHash = SimulateRacecars(SteppingMode::Batch, noWorkers);
+		const tbCore::uint64 parallelHash = SimulateRacecars(SteppingMode::Batch, someWorkers);
+
+		ExpectedValue(serialHash == immediateHash, true,
+			"Expected the batch to step the racecars exactly as touching the rigid bodies directly, one at a time.");
+		ExpectedValue(parallelHash == serialHash, true, "Expected the workers to step the racecars exactly as the serial batch.");
+
+		//Running again on the same workers must not depend on which worker happened to compute which racecar.
+		ExpectedValue(SimulateRacecars(SteppingMode::Batch, someWorkers) == parallelHash, true,
+			"Expected stepping the racecars on the workers to repeat exactly.");
+
+		return true;
+	}
+};
+
+PhysicsModelBatchTest thePhysicsModelBatchTest;
@@ -0,0 +1,106 @@
+///
+/// @file
+/// @details Steps the physics of every racecar grouped by physics model, rather than one racecar at a time.
+///
+/// <!-- Copyright (c) 2024 Tyre Bytes LLC - All Rights Reserved -->
+///------------------------------------------------------------------------------------------------------------------///
+
+#ifndef LudumDare56_PhysicsModelBatch_hpp
+#define LudumDare56_PhysicsModelBatch_hpp
+
+#include "../../game_state/physics/physics_model_interface.hpp"
+#include "../../game_state/physics/model_extremely_basic.hpp"
+#include "../../game_state/physics/model_extremely_fast.hpp"
+#include "../../game_state/physics/model_extreme_drifting.hpp"
+
+#include "../../core/worker_pool.hpp"
+
+#include <vector>
+
+namespace LudumDare56::GameState::PhysicsModels
+{
+
+	///
+	/// @details Each step the racecars add their physics model and controller, which gets sorted into a group for the
+	///   concrete model, then Simulate() steps each group in a tight loop. Since every model is final, the compiler
+	///   calls (and can inline) OnSimulate() directly rather than through the vtable for each racecar, and racecars
+	///   with the NullPhysicsModel are never stepped at all.
+	///
+	/// @note Within a group the racecars step in the order they were added, and the groups always step in the same
+	///   order, so the results stay deterministic. The batch does not allocate once it has seen the most racecars.
+	///
+	/// @note Only the wheels casting against the physical world, and applying the VehicleCommands back to it, happen
+	///   in that order. In between, the forces of every model are computed across the workers since each only touches
+	///   its own model, which keeps the results identical no matter how many workers there are.
+	///
+	/// @note A racecar can cast its wheels against, or bump into, a racecar near it. Those that are within
+	///   kInteractionDistance of another racecar are stepped one at a time, completely, in the order they were added,
+	///   so they see each other exactly as the racecars did before the batch. Only the racecars away from all others
+	///   are grouped and computed on the workers, since nothing they do reaches another racecar during the step.
+	///
+	class PhysicsModelBatch
+	{
+	public:
+		PhysicsModelBatch(void);
+		~PhysicsModelBatch(void);
+
+		///
+		/// @details Removes every racecar from the batch while keeping the memory around for the next step.
+		///
+		void Reset(void);
+
+		///
+		/// @details Adds the physics model to be stepped with the controller on the next Simulate(). Both must live
+		///   until then, and the controller is expected to already be updated for this step.
+		///
+		void AddVehicle(PhysicsModelInterface& physicsModel, const RacecarControllerInterface& racecarController);
+
+		///
+		/// @details Steps every physics model that was added, one group of the same model after another, computing the
+		///   forces of the models on the workers. This touches the physical world and must not run alongside anything
+		///   else using it.
+		///
+		void Simulate(TyreBytes::Core::WorkerPool& workers);
+
+		size_t GetNumberOfVehicles(void) const;
+
+	private:
+		struct Vehicle
+		{
+			PhysicsModelInterface* mPhysicsModel;
+			const RacecarControllerInterface* mController;
+		};
+
+		template<typename ModelType> struct Group
+		{
+			std::vector<ModelType*> mPhysicsModels;
+			std::vector<const RacecarControllerInterface*> mControllers;
+
+			void Clear(void) { mPhysicsModels.clear(); mControllers.clear(); }
+			void Add(ModelType& physicsModel, const RacecarControllerInterface& controller)
+			{
+				mPhysicsModels.push_back(&physicsModel);
+				mControllers.push_back(&controller);
+			}
+		};
+
+		template<typename ModelType> static void BeginGroup(const Group<ModelType>& group);
+		template<typename ModelType> static void ComputeGroup(const Group<ModelType>& group, const size_t vehicleIndex);
+		template<typename ModelType> static void EndGroup(const Group<ModelType>& group);
+		template<typename ModelType> static void StepVehicle(ModelType& physicsModel, const RacecarControllerInterface& racecarController);
+		void ComputeVehicle(size_t vehicleIndex) const;
+		void GroupVehicle(const Vehicle& vehicle);
+		static void StepVehicle(const Vehicle& vehicle);
+
+		std::vector<Vehicle> mVehicles;
+		std::vector<iceVector3> mVehiclePositions;
+		std::vector<size_t> mCrowdedVehicles;
+		Group<ExtremelyBasicsPhysicsModel> mExtremelyBasic;
+		Group<ExtremelyFastPhysicsModel> mExtremelyFast;
+		Group<ExtremeDriftingPhysicsModel> mExtremeDrifting;
+		size_t mNumberOfNullModels;
+	};
+
+};	//namespace LudumDare56::GameState::PhysicsModels
+
+#endif /* LudumDare56_PhysicsModelBatch_hpp */
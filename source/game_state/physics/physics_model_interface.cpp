@@ -10,9 +10,15 @@
 #include "../../game_state/physics/model_extremely_fast.hpp"
 #include "../../game_state/physics/model_extreme_drifting.hpp"
 
+namespace
+{
+	bool theIsDeferringCommands = true;
+};	//namespace
+
 //--------------------------------------------------------------------------------------------------------------------//
 
-LudumDare56::GameState::PhysicsModels::PhysicsModelInterface::PhysicsModelInterface(void)
+LudumDare56::GameState::PhysicsModels::PhysicsModelInterface::PhysicsModelInterface(const PhysicsModel modelType) :
+	mModelType(modelType)
 {
 }
 
@@ -40,7 +46,9 @@ void LudumDare56::GameState::PhysicsModels::PhysicsModelInterface::ResetRacecarF
 
 void LudumDare56::GameState::PhysicsModels::PhysicsModelInterface::Simulate(const RacecarControllerInterface& racecarController)
 {
+	OnBeginSimulate();
 	OnSimulate(racecarController);
+	OnEndSimulate();
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
@@ -50,6 +58,34 @@ void LudumDare56::GameState::PhysicsModels::PhysicsModelInterface::DebugRender(v
 	OnDebugRender();
 }
 
+//--------------------------------------------------------------------------------------------------------------------//
+
+void LudumDare56::GameState::PhysicsModels::PhysicsModelInterface::SetDeferringCommands(const bool isDeferringCommands)
+{
+	theIsDeferringCommands = isDeferringCommands;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+bool LudumDare56::GameState::PhysicsModels::PhysicsModelInterface::IsDeferringCommands(void)
+{
+	return theIsDeferringCommands;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void LudumDare56::GameState::PhysicsModels::PhysicsModelInterface::SaveState(PhysicsModelState& state) const
+{
+	OnSaveState(state);
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void LudumDare56::GameState::PhysicsModels::PhysicsModelInterface::RestoreState(const PhysicsModelState& state)
+{
+	OnRestoreState(state);
+}
+
 //--------------------------------------------------------------------------------------------------------------------//
 //--------------------------------------------------------------------------------------------------------------------//
 //--------------------------------------------------------------------------------------------------------------------//
@@ -129,11 +165,13 @@ void LudumDare56::GameState::PhysicsModels::NullPhysicsModel::SetLinearVelocity(
 //--------------------------------------------------------------------------------------------------------------------//
 
 LudumDare56::GameState::PhysicsModels::RaycastVehiclePhysicsModelInterface::RaycastVehiclePhysicsModelInterface(
-	icePhysics::World& physicalWorld, const icePhysics::VehicleInfo& vehicleInfo) :
+	icePhysics::World& physicalWorld, const icePhysics::VehicleInfo& vehicleInfo, const PhysicsModel modelType) :
 
-	PhysicsModelInterface(),
+	PhysicsModelInterface(modelType),
 	mPhysicalWorld(physicalWorld),
-	mPhysicalVehicle(vehicleInfo)
+	mPhysicalVehicle(vehicleInfo),
+	mCommands(),
+	mIsRecordingCommands(false)
 {
 }
 
@@ -147,6 +185,11 @@ LudumDare56::GameState::PhysicsModels::RaycastVehiclePhysicsModelInterface::~Ray
 
 icePhysics::Matrix4 LudumDare56::GameState::PhysicsModels::RaycastVehiclePhysicsModelInterface::GetVehicleToWorld(void) const
 {
+	if (true == mIsRecordingCommands)
+	{
+		return mCommands.mVehicleToWorld;
+	}
+
 	return mPhysicalVehicle.GetVehicleToWorld();
 }
 
@@ -154,6 +197,13 @@ icePhysics::Matrix4 LudumDare56::GameState::PhysicsModels::RaycastVehiclePhysics
 
 void LudumDare56::GameState::PhysicsModels::RaycastVehiclePhysicsModelInterface::SetVehicleToWorld(const iceMatrix4& vehicleToWorld)
 {
+	if (true == mIsRecordingCommands)
+	{
+		mCommands.mVehicleToWorld = vehicleToWorld;
+		AddCommand(VehicleCommands::CommandType::SetVehicleToWorld).mVehicleToWorld = vehicleToWorld;
+		return;
+	}
+
 	mPhysicalVehicle.SetVehicleToWorld(vehicleToWorld);
 }
 
@@ -175,6 +225,11 @@ icePhysics::Matrix4 LudumDare56::GameState::PhysicsModels::RaycastVehiclePhysics
 
 icePhysics::Vector3 LudumDare56::GameState::PhysicsModels::RaycastVehiclePhysicsModelInterface::GetAngularVelocity(void) const
 {
+	if (true == mIsRecordingCommands)
+	{
+		return mCommands.mAngularVelocity;
+	}
+
 	return mPhysicalVehicle.GetAngularVelocity();
 }
 
@@ -182,6 +237,13 @@ icePhysics::Vector3 LudumDare56::GameState::PhysicsModels::RaycastVehiclePhysics
 
 void LudumDare56::GameState::PhysicsModels::RaycastVehiclePhysicsModelInterface::SetAngularVelocity(const iceVector3& angularVelocity)
 {
+	if (true == mIsRecordingCommands)
+	{
+		mCommands.mAngularVelocity = angularVelocity;
+		AddCommand(VehicleCommands::CommandType::SetAngularVelocity).mVector = angularVelocity;
+		return;
+	}
+
 	mPhysicalVehicle.SetAngularVelocity(angularVelocity);
 }
 
@@ -189,6 +251,11 @@ void LudumDare56::GameState::PhysicsModels::RaycastVehiclePhysicsModelInterface:
 
 icePhysics::Vector3 LudumDare56::GameState::PhysicsModels::RaycastVehiclePhysicsModelInterface::GetLinearVelocity(void) const
 {
+	if (true == mIsRecordingCommands)
+	{
+		return mCommands.mLinearVelocity;
+	}
+
 	return mPhysicalVehicle.GetLinearVelocity();
 }
 
@@ -196,6 +263,13 @@ icePhysics::Vector3 LudumDare56::GameState::PhysicsModels::RaycastVehiclePhysics
 
 void LudumDare56::GameState::PhysicsModels::RaycastVehiclePhysicsModelInterface::SetLinearVelocity(const iceVector3& linearVelocity)
 {
+	if (true == mIsRecordingCommands)
+	{
+		mCommands.mLinearVelocity = linearVelocity;
+		AddCommand(VehicleCommands::CommandType::SetLinearVelocity).mVector = linearVelocity;
+		return;
+	}
+
 	mPhysicalVehicle.SetLinearVelocity(linearVelocity);
 }
 
@@ -216,6 +290,27 @@ void LudumDare56::GameState::PhysicsModels::RaycastVehiclePhysicsModelInterface:
 
 //--------------------------------------------------------------------------------------------------------------------//
 
+void LudumDare56::GameState::PhysicsModels::RaycastVehiclePhysicsModelInterface::OnSaveState(PhysicsModelState& state) const
+{
+	state.mVehicleToWorld = mPhysicalVehicle.GetVehicleToWorld();
+	state.mLinearVelocity = mPhysicalVehicle.GetLinearVelocity();
+	state.mAngularVelocity = mPhysicalVehicle.GetAngularVelocity();
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void LudumDare56::GameState::PhysicsModels::RaycastVehiclePhysicsModelInterface::OnRestoreState(const PhysicsModelState& state)
+{	//Snapshots are taken just after the physical world has stepped, when the forces have all been used, so clearing
+	//  them puts the vehicle back exactly where it was.
+	mPhysicalVehicle.ClearForcesAndTorque();
+	mPhysicalVehicle.ClearWheelForces();
+	mPhysicalVehicle.SetVehicleToWorld(state.mVehicleToWorld);
+	mPhysicalVehicle.SetLinearVelocity(state.mLinearVelocity);
+	mPhysicalVehicle.SetAngularVelocity(state.mAngularVelocity);
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
 void LudumDare56::GameState::PhysicsModels::RaycastVehiclePhysicsModelInterface::OnResetRacecarForces(void)
 {
 	SetAngularVelocity(iceVector3::Zero());
@@ -226,9 +321,63 @@ void LudumDare56::GameState::PhysicsModels::RaycastVehiclePhysicsModelInterface:
 
 //--------------------------------------------------------------------------------------------------------------------//
 
-void LudumDare56::GameState::PhysicsModels::RaycastVehiclePhysicsModelInterface::OnSimulate(const RacecarControllerInterface& /*racecarController*/)
+void LudumDare56::GameState::PhysicsModels::RaycastVehiclePhysicsModelInterface::OnBeginSimulate(void)
+{
+	mPhysicalVehicle.Simulate(mPhysicalWorld, FixedTime());
+
+	//The body does not change again until the commands are applied, so the model can read these without touching it.
+	mCommands.mVehicleToWorld = mPhysicalVehicle.GetVehicleToWorld();
+	mCommands.mLinearVelocity = mPhysicalVehicle.GetLinearVelocity();
+	mCommands.mAngularVelocity = mPhysicalVehicle.GetAngularVelocity();
+	mCommands.mNumberOfCommands = 0;
+	mIsRecordingCommands = theIsDeferringCommands;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void LudumDare56::GameState::PhysicsModels::RaycastVehiclePhysicsModelInterface::OnEndSimulate(void)
+{
+	mIsRecordingCommands = false;
+
+	//Applied in the order the model gave them, so a velocity set before turning the vehicle, or a force added before
+	//  setting a velocity, reaches the body just as it would have without the commands in between.
+	icePhysics::RigidBody& rigidBody = *mPhysicalVehicle.HackyAPI_GetRigidBody();
+	for (size_t commandIndex = 0; commandIndex < mCommands.mNumberOfCommands; ++commandIndex)
+	{
+		const VehicleCommands::Command& command = mCommands.mCommands[commandIndex];
+		switch (command.mType)
+		{
+		case VehicleCommands::CommandType::SetVehicleToWorld: mPhysicalVehicle.SetVehicleToWorld(command.mVehicleToWorld); break;
+		case VehicleCommands::CommandType::SetLinearVelocity: mPhysicalVehicle.SetLinearVelocity(command.mVector); break;
+		case VehicleCommands::CommandType::SetAngularVelocity: mPhysicalVehicle.SetAngularVelocity(command.mVector); break;
+		case VehicleCommands::CommandType::ApplyForce: rigidBody.ApplyForce(command.mVector); break;
+		};
+	}
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void LudumDare56::GameState::PhysicsModels::RaycastVehiclePhysicsModelInterface::ApplyForce(const iceVector3& force)
+{
+	if (true == mIsRecordingCommands)
+	{
+		AddCommand(VehicleCommands::CommandType::ApplyForce).mVector = force;
+		return;
+	}
+
+	mPhysicalVehicle.HackyAPI_GetRigidBody()->ApplyForce(force);
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+LudumDare56::GameState::PhysicsModels::VehicleCommands::Command&
+	LudumDare56::GameState::PhysicsModels::RaycastVehiclePhysicsModelInterface::AddCommand(const VehicleCommands::CommandType commandType)
 {
-	mPhysicalVehicle.Simulate(mPhysicalWorld, kFixedTime);
+	tb_error_if(mCommands.mNumberOfCommands >= VehicleCommands::kMaximumCommands, "Too many VehicleCommands in a step, raise kMaximumCommands.");
+	VehicleCommands::Command& command = mCommands.mCommands[mCommands.mNumberOfCommands];
+	command.mType = commandType;
+	++mCommands.mNumberOfCommands;
+	return command;
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
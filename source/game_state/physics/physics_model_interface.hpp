@@ -25,25 +25,105 @@
 namespace LudumDare56::GameState::PhysicsModels
 {
 	class PhysicsModelInterface;
+	class PhysicsModelBatch;
 
 	typedef std::unique_ptr<PhysicsModelInterface> PhysicsModelInterfacePtr;
 
 	enum class PhysicsModel { NullModel, ExtremelyBasic, ExtremelyFast, ExtremeDrifting };
 
+	///
+	/// @details Everything a physics model needs to carry on simulating exactly where it left off, for the snapshots
+	///   of the RaceSessionState. Each model only fills in, and reads back, the parts that it uses.
+	///
+	struct PhysicsModelState
+	{
+		iceMatrix4 mVehicleToWorld = iceMatrix4::Identity();
+		iceVector3 mLinearVelocity = iceVector3::Zero();
+		iceVector3 mAngularVelocity = iceVector3::Zero();
+		iceVector3 mPreviousVelocity = iceVector3::Zero();
+		iceScalar mEngineSpeed = iceScalar(0.0);
+		Gear mCurrentGear = Gear::Neutral;
+		bool mCanShift = true;
+
+		iceVector3 mBodyTilterVelocity = iceVector3::Zero();
+		iceMatrix4 mBodyToVehicle = iceMatrix4::Identity();
+		iceAngle mBodyRoll = iceAngle::Zero();
+		iceAngle mBodyPitch = iceAngle::Zero();
+
+		tbGame::GameTimer mDriftEndedTimer = 0;
+		bool mIsHandbrakePulled = false;
+	};
+
+	///
+	/// @details What a physics model does to the rigid body of its vehicle during a step. The models of different
+	///   racecars are computed at the same time, see PhysicsModelBatch, so instead of touching the body in the physical
+	///   world they write here, and read back what they wrote. Once the model is computed the commands are applied to
+	///   the body in the order the model gave them, so the body ends up exactly as if the model had touched it directly.
+	///
+	struct VehicleCommands
+	{
+		static const size_t kMaximumCommands = 8;
+
+		enum class CommandType : tbCore::uint8 { SetVehicleToWorld, SetLinearVelocity, SetAngularVelocity, ApplyForce };
+
+		struct Command
+		{
+			CommandType mType = CommandType::ApplyForce;
+			iceMatrix4 mVehicleToWorld = iceMatrix4::Identity();  //Only for SetVehicleToWorld.
+			iceVector3 mVector = iceVector3::Zero();              //The velocity or force for the others.
+		};
+
+		//What the body will be once the commands are applied, for the model to read back.
+		iceMatrix4 mVehicleToWorld = iceMatrix4::Identity();
+		iceVector3 mLinearVelocity = iceVector3::Zero();
+		iceVector3 mAngularVelocity = iceVector3::Zero();
+
+		std::array<Command, kMaximumCommands> mCommands;
+		size_t mNumberOfCommands = 0;
+	};
+
 	class PhysicsModelInterface : public tbCore::Noncopyable
 	{
 	public:
-		PhysicsModelInterface(void);
+		explicit PhysicsModelInterface(const PhysicsModel modelType);
 		virtual ~PhysicsModelInterface(void);
 
+		///
+		/// @details Which of the PhysicsModels this is, so a PhysicsModelBatch can step all the racecars of the same
+		///   model together without going through the virtual OnSimulate() of each.
+		///
+		inline PhysicsModel GetModelType(void) const { return mModelType; }
+
 		/// @note This isn't named terribly well, it was required so the RaycastVehicle (or other physics bodies?) could
 		///   be added to and removed from the PhysicalWorld when enabled/disabled. But PhysicsModel's don't actually
 		///   (strictly) know about a PhysicalWorld so naming these OnAddToWorld/Remove etc, is a little odd too.
 		void SetEnabled(bool isEnabled);
 		void ResetRacecarForces(void);
+
+		///
+		/// @details A step of the model is split in three so the PhysicsModelBatch can compute many models at once.
+		///   OnBeginSimulate() casts the wheels against the physical world, OnSimulate() figures out the forces from the
+		///   controller while only touching this model, and OnEndSimulate() applies those to the physical world. Only
+		///   OnSimulate() is safe to run alongside other models, the others must run one at a time.
+		///
 		void Simulate(const RacecarControllerInterface& racecarController);
 		void DebugRender(void);
 
+		///
+		/// @details When false the models touch the rigid body directly as they step, rather than through the
+		///   VehicleCommands, which is how the racecars were stepped before the PhysicsModelBatch. This is only for
+		///   checking the batch against that, and makes the PhysicsModelBatch step every racecar one at a time.
+		///
+		static void SetDeferringCommands(const bool isDeferringCommands);
+		static bool IsDeferringCommands(void);
+
+		///
+		/// @details Copies the state of the model, or puts it back, without allocating. The model must be the same type
+		///   as the one that saved the state, which the RaceSessionState checks before restoring a snapshot.
+		///
+		void SaveState(PhysicsModelState& state) const;
+		void RestoreState(const PhysicsModelState& state);
+
 		virtual iceMatrix4 GetVehicleToWorld(void) const = 0;
 		virtual void SetVehicleToWorld(const iceMatrix4& vehicleToWorld) = 0;
 		virtual iceMatrix4 GetBodyToWorld(void) const = 0;
@@ -65,19 +145,26 @@ namespace LudumDare56::GameState::PhysicsModels
 
 	protected:
 		virtual void OnSetEnabled(bool /*isEnabled*/) { }
+		virtual void OnSaveState(PhysicsModelState& /*state*/) const { }
+		virtual void OnRestoreState(const PhysicsModelState& /*state*/) { }
 		virtual void OnResetRacecarForces(void) = 0;
+		virtual void OnBeginSimulate(void) { }
 		virtual void OnSimulate(const RacecarControllerInterface& racecarController) = 0;
+		virtual void OnEndSimulate(void) { }
 		virtual void OnDebugRender(void) const = 0;
+
+	private:
+		const PhysicsModel mModelType;
 	};
 
 	PhysicsModelInterfacePtr Instantiate(icePhysics::World& physicalWorld, const PhysicsModel physicsModel);
 
 
 
-	class NullPhysicsModel : public PhysicsModelInterface
+	class NullPhysicsModel final : public PhysicsModelInterface
 	{
 	public:
-		NullPhysicsModel(void) : PhysicsModelInterface()
+		NullPhysicsModel(void) : PhysicsModelInterface(PhysicsModel::NullModel)
 		{
 		}
 
@@ -107,7 +194,8 @@ namespace LudumDare56::GameState::PhysicsModels
 	class RaycastVehiclePhysicsModelInterface : public PhysicsModelInterface
 	{
 	public:
-		RaycastVehiclePhysicsModelInterface(icePhysics::World& physicalWorld, const icePhysics::VehicleInfo& vehicleInfo);
+		RaycastVehiclePhysicsModelInterface(icePhysics::World& physicalWorld, const icePhysics::VehicleInfo& vehicleInfo,
+			const PhysicsModel modelType);
 		virtual ~RaycastVehiclePhysicsModelInterface(void);
 
 		virtual iceMatrix4 GetVehicleToWorld(void) const override;
@@ -122,12 +210,27 @@ namespace LudumDare56::GameState::PhysicsModels
 
 	protected:
 		virtual void OnSetEnabled(bool isEnabled) override;
+		virtual void OnSaveState(PhysicsModelState& state) const override;
+		virtual void OnRestoreState(const PhysicsModelState& state) override;
 		virtual void OnResetRacecarForces(void);
-		virtual void OnSimulate(const RacecarControllerInterface& racecarController);
+		virtual void OnBeginSimulate(void) override;
+		virtual void OnEndSimulate(void) override;
 		virtual void OnDebugRender(void) const override;
 
+		///
+		/// @details Between OnBeginSimulate() and OnEndSimulate() the force is added to the VehicleCommands to be applied
+		///   later, otherwise it goes straight to the rigid body.
+		///
+		void ApplyForce(const iceVector3& force);
+
 		icePhysics::World& mPhysicalWorld;
 		icePhysics::RaycastVehicle mPhysicalVehicle;
+
+	private:
+		VehicleCommands::Command& AddCommand(const VehicleCommands::CommandType commandType);
+
+		VehicleCommands mCommands;
+		bool mIsRecordingCommands;
 	};
 
 
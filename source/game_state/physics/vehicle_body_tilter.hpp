@@ -25,7 +25,7 @@ namespace LudumDare56::GameState::PhysicsModels
 		inline void SimulateBodyRoll(const PhysicsModelInterface& physicsModel)
 		{
 			const iceVector3 vehicleVelocity = physicsModel.GetLinearVelocity();
-			const iceVector3 acceleration = (vehicleVelocity - mPreviousVelocity) / kFixedTime;
+			const iceVector3 acceleration = (vehicleVelocity - mPreviousVelocity) / FixedTime();
 			const iceVector3 accelerationVehicle = physicsModel.GetVehicleToWorld().FastInverse().TransformNormal(acceleration);
 			mPreviousVelocity = vehicleVelocity;
 
@@ -10,6 +10,7 @@
 
 #include "../../ludumdare56.hpp"
 #include "../../game_state/racecar_controller_interface.hpp"
+#include "../../game_state/physics/wheel_torque_table.hpp"
 
 #include <utility>
 
@@ -43,12 +44,6 @@ namespace LudumDare56::GameState::PhysicsModels
 			mCanShift = true;
 		}
 
-		inline iceScalar CalculateWheelTorque(const iceScalar& engineTorque, const Gear& currentGear)
-		{
-			const icePhysics::Scalar gearRatio = HardcodedValues::kGearRatios[currentGear];
-			return engineTorque * gearRatio * HardcodedValues::kFinalRatio;
-		}
-
 		///
 		/// @note 2024-09-04: Not saying this is right, but, it was how OG auto shifting worked :D
 		///
@@ -172,9 +167,10 @@ namespace LudumDare56::GameState::PhysicsModels
 			const iceScalar reverseGearRatio = iceScalar(3.163);
 			const iceVector3 vehicleForwardDirection = -physicsModel.GetVehicleToWorld().GetBasis(2);
 			const iceScalar forwardSpeed = Vector3::Dot(vehicleForwardDirection, physicsModel.GetLinearVelocity());
-			const iceScalar gearRatio = (forwardSpeed < 0.0f) ? -reverseGearRatio : HardcodedValues::kGearRatios[mCurrentGear];
+			const iceScalar overallRatio = (forwardSpeed < 0.0f) ? -reverseGearRatio * HardcodedValues::kFinalRatio :
+				WheelTorqueTable::Miata().GetOverallRatio(mCurrentGear);
 			const iceScalar wheelSpeed = forwardSpeed / wheelRadius;
-			return tbMath::Convert::RadiansSecondToRevolutionsMinute(wheelSpeed * HardcodedValues::kFinalRatio * gearRatio);
+			return tbMath::Convert::RadiansSecondToRevolutionsMinute(wheelSpeed * overallRatio);
 		}
 
 	};
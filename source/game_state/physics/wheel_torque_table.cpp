@@ -0,0 +1,133 @@
+///
+/// @file
+/// @details The torque reaching the driven wheels in each gear, baked from a torque curve and the gear ratios.
+///
+/// <!-- Copyright (c) 2024 Tyre Bytes LLC - All Rights Reserved -->
+///------------------------------------------------------------------------------------------------------------------///
+
+#include "../../game_state/physics/wheel_torque_table.hpp"
+#include "../../game_state/physics/physics_model_interface.hpp"
+#include "../../game_state/physics/vehicle_gear_box.hpp"
+
+#include "../../logging.hpp"
+
+#include <turtle_brains/core/unit_test/tb_unit_test.hpp>
+
+#include <cmath>
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+const LudumDare56::GameState::PhysicsModels::WheelTorqueTable& LudumDare56::GameState::PhysicsModels::WheelTorqueTable::Miata(void)
+{
+	static const WheelTorqueTable theMiataTable(TorqueCurve::MiataTorqueCurve(), HardcodedValues::kFinalRatio, HardcodedValues::kGearRatios);
+	return theMiataTable;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+LudumDare56::GameState::PhysicsModels::WheelTorqueTable::WheelTorqueTable(const TorqueCurve& torqueCurve,
+	const iceScalar finalRatio, const std::array<iceScalar, kNumberOfGears>& gearRatios) :
+	mWheelTorque(),
+	mOverallRatios(),
+	mMinimumRPM(torqueCurve.GetMinimumRPM()),
+	mInverseSpacing(0.0)
+{
+	const iceScalar rangeRPM = torqueCurve.GetMaximumRPM() - mMinimumRPM;
+	mInverseSpacing = (rangeRPM > 0.0) ? static_cast<iceScalar>(kTableSize - 1) / rangeRPM : iceScalar(0.0);
+
+	for (size_t gearIndex = 0; gearIndex < kNumberOfGears; ++gearIndex)
+	{
+		mOverallRatios[gearIndex] = gearRatios[gearIndex] * finalRatio;
+
+		for (size_t tableIndex = 0; tableIndex < kTableSize; ++tableIndex)
+		{	//Sampled at the exact engine speeds of the baked torque table, so this adds no error of its own.
+			const iceScalar fraction = static_cast<iceScalar>(tableIndex) / static_cast<iceScalar>(kTableSize - 1);
+			const iceScalar engineTorque = torqueCurve.GetOutputTorque(mMinimumRPM + rangeRPM * fraction);
+			mWheelTorque[gearIndex][tableIndex] = engineTorque * mOverallRatios[gearIndex];
+		}
+	}
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+iceScalar LudumDare56::GameState::PhysicsModels::WheelTorqueTable::GetWheelTorque(const Gear gear, const iceScalar engineSpeedRPM) const
+{
+	const std::array<iceScalar, kTableSize>& wheelTorque = mWheelTorque[gear];
+
+	const iceScalar position = (engineSpeedRPM - mMinimumRPM) * mInverseSpacing;
+	if (false == (position > iceScalar(0.0)))
+	{	//Also catches NaN.
+		return wheelTorque.front();
+	}
+
+	if (position >= static_cast<iceScalar>(kTableSize - 1))
+	{
+		return wheelTorque.back();
+	}
+
+	const size_t index = static_cast<size_t>(position);
+	const iceScalar percentage = position - static_cast<iceScalar>(index);
+	return wheelTorque[index] + (wheelTorque[index + 1] - wheelTorque[index]) * percentage;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
+
+class WheelTorqueTableTest : tbCore::UnitTest::TestCaseInterface
+{
+public:
+	WheelTorqueTableTest(void) :
+		tbCore::UnitTest::TestCaseInterface("WheelTorqueTableTest")
+	{
+	}
+
+	~WheelTorqueTableTest(void)
+	{
+	}
+
+protected:
+	virtual bool OnRunTest(void) override
+	{
+		using namespace LudumDare56::GameState;
+		using namespace LudumDare56::GameState::PhysicsModels;
+
+		const TorqueCurve torqueCurve = TorqueCurve::MiataTorqueCurve();
+		const WheelTorqueTable& wheelTorqueTable = WheelTorqueTable::Miata();
+
+		//The baked table cuts the corners of the plotted curve only within a sample of each plotted point, which on
+		//  the steepest bend of the Miata curve is well under half a percent of the peak torque.
+		const iceScalar tolerance = torqueCurve.GetMaximumTorque() * iceScalar(0.005);
+
+		//The models clamp the engine speed from 800 to 8500 RPM, so this goes past both ends of the plotted points.
+		for (iceScalar engineSpeed = iceScalar(0.0); engineSpeed <= iceScalar(9000.0); engineSpeed += iceScalar(7.25))
+		{
+			const iceScalar plottedTorque = torqueCurve.GetPlottedOutputTorque(engineSpeed);
+			const iceScalar bakedTorque = torqueCurve.GetOutputTorque(engineSpeed);
+			ExpectedValue(std::abs(bakedTorque - plottedTorque) <= tolerance, true,
+				"Expected the baked torque %f to match the plotted torque %f at %f RPM.", bakedTorque, plottedTorque, engineSpeed);
+
+			for (size_t gearIndex = 0; gearIndex < WheelTorqueTable::kNumberOfGears; ++gearIndex)
+			{
+				const Gear gear = static_cast<Gear>(gearIndex);
+				const iceScalar overallRatio = HardcodedValues::kGearRatios[gear] * HardcodedValues::kFinalRatio;
+				const iceScalar expectedTorque = plottedTorque * overallRatio;
+				const iceScalar wheelTorque = wheelTorqueTable.GetWheelTorque(gear, engineSpeed);
+				ExpectedValue(std::abs(wheelTorque - expectedTorque) <= tolerance * std::abs(overallRatio) + iceScalar(1.0e-6), true,
+					"Expected wheel torque %f to be %f in gear %d at %f RPM.", wheelTorque, expectedTorque, static_cast<int>(gearIndex), engineSpeed);
+			}
+		}
+
+		//Right on the plotted points the baked table should be exact, at least where a sample lands on the point.
+		ExpectedValue(std::abs(torqueCurve.GetOutputTorque(torqueCurve.GetMinimumRPM()) - iceScalar(25.0)) < iceScalar(1.0e-6), true,
+			"Expected the torque at the lowest plotted point to be exact.");
+		ExpectedValue(std::abs(torqueCurve.GetOutputTorque(torqueCurve.GetMaximumRPM())) < iceScalar(1.0e-6), true,
+			"Expected the torque at the highest plotted point to be exact.");
+		ExpectedValue(std::abs(wheelTorqueTable.GetWheelTorque(Gear::Neutral, iceScalar(4500.0))) < iceScalar(1.0e-6), true,
+			"Expected no torque to reach the wheels in neutral.");
+
+		return true;
+	}
+};
+
+WheelTorqueTableTest theWheelTorqueTableTest;
@@ -0,0 +1,62 @@
+///
+/// @file
+/// @details The torque reaching the driven wheels in each gear, baked from a torque curve and the gear ratios.
+///
+/// <!-- Copyright (c) 2024 Tyre Bytes LLC - All Rights Reserved -->
+///------------------------------------------------------------------------------------------------------------------///
+
+#ifndef LudumDare56_WheelTorqueTable_hpp
+#define LudumDare56_WheelTorqueTable_hpp
+
+#include "../../ludumdare56.hpp"
+#include "../../game_state/racecar_controller_interface.hpp"
+#include "../../game_state/helpers/torque_curve.hpp"
+
+#include <array>
+
+namespace LudumDare56::GameState::PhysicsModels
+{
+
+	///
+	/// @details For every gear the full throttle wheel torque is sampled at the same evenly spaced engine speeds as
+	///   the baked table of the TorqueCurve, already multiplied through the gear and final drive ratios, so a physics
+	///   model gets the torque at the wheels with a single interpolation.
+	///
+	/// @note Built once and never changed, so any number of threads may read it.
+	///
+	class WheelTorqueTable
+	{
+	public:
+		static constexpr size_t kNumberOfGears = static_cast<size_t>(Gear::Reverse) + 1;
+		static constexpr size_t kTableSize = TorqueCurve::kBakedTableSize;
+
+		///
+		/// @details The table for the MiataTorqueCurve() through HardcodedValues::kGearRatios and kFinalRatio that
+		///   every physics model drives with, baked the first time it is used.
+		///
+		static const WheelTorqueTable& Miata(void);
+
+		WheelTorqueTable(const TorqueCurve& torqueCurve, const iceScalar finalRatio,
+			const std::array<iceScalar, kNumberOfGears>& gearRatios);
+
+		///
+		/// @details Returns the gear ratio multiplied by the final drive ratio.
+		///
+		inline iceScalar GetOverallRatio(const Gear gear) const { return mOverallRatios[gear]; }
+
+		///
+		/// @details Returns the torque at the wheels, in Nm, with the engine at full throttle and engineSpeedRPM.
+		///   Beyond either end of the torque curve this holds the torque at that end.
+		///
+		iceScalar GetWheelTorque(const Gear gear, const iceScalar engineSpeedRPM) const;
+
+	private:
+		std::array<std::array<iceScalar, kTableSize>, kNumberOfGears> mWheelTorque;
+		std::array<iceScalar, kNumberOfGears> mOverallRatios;
+		iceScalar mMinimumRPM;
+		iceScalar mInverseSpacing;  //Table entries per RPM.
+	};
+
+};	//namespace LudumDare56::GameState::PhysicsModels
+
+#endif /* LudumDare56_WheelTorqueTable_hpp */
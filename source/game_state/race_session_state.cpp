@@ -10,7 +10,12 @@
 #include "../game_state/racetrack_state.hpp"
 #include "../game_state/driver_state.hpp"
 #include "../game_state/timing_and_scoring_state.hpp"
+#include "../game_state/helpers/swarm_kernels.hpp"
+#include "../game_state/helpers/swarm_level_of_detail.hpp"
+#include "../game_state/helpers/simulation_scheduler.hpp"
+#include "../game_state/physics/physics_model_batch.hpp"
 
+#include "../core/worker_pool.hpp"
 #include "../logging.hpp"
 
 #include "../game_state/events/event_safety_checker.hpp"
@@ -21,6 +26,9 @@
 #include <unordered_map>
 #include <map>
 #include <algorithm>
+#include <array>
+#include <vector>
+#include <thread>
 
 namespace
 {
@@ -31,10 +39,19 @@ namespace
 	tbGame::GameTimer thePhaseTimer = 0;
 	tbGame::GameTimer theWorldTimer = 0;
 	bool theTrustedMode = true;
+	bool theDeterministicSwarms = false;
+	tbCore::uint16 theCreaturesPerRacecar = LudumDare56::GameState::kDefaultCreaturesPerRacecar;
 
 	tbCore::tbString theCurrentTrackDisplayName = "";
 	tbCore::tbString theNextRacetrackName = "";
 
+	LudumDare56::GameState::PhysicsModels::PhysicsModelBatch theVehiclePhysics;
+
+	//The rates of the slower subsystems, in runs per simulated second so they keep pace at any tick rate.
+	const tbCore::uint32 kDriverDecisionsPerSecond = 20;
+	const tbCore::uint32 kStandingsPerSecond = 10;
+	LudumDare56::GameState::SimulationScheduler theScheduler;
+
 	class RacetrackLoader : public TrackBundler::BundleProcessorInterface
 	{
 	private:
@@ -47,6 +64,160 @@ namespace
 
 	typedef std::map<LudumDare56::GameState::RacecarIndex, LudumDare56::GameState::GridIndex> StartingGrid;
 	StartingGrid theStartingGrid;
+
+	//Sized from the machine, one core is left for the calling thread which also takes tasks during a ParallelFor().
+	//  The --simulation_workers launch parameter overrides this, 0 runs every task on the calling thread.
+	size_t theNumberOfSimulationWorkers = TyreBytes::Core::WorkerPool::GetRecommendedNumberOfWorkers(std::thread::hardware_concurrency());
+	std::unique_ptr<TyreBytes::Core::WorkerPool> theSimulationWorkers;
+
+	TyreBytes::Core::WorkerPool& TheSimulationWorkers(void)
+	{
+		if (nullptr == theSimulationWorkers)
+		{
+			theSimulationWorkers.reset(new TyreBytes::Core::WorkerPool(theNumberOfSimulationWorkers));
+		}
+
+		return *theSimulationWorkers;
+	}
+
+	///
+	/// @details Saved in the middle of each Simulate() step, just after the physical world has stepped, so the bodies
+	///   have no forces waiting to be applied and nothing about the step in flight needs to be kept.
+	///
+	struct SessionSnapshot
+	{
+		tbCore::uint32 mSimulationStep = 0;
+		bool mIsValid = false;
+		LudumDare56::GameState::RaceSessionState::SessionPhase mSessionPhase = LudumDare56::GameState::RaceSessionState::SessionPhase::kPhaseWaiting;
+		tbGame::GameTimer mPhaseTimer = 0;
+		tbGame::GameTimer mWorldTimer = 0;
+		std::array<LudumDare56::GameState::RacecarState::Snapshot, LudumDare56::GameState::kNumberOfRacecars> mRacecars;
+		LudumDare56::GameState::TimingState::Snapshot mTiming;
+	};
+
+	std::vector<SessionSnapshot> theSnapshots;
+	tbCore::uint32 theSimulationStep = 0;
+
+	void SaveSessionSnapshot(void)
+	{
+		using namespace LudumDare56::GameState;
+
+		if (true == theSnapshots.empty())
+		{
+			return;
+		}
+
+		SessionSnapshot& snapshot = theSnapshots[theSimulationStep % theSnapshots.size()];
+		snapshot.mSimulationStep = theSimulationStep;
+		snapshot.mIsValid = true;
+		snapshot.mSessionPhase = theSessionPhase;
+		snapshot.mPhaseTimer = thePhaseTimer;
+		snapshot.mWorldTimer = theWorldTimer;
+
+		for (const RacecarState& racecar : RacecarState::AllRacecars())
+		{
+			racecar.SaveSnapshot(snapshot.mRacecars[racecar.GetRacecarIndex()]);
+		}
+
+		TimingState::SaveSnapshot(snapshot.mTiming);
+	}
+
+	void SimulateVehicles(void)
+	{
+		using namespace LudumDare56::GameState;
+
+		if (true == RaceSessionState::IsHoldingRacecars())
+		{	//The racecars are pinned to the grid once as the phase changes and nothing else in the world moves, so there
+			//  is no physics or swarm to simulate until the lights go green.
+			return;
+		}
+
+		//The physics models are gathered into groups of the same type and stepped together, see PhysicsModelBatch.
+		theVehiclePhysics.Reset();
+		for (RacecarState& racecar : RacecarState::AllMutableRacecars())
+		{
+			if (false == racecar.IsRacecarInUse())
+			{
+				//Then lock car to grid and done.
+				//racecar.SetVehicleToWorld(RacetrackState::GetSpawnToWorld(racecar.GetRacecarIndex()));
+				continue;
+			}
+
+			racecar.SimulateControls(theVehiclePhysics);
+		}
+
+		theVehiclePhysics.Simulate(TheSimulationWorkers());
+
+		//A sleeping racecar was not added to the batch above, and skips the ground and its swarm below.
+		for (RacecarState& racecar : RacecarState::AllMutableRacecars())
+		{
+			if (true == racecar.IsRacecarInUse() && false == racecar.IsSleeping())
+			{
+				racecar.SimulateVehicle();
+			}
+		}
+	}
+
+	void SimulateSwarms(void)
+	{
+		using namespace LudumDare56::GameState;
+
+		if (true == RaceSessionState::IsHoldingRacecars())
+		{
+			return;
+		}
+
+		//The swarms of different racecars do not touch each other, anything touching shared state stays in
+		//  SimulateVehicle() above, so the results are the same no matter how many workers there are.
+		TheSimulationWorkers().ParallelFor(kNumberOfRacecars, [](const size_t taskIndex) {
+			RacecarState& racecar = RacecarState::GetMutable(static_cast<RacecarIndex::Integer>(taskIndex));
+			if (true == racecar.IsRacecarInUse() && false == racecar.IsSleeping())
+			{
+				racecar.SimulateSwarm();
+			}
+		});
+	}
+
+	LudumDare56::GameState::SimulationScheduler::Tick StepsBetweenRuns(const tbCore::uint32 runsPerSecond)
+	{
+		const tbCore::uint32 tickRate = LudumDare56::GetTickRate();
+		return std::max<tbCore::uint32>(1, (tickRate + runsPerSecond / 2) / runsPerSecond);
+	}
+
+	///
+	/// @details Adds everything in a Simulate() step after the physical world has stepped to theScheduler, which is also
+	///   what gets simulated again when restoring a snapshot. The racetrack components stay at the full rate since the
+	///   finish line looks for creatures crossing it during each step, the swarms already spread their own work with
+	///   the SwarmLevelOfDetail, and the transponders must see every step to keep the lap times exact.
+	///
+	void ScheduleSubsystems(void)
+	{
+		using namespace LudumDare56::GameState;
+
+		const SimulationScheduler::Tick kDriverDecisionsDivisor = StepsBetweenRuns(kDriverDecisionsPerSecond);
+		const SimulationScheduler::Tick kStandingsDivisor = StepsBetweenRuns(kStandingsPerSecond);
+
+		theScheduler.Clear();
+		theScheduler.AddSubsystem("Racetrack", 1, 0, &RacetrackState::Simulate);
+
+		for (RacecarIndex racecarIndex = 0; racecarIndex < kNumberOfRacecars; ++racecarIndex)
+		{	//Each racecar gets its own phase so the drivers are not all deciding on the same tick.
+			const tbCore::tbString name = "Decisions " + tbCore::ToString(static_cast<int>(static_cast<RacecarIndex::Integer>(racecarIndex)));
+			theScheduler.AddSubsystem(name, kDriverDecisionsDivisor, theScheduler.FindQuietestPhase(kDriverDecisionsDivisor), [racecarIndex]() {
+				RacecarState& racecar = RacecarState::GetMutable(racecarIndex);
+				if (true == racecar.IsRacecarInUse() && false == RaceSessionState::IsHoldingRacecars())
+				{
+					racecar.GetMutableRacecarController().UpdateDecisions();
+				}
+			});
+		}
+
+		theScheduler.AddSubsystem("Vehicles", 1, 0, &SimulateVehicles);
+		theScheduler.AddSubsystem("Swarms", 1, 0, &SimulateSwarms);
+		theScheduler.AddSubsystem("Transponders", 1, 0, &TimingState::Simulate);
+		theScheduler.AddSubsystem("Standings", kStandingsDivisor, theScheduler.FindQuietestPhase(kStandingsDivisor),
+			&TimingState::SimulateStandings);
+	}
 };
 
 //Accessed by GameServer launch parameters.
@@ -108,9 +279,18 @@ void LudumDare56::GameState::RaceSessionState::RemoveEventListener(TyreBytes::Co
 
 //--------------------------------------------------------------------------------------------------------------------//
 
-void LudumDare56::GameState::RaceSessionState::Create(const bool isTrusted, const tbCore::tbString& racetrackFilepath)
+void LudumDare56::GameState::RaceSessionState::Create(const bool isTrusted, const tbCore::tbString& racetrackFilepath,
+	const tbCore::uint16 creaturesPerRacecar, const tbCore::uint32 tickRate)
 {
+	tb_error_if(0 == creaturesPerRacecar || creaturesPerRacecar > kMaximumCreaturesPerRacecar,
+		"Expected the swarm size to be within 1 and %d creatures.", kMaximumCreaturesPerRacecar);
+
 	theTrustedMode = isTrusted;
+	theCreaturesPerRacecar = creaturesPerRacecar;
+
+	//Set before anything else is created since the racecars, timers and scheduler all read it.
+	SetTickRate(tickRate);
+	tb_always_log(LogState::Info() << "RaceSessionState is simulating at " << tickRate << " steps per second.");
 
 	tb_debug_log(LogState::Info() << "RaceSessionState is Creating the Physical World!");
 
@@ -162,19 +342,81 @@ void LudumDare56::GameState::RaceSessionState::Create(const bool isTrusted, cons
 	RacetrackState::Create(*thePhysicalWorld);
 
 	theWorldTimer = 0;
+	theSimulationStep = 0;
+	for (SessionSnapshot& snapshot : theSnapshots)
+	{
+		snapshot.mIsValid = false;
+	}
 
 	GridIndex gridIndex = 0;
 	RacecarIndex racecarIndex = 0;
 	for (RacecarState& racecar : RacecarState::AllMutableRacecars())
 	{
 		racecar.SetRacecarIndex(racecarIndex);
-		racecar.Create(*thePhysicalWorld);
+		racecar.Create(*thePhysicalWorld, theCreaturesPerRacecar);
 
 		theStartingGrid[racecarIndex] = gridIndex;
 
 		++racecarIndex;
 		++gridIndex;
 	}
+
+	ScheduleSubsystems();
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+tbCore::uint16 LudumDare56::GameState::RaceSessionState::GetCreaturesPerRacecar(void)
+{
+	return theCreaturesPerRacecar;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void LudumDare56::GameState::RaceSessionState::SetDeterministicSwarms(const bool isDeterministic)
+{
+	theDeterministicSwarms = isDeterministic;
+	SwarmKernels::SetDeterministic(isDeterministic);
+	SwarmLevelOfDetail::SetDeterministic(isDeterministic);
+
+	tb_always_log(LogState::Info() << "The swarms are " << ((true == isDeterministic) ? "deterministic." : "not deterministic."));
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+bool LudumDare56::GameState::RaceSessionState::IsDeterministicSwarms(void)
+{
+	return theDeterministicSwarms;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void LudumDare56::GameState::RaceSessionState::SetNumberOfSimulationWorkers(const size_t numberOfWorkers)
+{
+	//The pool is created again on the next Simulate(), the old workers are joined when it gets destroyed here.
+	theNumberOfSimulationWorkers = numberOfWorkers;
+	theSimulationWorkers.reset();
+
+	tb_always_log(LogState::Info() << "Requested " << numberOfWorkers << " simulation worker threads.");
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+size_t LudumDare56::GameState::RaceSessionState::GetNumberOfSimulationWorkers(void)
+{
+	return theNumberOfSimulationWorkers;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+tbCore::uint64 LudumDare56::GameState::RaceSessionState::ComputeSwarmHash(void)
+{
+	tbCore::uint64 hash = 0;
+	for (const RacecarState& racecar : RacecarState::AllRacecars())
+	{	//Same mixing as boost::hash_combine, so the order of the racecars matters.
+		hash ^= racecar.ComputeSwarmHash() + 0x9e3779b97f4a7c15ull + (hash << 6) + (hash >> 2);
+	}
+	return hash;
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
@@ -210,7 +452,9 @@ void LudumDare56::GameState::RaceSessionState::Destroy(void)
 
 void LudumDare56::GameState::RaceSessionState::Simulate(void)
 {
-	theWorldTimer += kFixedTimeMS;
+	++theSimulationStep;
+	SetFixedTimeStep(theSimulationStep);
+	theWorldTimer += FixedTimeMS();
 
 	if (SessionPhase::kPhaseWaiting == theSessionPhase)
 	{
@@ -219,11 +463,6 @@ void LudumDare56::GameState::RaceSessionState::Simulate(void)
 	}
 	else if (SessionPhase::kPhaseGrid == theSessionPhase)
 	{
-		for (RacecarState& racecar : RacecarState::AllMutableRacecars())
-		{
-			GameState::RaceSessionState::PlaceCarOnGrid(racecar);
-		}
-
 		tb_error_if(true == thePhaseTimer.IsZero(), "This timer should not be zero in a Simulate step without decrementing below.");
 
 		if (true == thePhaseTimer.DecrementStep())
@@ -275,22 +514,92 @@ void LudumDare56::GameState::RaceSessionState::Simulate(void)
 		}
 	}
 
-	thePhysicalWorld->Simulate(kFixedTime);
+	if (false == IsHoldingRacecars())
+	{
+		thePhysicalWorld->Simulate(FixedTime());
+	}
 
-	RacetrackState::Simulate();
-	for (RacecarState& racecar : RacecarState::AllMutableRacecars())
+	//The rest of the step runs through theScheduler, which restoring a snapshot uses to simulate it again.
+	SaveSessionSnapshot();
+	theScheduler.Simulate(theSimulationStep);
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+const LudumDare56::GameState::SimulationScheduler& LudumDare56::GameState::RaceSessionState::GetScheduler(void)
+{
+	return theScheduler;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void LudumDare56::GameState::RaceSessionState::SetNumberOfSnapshots(const size_t numberOfSnapshots)
+{
+	theSnapshots.clear();
+	theSnapshots.shrink_to_fit();
+	theSnapshots.resize(numberOfSnapshots);
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+size_t LudumDare56::GameState::RaceSessionState::GetNumberOfSnapshots(void)
+{
+	return theSnapshots.size();
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+tbCore::uint32 LudumDare56::GameState::RaceSessionState::GetSimulationStep(void)
+{
+	return theSimulationStep;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+bool LudumDare56::GameState::RaceSessionState::RestoreSnapshot(const tbCore::uint32 simulationStep)
+{
+	if (true == theSnapshots.empty())
 	{
-		if (false == racecar.IsRacecarInUse())
+		return false;
+	}
+
+	const SessionSnapshot& snapshot = theSnapshots[simulationStep % theSnapshots.size()];
+	if (false == snapshot.mIsValid || simulationStep != snapshot.mSimulationStep)
+	{
+		return false;
+	}
+
+	for (const RacecarState& racecar : RacecarState::AllRacecars())
+	{
+		if (false == racecar.CanRestoreSnapshot(snapshot.mRacecars[racecar.GetRacecarIndex()]))
 		{
-			//Then lock car to grid and done.
-			//racecar.SetVehicleToWorld(RacetrackState::GetSpawnToWorld(racecar.GetRacecarIndex()));
-			continue;
+			return false;
 		}
+	}
+
+	//Not SetSessionPhase(), the phase is put back as it was without sending events or placing racecars on the grid.
+	theSessionPhase = snapshot.mSessionPhase;
+	thePhaseTimer = snapshot.mPhaseTimer;
+	theWorldTimer = snapshot.mWorldTimer;
+	theSimulationStep = simulationStep;
 
-		racecar.Simulate();
+	for (RacecarState& racecar : RacecarState::AllMutableRacecars())
+	{
+		racecar.RestoreSnapshot(snapshot.mRacecars[racecar.GetRacecarIndex()]);
+	}
+
+	TimingState::RestoreSnapshot(snapshot.mTiming);
+
+	for (SessionSnapshot& laterSnapshot : theSnapshots)
+	{
+		if (laterSnapshot.mSimulationStep > simulationStep)
+		{
+			laterSnapshot.mIsValid = false;
+		}
 	}
 
-	TimingState::Simulate();
+	theScheduler.Simulate(theSimulationStep);
+	return true;
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
@@ -303,6 +612,13 @@ void LudumDare56::GameState::RaceSessionState::PlaceCarOnGrid(RacecarState& race
 
 //--------------------------------------------------------------------------------------------------------------------//
 
+bool LudumDare56::GameState::RaceSessionState::IsHoldingRacecars(void)
+{
+	return (SessionPhase::kPhaseWaiting == theSessionPhase || SessionPhase::kPhaseGrid == theSessionPhase);
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
 LudumDare56::GameState::RaceSessionState::SessionPhase LudumDare56::GameState::RaceSessionState::GetSessionPhase(void)
 {
 	return theSessionPhase;
@@ -324,6 +640,11 @@ void LudumDare56::GameState::RaceSessionState::SetSessionPhase(SessionPhase phas
 	theSessionPhase = phase;
 	thePhaseTimer = phaseTimer;
 
+	for (RacecarState& racecar : RacecarState::AllMutableRacecars())
+	{
+		racecar.WakeUp();
+	}
+
 	switch (phase)
 	{
 	case SessionPhase::kPhasePractice: {
@@ -332,9 +653,16 @@ void LudumDare56::GameState::RaceSessionState::SetSessionPhase(SessionPhase phas
 
 	case SessionPhase::kPhaseGrid: {
 		if (true == IsTrusted() && 0 == phaseTimer)
-		{
+		{	//SetStartingGrid() places every racecar on the new grid.
 			RandomizeStartingGrid();
 		}
+		else
+		{
+			for (RacecarState& racecar : RacecarState::AllMutableRacecars())
+			{
+				PlaceCarOnGrid(racecar);
+			}
+		}
 
 		if (0 != phaseTimer)
 		{	//GameServer or Singleplayer mode is expected to call SetSessionPhase(Grid, nonZero + worstLatency) from
@@ -420,6 +748,14 @@ void LudumDare56::GameState::RaceSessionState::SetStartingGrid(const std::array<
 	}
 	tb_debug_log("");
 
+	if (SessionPhase::kPhaseGrid == theSessionPhase)
+	{	//The racecars are held where they were placed, so they need to move when the grid arrives after the phase.
+		for (RacecarState& racecar : RacecarState::AllMutableRacecars())
+		{
+			PlaceCarOnGrid(racecar);
+		}
+	}
+
 	theRaceSessionBroadcaster.SendEvent(TyreBytes::Core::Event(Events::RaceSession::StartGridChanged));
 }
 
@@ -607,6 +943,11 @@ void LudumDare56::GameState::RaceSessionState::DriverEnterRacecar(const DriverIn
 	racecar.SetRacecarController(new NullRacecarController());
 	racecar.SetRacecarDriver(driverIndex);
 
+	if (SessionPhase::kPhaseGrid == theSessionPhase)
+	{
+		PlaceCarOnGrid(racecar);
+	}
+
 	const DriverState& driver = DriverState::Get(driverIndex);
 	tb_error_if(false == driver.IsDriving(), "Error: Expected the driver to be driving a racecar.");
 	tb_error_if(false == racecar.IsRacecarInUse(), "Error: Expected the racecar to be in use by a driver.");
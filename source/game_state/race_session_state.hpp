@@ -25,6 +25,7 @@ namespace LudumDare56
 	{
 
 		class RacecarState;
+		class SimulationScheduler;
 
 		enum class GridIndexType : tbCore::uint8 { };
 		typedef tbCore::TypedInteger<GridIndexType> GridIndex;
@@ -45,6 +46,9 @@ namespace LudumDare56
 
 		tb_static_error_if(kNumberOfRacecars > kNumberOfDrivers - kNumberOfModerators, "There are not enough regular drivers to fill racecars.");
 
+		constexpr tbCore::uint16 kMaximumCreaturesPerRacecar = 5000;
+		constexpr tbCore::uint16 kDefaultCreaturesPerRacecar = 200;
+
 		bool IsTrusted(void);
 
 		namespace RaceSessionState
@@ -71,11 +75,69 @@ namespace LudumDare56
 			///
 			/// @param isTrusted should only be true for Singleplayer games or Multiplayer Servers. Multiplayer Clients
 			///   are not to be trusted.
+			/// @param creaturesPerRacecar is the size of the swarm each racecar starts with, from 1 to
+			///   kMaximumCreaturesPerRacecar.
+			/// @param tickRate is how many times a second the session is simulated, which must pass IsValidTickRate()
+			///   and match between the GameServer and its clients. The session must be created again to change it.
 			///
-			void Create(const bool isTrusted, const tbCore::tbString& racetrackFilepath = "");
+			void Create(const bool isTrusted, const tbCore::tbString& racetrackFilepath = "",
+				const tbCore::uint16 creaturesPerRacecar = kDefaultCreaturesPerRacecar, const tbCore::uint32 tickRate = kDefaultTickRate);
 			void Destroy(void);
 			void Simulate(void);
 
+			tbCore::uint16 GetCreaturesPerRacecar(void);
+
+			///
+			/// @details Opt-in mode for lockstep and replays where the swarms are simulated bit for bit the same on every
+			///   machine given the same inputs; the swarm kernels stay on the scalar path and the level of detail ignores
+			///   the client view. Off by default since the SIMD kernels are much faster.
+			///
+			void SetDeterministicSwarms(const bool isDeterministic);
+			bool IsDeterministicSwarms(void);
+
+			///
+			/// @details Changes how many worker threads step the swarms and vehicle physics of the racecars, which is one
+			///   less than the hardware threads by default. Must not be called while the session is being simulated.
+			///
+			void SetNumberOfSimulationWorkers(const size_t numberOfWorkers);
+			size_t GetNumberOfSimulationWorkers(void);
+
+			///
+			/// @details Combines RacecarState::ComputeSwarmHash() of every racecar, to compare the swarms between machines.
+			///   Only the creatures go into the hash, the vehicle physics of the racecars are not covered.
+			///
+			tbCore::uint64 ComputeSwarmHash(void);
+
+			///
+			/// @details Runs each subsystem of Simulate() at its own rate; physics, swarms and transponders every step
+			///   while the driver decisions and standings run less often, spread out so they don't land on one step.
+			///   In a development_build each subsystem has a TimeProfiler to watch.
+			///
+			const SimulationScheduler& GetScheduler(void);
+
+			///
+			/// @details Sets how many of the most recent simulation steps are kept as snapshots to roll back to, 0 (the
+			///   default) keeps none. This is the only call that allocates the snapshots, Simulate() writes each step into
+			///   the ring in place and restoring copies back out of it.
+			///
+			void SetNumberOfSnapshots(const size_t numberOfSnapshots);
+			size_t GetNumberOfSnapshots(void);
+
+			///
+			/// @details Counts every call to Simulate() since Create(), the step a snapshot is saved under.
+			///
+			tbCore::uint32 GetSimulationStep(void);
+
+			///
+			/// @details Rolls the racecars, swarms, physics models, controller decisions, timing and session timers back
+			///   to the given step, then simulates that step again with the current controls. Any snapshot after the step is thrown away,
+			///   since the following calls to Simulate() will save them again with the new controls.
+			///
+			/// @return false without changing anything if the step is no longer, or never was, in the ring, or if a
+			///   driver or physics model of any racecar changed since the snapshot was saved.
+			///
+			bool RestoreSnapshot(const tbCore::uint32 simulationStep);
+
 			SessionPhase GetSessionPhase(void);
 			void SetSessionPhase(SessionPhase phase);
 			void SetSessionPhase(SessionPhase phase, tbCore::uint32 phaseTimer);
@@ -104,6 +166,13 @@ namespace LudumDare56
 
 			void PlaceCarOnGrid(RacecarState& racecar);
 
+			///
+			/// @details True while waiting for drivers or sitting on the grid. The racecars and their swarms are pinned
+			///   in place, on the grid they are placed once as the phase changes, and Simulate() skips the physics and
+			///   swarms of every racecar until the race starts.
+			///
+			bool IsHoldingRacecars(void);
+
 			///
 			/// @details This should only be called from a GameServer / Singleplayer mode, and will search through all
 			///   available driver slots to find the first open spot. If none is found, or another issue occurs, then
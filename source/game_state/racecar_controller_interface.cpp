@@ -52,6 +52,48 @@ void LudumDare56::GameState::RacecarControllerInterface::UpdateControls(void)
 	OnUpdateControls();
 }
 
+//--------------------------------------------------------------------------------------------------------------------//
+
+void LudumDare56::GameState::RacecarControllerInterface::UpdateDecisions(void)
+{
+	OnUpdateDecisions();
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void LudumDare56::GameState::RacecarControllerInterface::SaveDecisions(DecisionState& decisionState) const
+{
+	decisionState = DecisionState();
+	OnSaveDecisions(decisionState);
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void LudumDare56::GameState::RacecarControllerInterface::RestoreDecisions(const DecisionState& decisionState)
+{
+	OnRestoreDecisions(decisionState);
+}
+
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+bool LudumDare56::GameState::RacecarControllerInterface::IsIdle(void) const
+{
+	if (0 != mThrottleValue || 0 != mBrakeValue || 0.0f != GetSteeringPercentage())
+	{
+		return false;
+	}
+
+	for (const bool isActionDown : mIsActionDown)
+	{
+		if (true == isActionDown)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
 
 //--------------------------------------------------------------------------------------------------------------------//
 
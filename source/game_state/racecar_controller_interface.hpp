@@ -22,12 +22,32 @@ namespace LudumDare56
 		class RacecarControllerInterface
 		{
 		public:
+			///
+			/// @details Whatever a controller decided for itself in UpdateDecisions() that its controls keep following,
+			///   like the track node an artificial driver is headed for. It is kept in the snapshots of the
+			///   RaceSessionState so a restored step decides the same way again. The controls are not kept, a restored
+			///   step is simulated again with whatever the driver is pressing now.
+			///
+			struct DecisionState
+			{
+				tbCore::uint32 mTargetIndex = ~tbCore::uint32(0);
+			};
+
 			RacecarControllerInterface(void);
 			virtual ~RacecarControllerInterface(void);
 
 			void ResetControls(void);
 			void UpdateControls(void);
 
+			///
+			/// @details Called less often than UpdateControls(), by the scheduler of the RaceSessionState, for the slower
+			///   choices a controller makes, like which way an artificial driver is headed.
+			///
+			void UpdateDecisions(void);
+
+			void SaveDecisions(DecisionState& decisionState) const;
+			void RestoreDecisions(const DecisionState& decisionState);
+
 			inline tbCore::uint16 GetSteeringValue(void) const { return mSteeringValue; }
 			inline tbCore::uint16 GetThrottleValue(void) const { return mThrottleValue; }
 			inline tbCore::uint16 GetBrakeValue(void) const { return mBrakeValue; }
@@ -38,6 +58,12 @@ namespace LudumDare56
 
 			inline Gear GetShifterPosition(void) const { return mShifterPosition; }
 
+			///
+			/// @details Returns true when nothing is being pressed; no throttle, no brake, centered steering and none of
+			///   the driver actions held down.
+			///
+			bool IsIdle(void) const;
+
 			inline bool IsActionPressed(const DriverAction& action) const { return (true == mIsActionDown[static_cast<int>(action)] && false == mWasActionDown[static_cast<int>(action)]); }
 			inline bool IsActionDown(const DriverAction& action) const { return (true == mIsActionDown[static_cast<int>(action)]); }
 
@@ -45,6 +71,9 @@ namespace LudumDare56
 			static const tbCore::uint16 kCenterSteeringValue;
 
 			virtual void OnUpdateControls(void) = 0;
+			virtual void OnUpdateDecisions(void) { }
+			virtual void OnSaveDecisions(DecisionState& /*decisionState*/) const { }
+			virtual void OnRestoreDecisions(const DecisionState& /*decisionState*/) { }
 
 			inline void SetSteeringValue(const tbCore::uint16 steeringValue) { mSteeringValue = steeringValue; }
 			inline void SetSteeringPercentage(const float steeringPercentage)
@@ -9,12 +9,21 @@
 #include "../game_state/racetrack_state.hpp"
 #include "../game_state/driver_state.hpp"
 #include "../game_state/helpers/torque_curve.hpp"
+#include "../game_state/physics/physics_model_batch.hpp"
+#include "../game_state/implementation/flat_test_world.hpp"
 #include "../game_state/events/racecar_events.hpp"
 #include "../game_state/racecar_controller_interface.hpp"
 
 #include "../logging.hpp"
 
+#include <turtle_brains/core/unit_test/tb_unit_test.hpp>
+
+#include <algorithm>
 #include <array>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <memory>
 
 namespace
 {
@@ -27,12 +36,98 @@ namespace
 		PhysicsModel::ExtremelyFast, PhysicsModel::ExtremelyBasic, PhysicsModel::ExtremeDrifting, PhysicsModel::ExtremelyBasic, PhysicsModel::NullModel
 	};
 
+	//Never updated, it is handed to the physics models of finished racecars, which hold onto it until the batch steps.
+	const LudumDare56::GameState::BrakeOnlyRacecarController theBrakesController;
+
+	//Below these speeds, in meters per second, a racecar or creature counts as being at rest for falling asleep. The
+	//  creatures stop facing where they move below the same speed, see GetCreatureToWorld(), so freezing them is unseen.
+	const iceScalar kRestingVehicleSpeed = 0.05;
+	const iceScalar kRestingCreatureSpeed = 0.4;
+
+	//Only the swarm benchmark wants the SwarmStageTimes, so the game skips reading the clock around every stage.
+	bool theIsTimingSwarmStages = false;
+
+	std::chrono::steady_clock::time_point GetSwarmStageTime(void)
+	{
+		return (true == theIsTimingSwarmStages) ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point();
+	}
+
 	typedef std::array<LudumDare56::GameState::RacecarState, LudumDare56::GameState::kNumberOfRacecars> RacecarArray;
 	RacecarArray& TheRacecarArray(void)
 	{
 		static RacecarArray theRacecarArray;
 		return theRacecarArray;
 	}
+
+	typedef LudumDare56::GameState::RacecarState::SweptBounds SweptBounds;
+
+	SweptBounds EmptySweptBounds(void)
+	{
+		const iceScalar kLargest = std::numeric_limits<iceScalar>::max();
+		return SweptBounds{ iceVector3(kLargest, kLargest, kLargest), iceVector3(-kLargest, -kLargest, -kLargest) };
+	}
+
+	const tbCore::uint64 kHashOffsetBasis = 14695981039346656037ull;
+	const tbCore::uint64 kHashPrime = 1099511628211ull;
+
+	tbCore::uint64 HashBytes(tbCore::uint64 hash, const void* data, const size_t numberOfBytes)
+	{
+		const tbCore::uint8* bytes = static_cast<const tbCore::uint8*>(data);
+		for (size_t byteIndex = 0; byteIndex < numberOfBytes; ++byteIndex)
+		{
+			hash = (hash ^ bytes[byteIndex]) * kHashPrime;
+		}
+		return hash;
+	}
+
+	void GrowSweptBounds(SweptBounds& bounds, const iceScalar x, const iceScalar y, const iceScalar z)
+	{
+		bounds.mMinimum.x = std::min(bounds.mMinimum.x, x);
+		bounds.mMinimum.y = std::min(bounds.mMinimum.y, y);
+		bounds.mMinimum.z = std::min(bounds.mMinimum.z, z);
+		bounds.mMaximum.x = std::max(bounds.mMaximum.x, x);
+		bounds.mMaximum.y = std::max(bounds.mMaximum.y, y);
+		bounds.mMaximum.z = std::max(bounds.mMaximum.z, z);
+	}
+
+	typedef LudumDare56::GameState::RacecarState::CreatureSwarm CreatureSwarm;
+
+	typedef std::array<iceScalar, LudumDare56::GameState::RacecarState::kMaximumCreatures> CreatureColumn;
+	const size_t kNumberOfCreatureColumns = 9;
+
+	void SaveCreatureSwarm(const CreatureSwarm& swarm, const size_t numberOfCreatures,
+		std::vector<iceScalar>& creatureValues, std::vector<tbCore::uint8>& creatureFlags)
+	{
+		const std::array<const CreatureColumn*, kNumberOfCreatureColumns> columns = {
+			&swarm.mPositionX, &swarm.mPositionY, &swarm.mPositionZ, &swarm.mVelocityX, &swarm.mVelocityY,
+			&swarm.mVelocityZ, &swarm.mPreviousX, &swarm.mPreviousY, &swarm.mPreviousZ
+		};
+
+		creatureValues.resize(numberOfCreatures * kNumberOfCreatureColumns);
+		for (size_t columnIndex = 0; columnIndex < kNumberOfCreatureColumns; ++columnIndex)
+		{
+			std::copy_n(columns[columnIndex]->begin(), numberOfCreatures, creatureValues.begin() + columnIndex * numberOfCreatures);
+		}
+
+		creatureFlags.assign(swarm.mFlags.begin(), swarm.mFlags.begin() + numberOfCreatures);
+	}
+
+	void RestoreCreatureSwarm(const std::vector<iceScalar>& creatureValues, const std::vector<tbCore::uint8>& creatureFlags,
+		CreatureSwarm& swarm)
+	{
+		const std::array<CreatureColumn*, kNumberOfCreatureColumns> columns = {
+			&swarm.mPositionX, &swarm.mPositionY, &swarm.mPositionZ, &swarm.mVelocityX, &swarm.mVelocityY,
+			&swarm.mVelocityZ, &swarm.mPreviousX, &swarm.mPreviousY, &swarm.mPreviousZ
+		};
+
+		const size_t numberOfCreatures = creatureFlags.size();
+		for (size_t columnIndex = 0; columnIndex < kNumberOfCreatureColumns; ++columnIndex)
+		{
+			std::copy_n(creatureValues.begin() + columnIndex * numberOfCreatures, numberOfCreatures, columns[columnIndex]->begin());
+		}
+
+		std::copy(creatureFlags.begin(), creatureFlags.end(), swarm.mFlags.begin());
+	}
 };
 
 PhysicsModel GetRacecarPhysicsModel(tbCore::uint8 carID);
@@ -51,37 +146,48 @@ LudumDare56::GameState::RacecarState& LudumDare56::GameState::RacecarState::GetM
 	return TheRacecarArray()[racecarIndex];
 }
 
-// 2024-10-06: Yes I'm aware GameState shouldn't being doing sounds, that should be the GameClient... but its a jam.
-tbAudio::AudioController theStartCueController;
-tbAudio::AudioController theMusicController;
-std::vector<tbAudio::AudioController> theCrashSounds;
-
-std::array<tbAudio::AudioController, 3> theEngineControllers;
-
-
 //--------------------------------------------------------------------------------------------------------------------//
 //--------------------------------------------------------------------------------------------------------------------//
 //--------------------------------------------------------------------------------------------------------------------//
 
 LudumDare56::GameState::RacecarState::RacecarState(void) :
-	mCreatures(),
+	mCreatureSwarm(),
+	mCreatureGrid(),
+	mSwarmScratch(),
+	mGroundProbes(2.0, 2.10),
+	mSwarmLevelOfDetail(),
+	mSwarmStageTimes(),
 	mPhysicsModel(new PhysicsModels::NullPhysicsModel()),
 	mController(new NullRacecarController()),
 	mPhysicalWorld(nullptr),
-	mElapsedTime(tbGame::GameTimer::Zero()),
+	mElapsedSteps(0),
+	mIdleTimer(tbGame::GameTimer::Zero()),
+	mSleepingToWorld(iceMatrix4::Identity()),
 	mPreviousPosition(iceVector3::Zero()),
 	mSwarmToWorld(iceMatrix4::Identity()),
+	mSwarmSweptBounds(EmptySweptBounds()),
 	mOnTrackCounter(0),
-	mSwarmHealth(kNumberOfCreatures),
+	mSwarmHealth(kDefaultCreaturesPerRacecar),
+	mNumberOfCreatures(kDefaultCreaturesPerRacecar),
+	mAliveCreatures(),
+	mRacingCreatures(),
+	mNumberOfAliveCreatures(0),
+	mNumberOfRacingCreatures(0),
+	mSwarmAudio{ {}, 0, 0, 0 },
 	mRacecarIndex(InvalidRacecar()),
 	mDriverIndex(InvalidDriver()),
 	mRacecarMeshID(0),
 	mIsOnTrack(false),
 	mIsVisible(false),
+	mIsSleeping(false),
 	mRacecarFinished(false),
 	mCreatureFinished(false),
-	mJustResetted(false)
+	mJustResetted(false),
+	mCreatureListsChanged(false)
 {
+	//Grab all the working memory for the largest swarm up front so nothing reallocates mid-race.
+	mSwarmScratch.Resize(kMaximumCreatures);
+	mGroundProbes.Reset(kMaximumCreatures);
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
@@ -92,9 +198,12 @@ LudumDare56::GameState::RacecarState::~RacecarState(void)
 
 //--------------------------------------------------------------------------------------------------------------------//
 
-void LudumDare56::GameState::RacecarState::Create(icePhysics::World& physicalWorld)
+void LudumDare56::GameState::RacecarState::Create(icePhysics::World& physicalWorld, const CreatureIndex::Integer numberOfCreatures)
 {
 	tb_error_if(false == IsValidRacecar(mRacecarIndex), "Expected the RacecarIndex to be valid by Create().");
+	tb_error_if(0 == numberOfCreatures || numberOfCreatures > kMaximumCreatures, "Expected the swarm size to be within 1 and %d creatures.", kMaximumCreatures);
+
+	mNumberOfCreatures = numberOfCreatures;
 
 	mPhysicalWorld = &physicalWorld;
 	mPhysicsModel = PhysicsModels::Instantiate(physicalWorld, GetRacecarPhysicsModel(mRacecarMeshID));
@@ -102,26 +211,6 @@ void LudumDare56::GameState::RacecarState::Create(icePhysics::World& physicalWor
 	RaceSessionState::PlaceCarOnGrid(*this);
 
 	ResetRacecar(GetVehicleToWorld());
-
-	theEngineControllers = std::array<tbAudio::AudioController, 3>{
-		tbAudio::theAudioManager.PlayEvent("audio_events", "engine_1"),
-		tbAudio::theAudioManager.PlayEvent("audio_events", "engine_2"),
-		tbAudio::theAudioManager.PlayEvent("audio_events", "engine_3")
-	};
-
-	for (tbAudio::AudioController& controller : theEngineControllers)
-	{
-		controller.SetVolume(0.0f);
-	}
-
-
-	theStartCueController = tbAudio::theAudioManager.PlayEvent("audio_events", "start_countdown");
-	theStartCueController.Stop();
-
-	if (true == theMusicController.IsComplete())
-	{
-		theMusicController = tbAudio::theAudioManager.PlayEvent("audio_events", "music");
-	}
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
@@ -130,12 +219,6 @@ void LudumDare56::GameState::RacecarState::Destroy(icePhysics::World& /*physical
 {
 	mPhysicalWorld = nullptr;
 	mPhysicsModel.reset(new PhysicsModels::NullPhysicsModel());
-
-	theStartCueController.Stop();
-	for (tbAudio::AudioController& controller : theEngineControllers)
-	{
-		controller.Stop();
-	}
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
@@ -151,44 +234,70 @@ void LudumDare56::GameState::RacecarState::ResetRacecar(const iceMatrix4& vehicl
 		iceVector3(-1.36860, -0.65165, 0.77294), iceVector3(-0.98504, -0.64692, 0.17409), iceVector3(1.11580, -0.64314, 1.54648), iceVector3(1.18518, -0.64033, 1.97437), iceVector3(-2.37489, -0.63850, 0.00899), iceVector3(-1.99235, -0.65166, -0.22435), iceVector3(1.21515, -0.64692, -0.97703), iceVector3(-1.21260, -0.64315, -2.03696), iceVector3(-1.70956, -0.64033, -0.96846), iceVector3(0.92643, -0.63850, -0.92804), iceVector3(1.84888, -0.65165, 1.45760), iceVector3(0.07323, -0.64692, -2.86069), iceVector3(-0.49374, -0.64314, 0.91751), iceVector3(0.71278, -0.64033, 0.64649), iceVector3(0.20085, -0.63850, -2.40368), iceVector3(-0.35677, -0.65165, 0.64018), iceVector3(0.82492, -0.64692, 1.28794), iceVector3(-0.38625, -0.64315, -0.88058), iceVector3(0.36404, -0.64034, -1.96735), iceVector3(0.76700, -0.63850, -0.65134), iceVector3(-0.99507, -0.65166, -0.84158), iceVector3(1.81115, -0.64692, 0.08916), iceVector3(-1.43317, -0.64315, -2.42901), iceVector3(-2.19207, -0.64033, 0.96841), iceVector3(1.16939, -0.63850, 0.58052), iceVector3(-1.93505, -0.65165, 1.37666), iceVector3(1.54930, -0.64692, 1.76241), iceVector3(-0.92806, -0.64315, -1.27877), iceVector3(-0.48589, -0.64033, -1.20852), iceVector3(1.06970, -0.63850, -2.60238), iceVector3(-0.84129, -0.65166, -1.76139), iceVector3(-0.04981, -0.64692, 1.59510), iceVector3(-1.31765, -0.64314, 0.00285), iceVector3(1.85050, -0.64033, 0.53248), iceVector3(0.26363, -0.63850, -0.56551), iceVector3(-2.82462, -0.65166, -0.31072), iceVector3(-0.76666, -0.64692, 1.06474), iceVector3(0.38100, -0.64315, -1.53343), iceVector3(1.39273, -0.64033, -0.68879), iceVector3(2.29714, -0.63850, 0.73809), iceVector3(2.73295, -0.65166, -0.79922), iceVector3(-1.15021, -0.64692, -0.56206), iceVector3(-2.33943, -0.64314, 0.49562), iceVector3(1.43973, -0.64033, 1.27839), iceVector3(-0.61551, -0.63850, -0.68020), iceVector3(-1.19719, -0.65166, -1.57719), iceVector3(0.71147, -0.64692, 0.99463), iceVector3(0.10054, -0.64314, 1.07960), iceVector3(-0.45331, -0.64033, -0.20579), iceVector3(-1.95868, -0.63850, -0.63144), iceVector3(-0.01615, -0.65166, 0.06482), iceVector3(-1.97189, -0.64692, 0.19355), iceVector3(-2.51847, -0.64315, -1.32589), iceVector3(-1.35807, -0.64033, -0.81375), iceVector3(0.95051, -0.63850, -1.25064), iceVector3(-1.87393, -0.65166, -2.14219), iceVector3(-2.57297, -0.64692, 1.20950), iceVector3(-1.72424, -0.64314, 0.96717), iceVector3(2.06612, -0.64033, 1.10949), iceVector3(0.92609, -0.63850, 0.38873), iceVector3(2.19109, -0.65166, -0.88149), iceVector3(0.46854, -0.64692, -0.78856), iceVector3(-0.08465, -0.64314, -0.75582), iceVector3(0.11186, -0.64033, 0.78510), iceVector3(-0.47185, -0.63850, -2.80628), iceVector3(1.70516, -0.65165, 0.92422), iceVector3(-0.97773, -0.64692, -2.67253), iceVector3(-2.75270, -0.64314, 0.71670), iceVector3(2.27139, -0.64033, -1.69169), iceVector3(0.36678, -0.63850, 2.80875), iceVector3(2.36384, -0.65165, 1.57328), iceVector3(-0.70817, -0.64692, 1.42463), iceVector3(0.98636, -0.64314, 0.83006), iceVector3(1.51838, -0.64033, -0.37971), iceVector3(-1.49150, -0.63850, -1.30648), iceVector3(-0.02073, -0.65165, 1.99212), iceVector3(0.70403, -0.64692, -0.13308), iceVector3(0.67187, -0.64315, -1.40555), iceVector3(0.25692, -0.64033, 0.49774), iceVector3(2.30346, -0.63850, -0.47285), iceVector3(0.20555, -0.65165, 1.38404), iceVector3(-0.44172, -0.64692, 1.93477), iceVector3(-2.22349, -0.64315, -1.75075), iceVector3(-0.75077, -0.64033, -0.22931), iceVector3(-0.00991, -0.63850, 0.00752), iceVector3(-0.37823, -0.65166, -0.52706), iceVector3(0.04966, -0.64692, -1.63639), iceVector3(0.11269, -0.64315, -1.32710), iceVector3(-1.62387, -0.64033, 1.72876), iceVector3(0.39103, -0.63850, -0.12956), iceVector3(-0.73410, -0.65166, -1.01636), iceVector3(-0.29987, -0.64692, -2.39769), iceVector3(0.70880, -0.64315, -1.78273), iceVector3(1.06937, -0.64033, -1.63604), iceVector3(-1.31536, -0.63850, 0.31333), iceVector3(0.87282, -0.65166, -0.36313), iceVector3(-0.64656, -0.64692, -1.45006), iceVector3(1.21522, -0.64314, 0.20482), iceVector3(-0.46335, -0.64034, -2.00548), iceVector3(-1.91998, -0.63850, 0.60491), iceVector3(1.89599, -0.65166, -0.27452), iceVector3(1.03620, -0.64692, -0.04434), iceVector3(0.53401, -0.64314, -0.42221), iceVector3(0.55586, -0.64033, 1.44465), iceVector3(1.95038, -0.63850, -2.06638), iceVector3(-0.80551, -0.65166, -2.24203), iceVector3(-0.44802, -0.64692, 1.25399), iceVector3(-0.65095, -0.64314, 2.76289), iceVector3(0.55071, -0.64033, 0.44427), iceVector3(0.68710, -0.63850, -2.25917), iceVector3(1.22823, -0.65166, -0.28820), iceVector3(0.36971, -0.64692, -1.16780), iceVector3(2.77787, -0.64314, 0.15631), iceVector3(0.43135, -0.64033, 1.14523), iceVector3(-1.46886, -0.63850, 1.28693), iceVector3(1.34133, -0.65166, -1.34707), iceVector3(-1.20104, -0.64692, 1.04275), iceVector3(2.30940, -0.64314, -0.05281), iceVector3(0.18468, -0.64033, -0.26713), iceVector3(1.97463, -0.63850, -1.22592), iceVector3(-1.11213, -0.65165, 0.54677), iceVector3(0.77083, -0.64692, 0.16033), iceVector3(-2.70980, -0.64315, -0.84238), iceVector3(-0.15722, -0.64033, 1.28464), iceVector3(2.81169, -0.63850, -0.30533), iceVector3(-1.21569, -0.65165, 2.05981), iceVector3(1.46315, -0.64692, -0.06218), iceVector3(-1.20817, -0.64314, 1.62497), iceVector3(0.76133, -0.64033, 1.74957), iceVector3(-1.53982, -0.63850, 0.51993), iceVector3(1.51085, -0.65165, 0.24870), iceVector3(-1.91813, -0.64692, -1.40594), iceVector3(1.73169, -0.64315, -1.53514), iceVector3(1.80426, -0.64033, -0.65640), iceVector3(0.18927, -0.63850, 2.39576), iceVector3(-1.58553, -0.65165, 2.34818), iceVector3(0.17818, -0.64692, -0.91352), iceVector3(-0.38185, -0.64314, 1.57558), iceVector3(-2.17721, -0.64033, -1.00018), iceVector3(-0.01218, -0.63850, 0.00300), iceVector3(-0.19039, -0.65166, -0.22104), iceVector3(-1.61282, -0.64692, -0.19293), iceVector3(0.17547, -0.64314, 0.23395), iceVector3(-0.69051, -0.64033, 0.65728), iceVector3(-0.20511, -0.63850, -1.39346), iceVector3(-0.35774, -0.65166, -1.62953), iceVector3(1.59468, -0.64692, -1.01092), iceVector3(-0.29892, -0.64314, 2.34976), iceVector3(-2.37140, -0.64033, -0.49532), iceVector3(1.27331, -0.63850, 2.50947), iceVector3(-0.03574, -0.65166, -2.01858), iceVector3(2.78050, -0.64692, 0.61733), iceVector3(0.64986, -0.64315, -1.06703), iceVector3(0.41911, -0.64033, 0.80610), iceVector3(-2.29379, -0.63850, 1.64058), iceVector3(-1.13324, -0.65165, 2.59941), iceVector3(-0.12957, -0.64692, -1.07504), iceVector3(-1.32384, -0.64314, -0.32498), iceVector3(-0.05863, -0.64033, 0.51943), iceVector3(-0.35246, -0.63850, 0.05640), iceVector3(1.67097, -0.65165, 2.26898), iceVector3(-0.45094, -0.64692, 0.36250), iceVector3(1.09517, -0.64314, 1.12706), iceVector3(1.53238, -0.64034, -2.39232), iceVector3(0.46056, -0.63850, 0.15011), iceVector3(-1.60860, -0.65166, 0.16265), iceVector3(-2.83122, -0.64692, 0.20300), iceVector3(-0.15298, -0.64314, 0.25077), iceVector3(0.60112, -0.64034, -2.76597), iceVector3(0.01885, -0.63850, -0.00811), iceVector3(-0.15098, -0.65165, 2.83859), iceVector3(-0.66335, -0.64692, 0.09536), iceVector3(-0.83124, -0.64314, 1.79356), iceVector3(-0.00099, -0.64033, -0.00579), iceVector3(1.11280, -0.63850, -0.60569), iceVector3(2.60745, -0.65165, 1.12492), iceVector3(-1.97391, -0.64692, 2.03793), iceVector3(-0.99175, -0.64314, 1.28916), iceVector3(1.34088, -0.64033, 0.87060), iceVector3(-0.79045, -0.63850, 0.39158), iceVector3(-0.97759, -0.65165, 0.82551), iceVector3(-1.60908, -0.64692, -1.77765), iceVector3(-0.01723, -0.64314, -0.03254), iceVector3(2.22055, -0.64033, 0.33500), iceVector3(0.82175, -0.63850, 2.21947), iceVector3(-0.18240, -0.65165, 0.90521), iceVector3(0.31166, -0.64692, 1.69518), iceVector3(0.43650, -0.64314, 2.06972), iceVector3(-1.17425, -0.64033, -1.09062), iceVector3(0.81656, -0.63850, 2.69503), iceVector3(1.47180, -0.65165, 0.54769), iceVector3(-0.83187, -0.64692, -0.50755), iceVector3(2.53020, -0.64315, -1.27340), iceVector3(-1.01614, -0.64033, -0.15236), iceVector3(-1.55236, -0.63850, -0.54323), iceVector3(1.11363, -0.65166, -2.09838), iceVector3(2.04721, -0.64692, 1.96108), iceVector3(1.49474, -0.64315, -1.85873), iceVector3(-0.03715, -0.64033, -0.47281), iceVector3(-0.76971, -0.63850, 2.25746),
 	};
 
-	iceScalar creatureY = vehicleToWorld.GetPosition().y + 0.06f;
+	const iceScalar creatureY = vehicleToWorld.GetPosition().y + 0.06f;
+	mSwarmSweptBounds = EmptySweptBounds();
 
-	CreatureIndex creatureIndex = 0;
-	for (Creature& creature : mCreatures)
+	for (CreatureIndex creatureIndex = 0; creatureIndex < mNumberOfCreatures; ++creatureIndex)
 	{
 		//const iceMatrix4 creatureToVehicle = iceMatrix4::Translation(tbMath::RandomFloat(-range, range),
 		//	0.0f, tbMath::RandomFloat(-range, range));
 
-		const iceMatrix4 creatureToVehicle = iceMatrix4::Translation(placementSpots[creatureIndex]);
-
-		creature.mCreatureToWorld = creatureToVehicle * vehicleToWorld;
-		creature.mCreatureToWorld.SetPosition(creature.mCreatureToWorld.GetPosition().x, creatureY, creature.mCreatureToWorld.GetPosition().z);
-		creature.mPreviousPosition = creature.mCreatureToWorld.GetPosition();
-		creature.mVelocity = iceVector3::Zero();
-		creature.mIsOnTrack = true;
-		creature.mIsAlive = true;
-		creature.mIsRacing = true;
+		iceVector3 placementSpot = iceVector3::Zero();
+		if (creatureIndex < placementSpots.size())
+		{
+			placementSpot = placementSpots[creatureIndex];
+		}
+		else
+		{	//Larger swarms continue outward in a sunflower spiral, keeping roughly the density of the spots above.
+			const iceScalar spiralIndex = static_cast<iceScalar>(static_cast<CreatureIndex::Integer>(creatureIndex));
+			const iceScalar radius = 2.9 * std::sqrt(spiralIndex / static_cast<iceScalar>(placementSpots.size()));
+			const iceScalar angle = spiralIndex * 2.39996323; //golden angle in radians
+			placementSpot = iceVector3(radius * std::cos(angle), -0.645, radius * std::sin(angle));
+		}
 
-		++creatureIndex;
+		const iceMatrix4 creatureToVehicle = iceMatrix4::Translation(placementSpot);
+		const iceVector3 position = (creatureToVehicle * vehicleToWorld).GetPosition();
+
+		mCreatureSwarm.mPositionX[creatureIndex] = position.x;
+		mCreatureSwarm.mPositionY[creatureIndex] = creatureY;
+		mCreatureSwarm.mPositionZ[creatureIndex] = position.z;
+		mCreatureSwarm.mPreviousX[creatureIndex] = position.x;
+		mCreatureSwarm.mPreviousY[creatureIndex] = creatureY;
+		mCreatureSwarm.mPreviousZ[creatureIndex] = position.z;
+		mCreatureSwarm.mVelocityX[creatureIndex] = 0.0;
+		mCreatureSwarm.mVelocityY[creatureIndex] = 0.0;
+		mCreatureSwarm.mVelocityZ[creatureIndex] = 0.0;
+		mCreatureSwarm.mFlags[creatureIndex] = kCreatureIsAlive | kCreatureIsOnTrack | kCreatureIsRacing;
+		mAliveCreatures[creatureIndex] = creatureIndex;
+		mRacingCreatures[creatureIndex] = creatureIndex;
+		GrowSweptBounds(mSwarmSweptBounds, position.x, creatureY, position.z);
 	}
 
+	mNumberOfAliveCreatures = mNumberOfCreatures;
+	mNumberOfRacingCreatures = mNumberOfCreatures;
+	mCreatureListsChanged = false;
+
 	mPreviousPosition = vehicleToWorld.GetPosition();
+	mSwarmLevelOfDetail.Reset();
 
-	if (RaceSessionState::GetWorldTimer() < 100 && true == theStartCueController.IsComplete())
-	{
-		theStartCueController.Play();
-	}
-	else if (RaceSessionState::GetWorldTimer() > 5000)
-	{
-		tb_debug_log("World Timer: " << RaceSessionState::GetWorldTimer());
-		tbAudio::theAudioManager.PlayEvent("audio_events", "start");
-	}
+	mSwarmAudio.mEngineSpeeds.fill(-1.0f);
+	mSwarmAudio.mResetWorldTimer = RaceSessionState::GetWorldTimer();
+	++mSwarmAudio.mNumberOfResets;
 
-	mElapsedTime = 0;
+	mElapsedSteps = 0;
 	mRacecarFinished = false;
 	mCreatureFinished = false;
 	mJustResetted = true;
-	mSwarmHealth = kNumberOfCreatures;
+	mSwarmHealth = mNumberOfCreatures;
+
+	WakeUp();
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+LudumDare56::GameState::RacecarState::CreatureIndex::Integer LudumDare56::GameState::RacecarState::GetMinimumCreatures(void) const
+{
+	return static_cast<CreatureIndex::Integer>(static_cast<float>(mNumberOfCreatures) * kMinimumCreaturesFraction);
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
@@ -291,6 +400,112 @@ icePhysics::Matrix4 LudumDare56::GameState::RacecarState::GetWheelToWorld(const
 
 //--------------------------------------------------------------------------------------------------------------------//
 
+tbCore::uint64 LudumDare56::GameState::RacecarState::ComputeSwarmHash(void) const
+{
+	const CreatureSwarm& swarm = mCreatureSwarm;
+	const size_t numberOfCreatures = mNumberOfCreatures;
+
+	tbCore::uint64 hash = kHashOffsetBasis;
+	hash = HashBytes(hash, swarm.mPositionX.data(), numberOfCreatures * sizeof(iceScalar));
+	hash = HashBytes(hash, swarm.mPositionY.data(), numberOfCreatures * sizeof(iceScalar));
+	hash = HashBytes(hash, swarm.mPositionZ.data(), numberOfCreatures * sizeof(iceScalar));
+	hash = HashBytes(hash, swarm.mVelocityX.data(), numberOfCreatures * sizeof(iceScalar));
+	hash = HashBytes(hash, swarm.mVelocityY.data(), numberOfCreatures * sizeof(iceScalar));
+	hash = HashBytes(hash, swarm.mVelocityZ.data(), numberOfCreatures * sizeof(iceScalar));
+	hash = HashBytes(hash, swarm.mFlags.data(), numberOfCreatures * sizeof(tbCore::uint8));
+	return hash;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void LudumDare56::GameState::RacecarState::SaveSnapshot(Snapshot& snapshot) const
+{
+	SaveCreatureSwarm(mCreatureSwarm, mNumberOfCreatures, snapshot.mCreatureValues, snapshot.mCreatureFlags);
+	snapshot.mAliveCreatures.assign(mAliveCreatures.begin(), mAliveCreatures.begin() + mNumberOfAliveCreatures);
+	snapshot.mRacingCreatures.assign(mRacingCreatures.begin(), mRacingCreatures.begin() + mNumberOfRacingCreatures);
+	snapshot.mSwarmLevelOfDetail = mSwarmLevelOfDetail;
+
+	snapshot.mPhysicsModel = (nullptr == mPhysicsModel) ? PhysicsModel::NullModel : mPhysicsModel->GetModelType();
+	if (nullptr != mPhysicsModel)
+	{
+		mPhysicsModel->SaveState(snapshot.mPhysicsModelState);
+	}
+
+	mController->SaveDecisions(snapshot.mControllerDecisions);
+
+	snapshot.mElapsedSteps = mElapsedSteps;
+	snapshot.mIdleTimer = mIdleTimer;
+	snapshot.mSleepingToWorld = mSleepingToWorld;
+	snapshot.mPreviousPosition = mPreviousPosition;
+	snapshot.mSwarmToWorld = mSwarmToWorld;
+	snapshot.mSwarmSweptBounds = mSwarmSweptBounds;
+	snapshot.mSwarmVelocity = mSwarmVelocity;
+	snapshot.mOnTrackCounter = mOnTrackCounter;
+	snapshot.mSwarmHealth = mSwarmHealth;
+	snapshot.mNumberOfCreatures = mNumberOfCreatures;
+	snapshot.mSwarmAudio = mSwarmAudio;
+	snapshot.mDriverIndex = mDriverIndex;
+
+	snapshot.mIsOnTrack = mIsOnTrack;
+	snapshot.mIsSleeping = mIsSleeping;
+	snapshot.mRacecarFinished = mRacecarFinished;
+	snapshot.mCreatureFinished = mCreatureFinished;
+	snapshot.mJustResetted = mJustResetted;
+	snapshot.mCreatureListsChanged = mCreatureListsChanged;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+bool LudumDare56::GameState::RacecarState::CanRestoreSnapshot(const Snapshot& snapshot) const
+{
+	const PhysicsModel physicsModel = (nullptr == mPhysicsModel) ? PhysicsModel::NullModel : mPhysicsModel->GetModelType();
+	return snapshot.mDriverIndex == mDriverIndex && snapshot.mPhysicsModel == physicsModel &&
+		snapshot.mNumberOfCreatures <= kMaximumCreatures && snapshot.mCreatureFlags.size() == snapshot.mNumberOfCreatures &&
+		snapshot.mAliveCreatures.size() <= snapshot.mNumberOfCreatures && snapshot.mRacingCreatures.size() <= snapshot.mNumberOfCreatures;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void LudumDare56::GameState::RacecarState::RestoreSnapshot(const Snapshot& snapshot)
+{
+	tb_error_if(false == CanRestoreSnapshot(snapshot), "Expected the snapshot to be for the same driver and physics model.");
+
+	RestoreCreatureSwarm(snapshot.mCreatureValues, snapshot.mCreatureFlags, mCreatureSwarm);
+	std::copy(snapshot.mAliveCreatures.begin(), snapshot.mAliveCreatures.end(), mAliveCreatures.begin());
+	std::copy(snapshot.mRacingCreatures.begin(), snapshot.mRacingCreatures.end(), mRacingCreatures.begin());
+	mSwarmLevelOfDetail = snapshot.mSwarmLevelOfDetail;
+
+	if (nullptr != mPhysicsModel)
+	{
+		mPhysicsModel->RestoreState(snapshot.mPhysicsModelState);
+	}
+
+	mController->RestoreDecisions(snapshot.mControllerDecisions);
+
+	mElapsedSteps = snapshot.mElapsedSteps;
+	mIdleTimer = snapshot.mIdleTimer;
+	mSleepingToWorld = snapshot.mSleepingToWorld;
+	mPreviousPosition = snapshot.mPreviousPosition;
+	mSwarmToWorld = snapshot.mSwarmToWorld;
+	mSwarmSweptBounds = snapshot.mSwarmSweptBounds;
+	mSwarmVelocity = snapshot.mSwarmVelocity;
+	mOnTrackCounter = snapshot.mOnTrackCounter;
+	mSwarmHealth = snapshot.mSwarmHealth;
+	mNumberOfCreatures = snapshot.mNumberOfCreatures;
+	mNumberOfAliveCreatures = tbCore::RangedCast<CreatureIndex::Integer>(snapshot.mAliveCreatures.size());
+	mNumberOfRacingCreatures = tbCore::RangedCast<CreatureIndex::Integer>(snapshot.mRacingCreatures.size());
+	mSwarmAudio = snapshot.mSwarmAudio;
+
+	mIsOnTrack = snapshot.mIsOnTrack;
+	mIsSleeping = snapshot.mIsSleeping;
+	mRacecarFinished = snapshot.mRacecarFinished;
+	mCreatureFinished = snapshot.mCreatureFinished;
+	mJustResetted = snapshot.mJustResetted;
+	mCreatureListsChanged = snapshot.mCreatureListsChanged;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
 void LudumDare56::GameState::RacecarState::OnRacecarFinished(void)
 {
 	mRacecarFinished = true;
@@ -301,14 +516,32 @@ void LudumDare56::GameState::RacecarState::OnRacecarFinished(void)
 void LudumDare56::GameState::RacecarState::OnCreatureFinished(const CreatureIndex& creatureIndex)
 {
 	mCreatureFinished = true;
-	mCreatures[creatureIndex].mIsRacing = false;
+	mCreatureSwarm.SetFlag(creatureIndex, kCreatureIsRacing, false);
+	mCreatureListsChanged = true;
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
 
 icePhysics::Matrix4 LudumDare56::GameState::RacecarState::GetCreatureToWorld(const CreatureIndex& creatureIndex) const
 {
-	return mCreatures[creatureIndex].mCreatureToWorld;
+	const Creature creature = GetCreature(creatureIndex);
+	const iceVector3 velocity = creature.GetVelocity();
+
+	iceScalar flatSpeed = 0.0;
+	if (true == creature.IsOnTrack())
+	{
+		flatSpeed = iceVector3(velocity.x, 0.0, velocity.z).Magnitude();
+	}
+
+	const iceVector3 direction = (flatSpeed > 0.4) ? velocity.GetNormalized() : -GetVehicleToWorld().GetBasis(2);
+	const iceVector3 right = Vector3::Cross(direction, Vector3::Up());
+
+	iceMatrix4 creatureToWorld = iceMatrix4::Identity();
+	creatureToWorld.SetBasis(0, right);
+	creatureToWorld.SetBasis(1, Vector3::Up());
+	creatureToWorld.SetBasis(2, -direction);
+	creatureToWorld.SetPosition(creature.GetPosition());
+	return creatureToWorld;
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
@@ -337,6 +570,11 @@ icePhysics::Matrix4 LudumDare56::GameState::RacecarState::GetVehicleToWorld(void
 void LudumDare56::GameState::RacecarState::SetVehicleToWorld(const iceMatrix4& vehicleToWorld)
 {
 	mPhysicsModel->SetVehicleToWorld(vehicleToWorld);
+	if (true == mIsSleeping)
+	{	//A sleeping racecar gets held where it fell asleep, so anything moving it, like an update from the GameServer,
+		//  must move that spot too or the next SimulateControls() snaps it right back.
+		mSleepingToWorld = vehicleToWorld;
+	}
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
@@ -383,74 +621,169 @@ LudumDare56::GameState::Gear LudumDare56::GameState::RacecarState::GetShifterPos
 
 //--------------------------------------------------------------------------------------------------------------------//
 
-void LudumDare56::GameState::RacecarState::Simulate(void)
+void LudumDare56::GameState::RacecarState::SimulateControls(PhysicsModels::PhysicsModelBatch& vehiclePhysics)
 {
-	//if (true == tbApplication::Input::IsKeyDown(tbApplication::tbKeyP))
-	//{
-	//	tb_debug_log("\n\n\n\n\n-------------------\n");
-	//	tb_debug_log("std::vector<> = { " << tbCore::Debug::ContinueEntry());
-
-	//	const iceMatrix4 worldToVehicle = GetVehicleToWorld().ComputeInverse();
-	//	for (const Creature& creature : mCreatures)
-	//	{
-	//		const iceVector3 positionWorld = creature.mCreatureToWorld.GetPosition();
-	//		const iceVector3 positionVehicle = worldToVehicle.TransformCoordinate(positionWorld);
-	//		tb_debug_log("iceVector3(" << positionVehicle << "),\n" << tbCore::Debug::ContinueEntry());
-	//	}
-
-	//	tb_debug_log("}\n\n");
-	//}
-
 	mPreviousPosition = GetVehicleToWorld().GetPosition();
 
-	if (false == mRacecarFinished && false == HasLost())
+	const bool isRacing = (false == mRacecarFinished && false == HasLost());
+	if (true == isRacing)
 	{
 		if (false == mJustResetted)
 		{
-			mElapsedTime.IncrementStep();
+			++mElapsedSteps;
 		}
 		mJustResetted = false;
 
 		mController->UpdateControls();
-		mPhysicsModel->Simulate(*mController);
+	}
+
+	if (true == mIsSleeping)
+	{	//Only gravity acts on a sleeping racecar, so anything moving it sideways or spinning it was something bumping it.
+		const iceVector3 linearVelocity = GetLinearVelocity();
+		const iceScalar flatSpeed = iceVector3(linearVelocity.x, 0.0, linearVelocity.z).Magnitude();
+		const bool wasBumped = (flatSpeed > kRestingVehicleSpeed || GetAngularVelocity().Magnitude() > kRestingVehicleSpeed);
+
+		if (false == wasBumped && (false == isRacing || true == mController->IsIdle()))
+		{	//Held where it fell asleep, or gravity would slowly pull it through the ground without the suspension.
+			SetVehicleToWorld(mSleepingToWorld);
+			mPhysicsModel->ResetRacecarForces();
+			return;
+		}
+
+		WakeUp();
+	}
+
+	if (true == isRacing)
+	{
+		vehiclePhysics.AddVehicle(*mPhysicsModel, *mController);
 	}
 	else
 	{
-		BrakeOnlyRacecarController brakesController;
-		mPhysicsModel->Simulate(brakesController);
+		vehiclePhysics.AddVehicle(*mPhysicsModel, theBrakesController);
+	}
+}
 
-		mPhysicsModel->SetLinearVelocity(mPhysicsModel->GetLinearVelocity() * 0.5f * kFixedTime);
+//--------------------------------------------------------------------------------------------------------------------//
+
+void LudumDare56::GameState::RacecarState::SimulateVehicle(void)
+{
+	if (true == mRacecarFinished || true == HasLost())
+	{	//Keeps 0.5% of the velocity every 10ms, scaled by the length of the step so every tick rate stops alike.
+		const float velocityKept = std::pow(0.005f, FixedTime() / 0.01f);
+		mPhysicsModel->SetLinearVelocity(mPhysicsModel->GetLinearVelocity() * velocityKept);
 	}
 
-	SimulateCreatureSwarm();
+	//Creatures may have finished since the swarm was last simulated, so catch the lists up before trusting them.
+	CompactCreatureLists();
+	const bool hasRacingCreatures = (mNumberOfRacingCreatures > 0);
 
-	for (size_t index = 0; index < theCrashSounds.size(); /* in loop */)
+	//This moves the vehicle body in the physical world which other racecars may be casting rays against, so it must
+	//  happen before any swarm gets simulated.
+	if (true == hasRacingCreatures)
 	{
-		if (true == theCrashSounds[index].IsComplete())
+		iceScalar fraction = 0.0;
+		iceVector3 intersectionPoint = iceVector3::Zero();
+		const iceVector3 rayOrigin = GetVehicleToWorld().GetPosition() + Vector3::Up() * 1.0f;
+
+		bool isOnGround = false;
+		if (false == RacetrackState::GetRacetrackHierarchy().IsEmpty())
 		{
-			theCrashSounds[index] = theCrashSounds.back();
-			theCrashSounds.pop_back();
+			isOnGround = RacetrackState::CastRayAgainstRacetrack(rayOrigin, Vector3::Down(), 1.1, intersectionPoint, fraction);
 		}
 		else
 		{
-			++index;
+			isOnGround = mPhysicalWorld->HackyAPI_CastRay(rayOrigin, Vector3::Down(), intersectionPoint, fraction) && fraction < 1.1;
+		}
+
+		if (true == isOnGround)
+		{
+			iceMatrix4 modifiedVehicleToWorld = GetVehicleToWorld();
+			const iceVector3 oldPosition = GetVehicleToWorld().GetPosition();
+
+			iceVector3 position = oldPosition;
+			position.y = intersectionPoint.y + 0.01f;
+			modifiedVehicleToWorld.SetPosition(position);
+			SetVehicleToWorld(modifiedVehicleToWorld);
 		}
 	}
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void LudumDare56::GameState::RacecarState::SimulateSwarm(void)
+{
+	SimulateCreatureSwarm();
+	UpdateSleep();
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void LudumDare56::GameState::RacecarState::WakeUp(void)
+{
+	mIsSleeping = false;
+	mIdleTimer = 0;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void LudumDare56::GameState::RacecarState::UpdateSleep(void)
+{
+	if (true == mIsSleeping)
+	{
+		return;
+	}
+
+	const bool isRacing = (false == mRacecarFinished && false == HasLost());
+	if (true == isRacing && false == mController->IsIdle())
+	{
+		mIdleTimer = 0;
+		return;
+	}
+
+	const iceVector3 linearVelocity = GetLinearVelocity();
+	if (linearVelocity.Magnitude() > kRestingVehicleSpeed || GetAngularVelocity().Magnitude() > kRestingVehicleSpeed)
+	{
+		mIdleTimer = 0;
+		return;
+	}
 
-	float percentage = tbMath::Clamp(mElapsedTime.GetPercentageOf(400), 0.0f, 1.0f);
-	if (true == HasWon() || true == HasLost())
+	//Checked last, and only once the racecar itself is at rest, since it visits every racing creature.
+	if (false == IsSwarmSettled())
 	{
-		percentage = 0.0f;
+		mIdleTimer = 0;
+		return;
 	}
 
-	for (tbAudio::AudioController& controller : theEngineControllers)
+	if (true == mIdleTimer.IncrementStep(kSleepAfterMS))
 	{
-		controller.SetVolume(percentage * 0.5f);
+		mIsSleeping = true;
+		mSleepingToWorld = GetVehicleToWorld();
+		mSwarmAudio.mEngineSpeeds.fill(-1.0f);
 	}
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
 
+bool LudumDare56::GameState::RacecarState::IsSwarmSettled(void) const
+{
+	const CreatureSwarm& swarm = mCreatureSwarm;
+	const iceScalar restingSpeedSquared = kRestingCreatureSpeed * kRestingCreatureSpeed;
+
+	for (const CreatureIndex::Integer racingIndex : GetRacingCreatures())
+	{
+		const iceScalar velocityX = swarm.mVelocityX[racingIndex];
+		const iceScalar velocityZ = swarm.mVelocityZ[racingIndex];
+		if (velocityX * velocityX + velocityZ * velocityZ > restingSpeedSquared)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
 void LudumDare56::GameState::RacecarState::RenderDebug(void) const
 {
 #if !defined(ludumdare56_headless_build)
@@ -531,6 +864,10 @@ icePhysics::Scalar kVelocityDrag = 0.89;
 icePhysics::Scalar kTargetRange = -3.5;
 icePhysics::Scalar kTargetSpeed = 0.5;
 
+//Replaces the visible and bubble distances when the creatures are near a stationary target.
+icePhysics::Scalar kNearTargetVisibleDistance = 1.0;
+icePhysics::Scalar kNearTargetBubbleDistance = 0.5;
+
 //When target is stationary / in range.
 //icePhysics::Scalar kCohesionDistance = 1.0f;   //more like a visible range.
 //icePhysics::Scalar kSeparationDistance = 0.5f; //more like a in my personal space.
@@ -544,16 +881,55 @@ icePhysics::Scalar kTargetSpeed = 0.5;
 //icePhysics::Scalar kVelocityDrag = 0.89;
 //};
 
-float calculatePitch(float speed, float maxPitch) {
-	const float minSpeed = 1.0;
-	const float maxSpeed = 35.0;
-	const float minPitch = 0.75;
+namespace
+{
+	///
+	/// @details The creature grid is rebuilt after the ground probes and before any creature moves, and the steering
+	///   only reads positions from the start of the step, so the cells only need to cover the largest neighbor range.
+	///
+	icePhysics::Scalar ComputeCreatureGridCellSize(void)
+	{
+		return std::max(std::max(kCohesionDistance, kSeparationDistance),
+			std::max(kNearTargetVisibleDistance, kNearTargetBubbleDistance));
+	}
+
+	LudumDare56::GameState::SwarmKernels::SwarmTuning BuildSwarmTuning(const iceVector3& targetPosition, const iceScalar targetSpeed)
+	{
+		LudumDare56::GameState::SwarmKernels::SwarmTuning tuning;
+		tuning.mTargetPosition = targetPosition;
+		tuning.mTargetSpeed = targetSpeed;
+		tuning.mFixedTime = LudumDare56::FixedTime();
+		tuning.mTargetRange = kTargetRange;
+		tuning.mTargetSpeedThreshold = kTargetSpeed;
+
+		tuning.mVisibleDistance = kCohesionDistance;
+		tuning.mBubbleDistance = kSeparationDistance;
+		tuning.mAvoidFactor = kAvoidFactor;
+		tuning.mMatchingFactor = kMatchingFactor;
+		tuning.mCenteringFactor = kCenteringFactor;
+		tuning.mTargetFactor = kTargetFactor;
+
+		//When target is stationary / in range.
+		tuning.mNearVisibleDistance = kNearTargetVisibleDistance;
+		tuning.mNearBubbleDistance = kNearTargetBubbleDistance;
+		tuning.mNearAvoidFactor = 2.0;
+		tuning.mNearMatchingFactor = 1.25;
+		tuning.mNearCenteringFactor = 0.913;
+		tuning.mNearTargetFactor = 0.25;
+
+		tuning.mVelocityDrag = kVelocityDrag;
+		tuning.mMaximumVelocity = kMaximumVelocity;
+		return tuning;
+	}
+};
 
-	// Calculate the slope using the maxPitch value
-	float slope = (maxPitch - minPitch) / (maxSpeed - minSpeed);
-	return slope * (speed - minSpeed) + minPitch;
+void LudumDare56::GameState::RacecarState::SetSwarmStageTiming(const bool isTimingStages)
+{
+	theIsTimingSwarmStages = isTimingStages;
 }
 
+//--------------------------------------------------------------------------------------------------------------------//
+
 void LudumDare56::GameState::RacecarState::SimulateCreatureSwarm(void)
 {
 	//if (true == HasLost())
@@ -569,17 +945,6 @@ void LudumDare56::GameState::RacecarState::SimulateCreatureSwarm(void)
 	//	}
 	//}
 
-#if defined(tb_debug_build)
-	//static int skipFrames = 5;
-	static int skipFrames = 1;
-#else
-	//1 disables, since all indices will be mod == 0. 2 = skip 1 frame, even/odds...
-	static int skipFrames = 1;
-#endif
-	static int dumdumFrameCounter = 0;
-	++dumdumFrameCounter;
-	dumdumFrameCounter = dumdumFrameCounter % skipFrames;
-
 	iceVector3 targetPosition = GetVehicleToWorld().GetPosition();
 	targetPosition.y = 0.0f;
 
@@ -591,136 +956,163 @@ void LudumDare56::GameState::RacecarState::SimulateCreatureSwarm(void)
 	iceVector3 swarmPosition = iceVector3::Zero();
 	mSwarmVelocity = iceVector3::Zero();
 
-	//bool first = true;
 	CreatureIndex creatureIndex = 0;
-	mSwarmHealth = 0;
 
-	std::array<std::pair<iceVector3, CreatureIndex>, 3> positionCountArray = {
-		std::pair<iceVector3, CreatureIndex>{ iceVector3::Zero(), 0 },
-		std::pair<iceVector3, CreatureIndex>{ iceVector3::Zero(), 0 },
-		std::pair<iceVector3, CreatureIndex>{ iceVector3::Zero(), 0 },
-	};
+	std::array<float, kNumberOfEngineChannels>& engineSpeeds = mSwarmAudio.mEngineSpeeds;
+	engineSpeeds.fill(-1.0f);
 
-	for (Creature& creature : mCreatures)
-	{
-		creature.mPreviousPosition = creature.mCreatureToWorld.GetPosition();
-		if (false == creature.mIsAlive)
-		{
-			++creatureIndex;
-			continue;
-		}
+	CreatureSwarm& swarm = mCreatureSwarm;
+	std::vector<tbCore::uint8>& moveMode = mSwarmScratch.mMoveMode;
 
-		if (false == creature.mIsRacing)
-		{
-			++mSwarmHealth;
-			++creatureIndex;
-			continue;
-		}
+	//The swarm is simulated in stages; ground probes, then steering and integration through the swarm kernels, then
+	//  gathering up the swarm averages, so steering sees every creature where it was at the start of the step. Only
+	//  the alive creatures the level of detail has due get probed and steered, the rest carry on with their velocity.
+	const std::chrono::steady_clock::time_point probeStartTime = GetSwarmStageTime();
+	CompactCreatureLists();
+	mGroundProbes.Reset(mNumberOfCreatures);
+	mSwarmLevelOfDetail.BeginTick(GetVehicleToWorld().GetPosition());
 
-		iceScalar fraction = 0.0;
-		iceVector3 intersectionPoint = iceVector3::Zero();
+	for (const CreatureIndex::Integer aliveIndex : GetAliveCreatures())
+	{
+		swarm.mPreviousX[aliveIndex] = swarm.mPositionX[aliveIndex];
+		swarm.mPreviousY[aliveIndex] = swarm.mPositionY[aliveIndex];
+		swarm.mPreviousZ[aliveIndex] = swarm.mPositionZ[aliveIndex];
+	}
 
-		//if (true == mPhysicalWorld->HackyAPI_CastRayToGlobalCollider(GetVehicleToWorld().GetPosition() +
-		if (true == mPhysicalWorld->HackyAPI_CastRay(GetVehicleToWorld().GetPosition() +
-			Vector3::Up() * 1.0f, Vector3::Down(), intersectionPoint, fraction) && fraction < 1.1)
-		{
-			iceMatrix4 modifiedVehicleToWorld = GetVehicleToWorld();
-			const iceVector3 oldPosition = GetVehicleToWorld().GetPosition();
+	for (const CreatureIndex::Integer racingIndex : GetRacingCreatures())
+	{
+		creatureIndex = racingIndex;
 
-			iceVector3 position = oldPosition;
-			position.y = intersectionPoint.y + 0.01f;
-			modifiedVehicleToWorld.SetPosition(position);
-			SetVehicleToWorld(modifiedVehicleToWorld);
-		}
+		const iceVector3 creaturePosition(swarm.mPositionX[creatureIndex], swarm.mPositionY[creatureIndex], swarm.mPositionZ[creatureIndex]);
+		const iceVector3 creatureVelocity(swarm.mVelocityX[creatureIndex], swarm.mVelocityY[creatureIndex], swarm.mVelocityZ[creatureIndex]);
 
 		// TODO: LudumDare56: 2024-10-05: We might want to go implement the Spline Collider to take in a specific collider
 		//   mesh instead of forcing visuals.
-		if (creatureIndex % skipFrames == dumdumFrameCounter)
+		const SwarmLevelOfDetail::Update update = mSwarmLevelOfDetail.ScheduleEntry(creatureIndex, creaturePosition, creatureVelocity);
+		if (SwarmLevelOfDetail::kSkipUpdate != update)
 		{
-			//if (true == mPhysicalWorld->HackyAPI_CastRayToGlobalCollider(creature.mCreatureToWorld.GetPosition() +
-			if (true == mPhysicalWorld->HackyAPI_CastRay(creature.mCreatureToWorld.GetPosition() +
-				Vector3::Up() * 2.0f, Vector3::Down(), intersectionPoint, fraction) && fraction < 2.10)
-			{
-				creature.mIsOnTrack = true;
-				//creature.mVelocity.y = 0.0;
+			mGroundProbes.AddProbe(creatureIndex, creaturePosition);
+		}
 
-				const iceVector3 oldPosition = creature.mCreatureToWorld.GetPosition();
-				iceVector3 position = creature.mCreatureToWorld.GetPosition();
-				position.y = intersectionPoint.y + 0.01f;
-				creature.mCreatureToWorld.SetPosition(position);
+		//Creatures that are not due for steering carry on with their velocity, the ground probes below may still stop
+		//  a creature that is off the track from steering.
+		moveMode[creatureIndex] = (SwarmLevelOfDetail::kFullUpdate == update) ? SwarmKernels::kMoveSteering : SwarmKernels::kMoveBallistic;
+	}
 
-				creature.mVelocity.y = position.y - oldPosition.y;
+	if (mNumberOfRacingCreatures > 0)
+	{	//Only reads from the racetrack or physical world, the vehicle was already placed on the ground by SimulateVehicle().
+		const TrackSurfaceTable& trackSurface = RacetrackState::GetTrackSurface();
+		const BoundingVolumeHierarchy& racetrackHierarchy = RacetrackState::GetRacetrackHierarchy();
+		if (false == trackSurface.IsEmpty())
+		{	//Answers most of the probes, those beyond the table or without surface in it are left to be cast below.
+			mGroundProbes.CastProbes(trackSurface);
+		}
+
+		if (mGroundProbes.GetNumberOfProbes() > 0)
+		{
+			if (false == racetrackHierarchy.IsEmpty())
+			{
+				mGroundProbes.CastProbes(racetrackHierarchy);
 			}
 			else
 			{
-			//	creature.mIsAlive = false; //To insta-kill when 'getting an offtrack' Don't do up here, we might be flying!
-				creature.mIsOnTrack = false;
+				mGroundProbes.CastProbes(*mPhysicalWorld);
+			}
+		}
+	}
+
+	for (const CreatureIndex::Integer racingIndex : GetRacingCreatures())
+	{
+		creatureIndex = racingIndex;
+
+		const GroundProbeBatch::ProbeResult probeResult = mGroundProbes.GetResult(creatureIndex);
+		if (GroundProbeBatch::kHitGround == probeResult)
+		{
+			swarm.SetFlag(creatureIndex, kCreatureIsOnTrack, true);
 
-				iceVector3 position = creature.mCreatureToWorld.GetPosition();
+			const iceScalar groundHeight = mGroundProbes.GetGroundHeight(creatureIndex) + 0.01f;
+			swarm.mVelocityY[creatureIndex] = groundHeight - swarm.mPositionY[creatureIndex];
+			swarm.mPositionY[creatureIndex] = groundHeight;
+		}
+		else if (GroundProbeBatch::kMissedGround == probeResult)
+		{
+		//	creature.mIsAlive = false; //To insta-kill when 'getting an offtrack' Don't do up here, we might be flying!
+			swarm.SetFlag(creatureIndex, kCreatureIsOnTrack, false);
 
-				iceVector3 at = iceVector3::Zero();
-				if (true == icePhysics::LineSegmentToPlaneCollision(position, position + iceVector3::Down() * 0.005, iceVector3::Zero(), iceVector3::Up(), at))
-				{
-					creature.Die(); //To insta-kill when 'getting an offtrack'
-				}
+			const iceVector3 creaturePosition(swarm.mPositionX[creatureIndex], swarm.mPositionY[creatureIndex], swarm.mPositionZ[creatureIndex]);
+			iceVector3 at = iceVector3::Zero();
+			if (true == icePhysics::LineSegmentToPlaneCollision(creaturePosition, creaturePosition + iceVector3::Down() * 0.005, iceVector3::Zero(), iceVector3::Up(), at))
+			{
+				KillCreature(creatureIndex); //To insta-kill when 'getting an offtrack'
 			}
 		}
 
-		const CreatureIndex engineChannel = creatureIndex % theEngineControllers.size();
-		if (positionCountArray[engineChannel].second < 1)
+		const CreatureIndex engineChannel = creatureIndex % kNumberOfEngineChannels;
+		if (engineSpeeds[engineChannel] < 0.0f)
 		{
-			positionCountArray[engineChannel].first += creature.mVelocity;
-			positionCountArray[engineChannel].second += 1;
+			const iceVector3 flatVelocity(swarm.mVelocityX[creatureIndex], 0.0, swarm.mVelocityZ[creatureIndex]);
+			engineSpeeds[engineChannel] = static_cast<float>(flatVelocity.Magnitude());
 		}
 
 
-		if (false == mIsOnTrack)
+		//Only a creature whose last probe missed the ground falls. One that was not probed this tick holds its height,
+		//  so only X and Z carry on until it is probed again.
+		if (false == swarm.HasFlag(creatureIndex, kCreatureIsOnTrack))
 		{
-			creature.mVelocity.y += -10.0f * kFixedTime;
-			if (creature.mCreatureToWorld.GetPosition().y <= -0.01f)
+			swarm.mVelocityY[creatureIndex] += -10.0f * FixedTime();
+			if (swarm.mPositionY[creatureIndex] <= -0.01f)
 			{
-				creature.Die();
-				++creatureIndex;
+				KillCreature(creatureIndex);
 				continue;
 			}
+
+			//A creature that just fell off the world above still gets its last move, it just doesn't steer.
+			moveMode[creatureIndex] = SwarmKernels::kMoveBallistic;
 		}
-		else if (creature.mVelocity.y < 0.0f)
+		else if (GroundProbeBatch::kNotProbed == probeResult || swarm.mVelocityY[creatureIndex] < 0.0f)
 		{
-			creature.mVelocity.y = 0.0;
+			swarm.mVelocityY[creatureIndex] = 0.0;
 		}
+	}
 
-		icePhysics::Scalar visibleDistance = kCohesionDistance;
-		icePhysics::Scalar bubbleDistance = kSeparationDistance;
+	const std::chrono::steady_clock::time_point steeringStartTime = GetSwarmStageTime();
 
-		if (creature.mCreatureToWorld.GetPosition().DistanceTo(targetPosition) < kTargetRange &&
-			targetSpeed < kTargetSpeed)
-		{
-			visibleDistance = 1.0;
-			bubbleDistance = 0.5;
-		}
+	//Drop the creatures that were killed above so neither the grid nor the kernels see them.
+	CompactCreatureLists();
 
-		const iceVector3 alignment = CalculateAlignment(creature, visibleDistance);
-		const iceVector3 cohesion = CalculateCohesion(creature, visibleDistance);
-		const iceVector3 separation = CalculateSeparation(creature, bubbleDistance);
-		const iceVector3 closeSeparation = CalculateSeparation(creature, bubbleDistance / 4.0f);
+	mCreatureGrid.Rebuild(ComputeCreatureGridCellSize(), mNumberOfCreatures, mAliveCreatures.data(), mNumberOfAliveCreatures,
+		[&swarm](const SpatialHashGrid::EntryIndex entryIndex, iceVector3& position) {
+			position = iceVector3(swarm.mPositionX[entryIndex], swarm.mPositionY[entryIndex], swarm.mPositionZ[entryIndex]);
+		});
 
-		creature.Move(targetPosition, targetSpeed, alignment, cohesion, separation, GetVehicleToWorld());
+	SwarmKernels::SwarmData swarmData = GetSwarmData();
+	const SwarmKernels::SwarmTuning swarmTuning = BuildSwarmTuning(targetPosition, targetSpeed);
+	SwarmKernels::ComputeSteering(swarmData, mCreatureGrid, swarmTuning, mSwarmScratch);
 
-		//if (first)
-		//{
-		//	first = false;
-		//	tb_debug_log(LogState::Info() << "   alignment: " << alignment);
-		//	tb_debug_log(LogState::Info() << "   cohesion: " << cohesion);
-		//	tb_debug_log(LogState::Info() << "   separation: " << separation);
-		//}
+	const std::chrono::steady_clock::time_point integrationStartTime = GetSwarmStageTime();
+	SwarmKernels::IntegrateSwarm(swarmData, swarmTuning, mSwarmScratch);
+
+	//Alive creatures that already finished the race still count towards the health of the swarm.
+	mSwarmHealth = mNumberOfAliveCreatures - mNumberOfRacingCreatures;
+	mSwarmSweptBounds = EmptySweptBounds();
+
+	for (const CreatureIndex::Integer racingIndex : GetRacingCreatures())
+	{
+		creatureIndex = racingIndex;
+		GrowSweptBounds(mSwarmSweptBounds, swarm.mPreviousX[creatureIndex], swarm.mPreviousY[creatureIndex], swarm.mPreviousZ[creatureIndex]);
+		GrowSweptBounds(mSwarmSweptBounds, swarm.mPositionX[creatureIndex], swarm.mPositionY[creatureIndex], swarm.mPositionZ[creatureIndex]);
+
+		if (SwarmKernels::kDoNotMove == moveMode[creatureIndex])
+		{
+			continue;
+		}
 
-		swarmPosition += creature.mCreatureToWorld.GetPosition();
-		mSwarmVelocity += creature.mVelocity;
+		swarmPosition += iceVector3(swarm.mPositionX[creatureIndex], swarm.mPositionY[creatureIndex], swarm.mPositionZ[creatureIndex]);
+		mSwarmVelocity += iceVector3(swarm.mVelocityX[creatureIndex], swarm.mVelocityY[creatureIndex], swarm.mVelocityZ[creatureIndex]);
 		mSwarmVelocity.y = 0.0f;
 
 		++mSwarmHealth;
 		++creatureCount;
-		++creatureIndex;
 	}
 
 	if (creatureCount == 0)
@@ -746,202 +1138,238 @@ void LudumDare56::GameState::RacecarState::SimulateCreatureSwarm(void)
 		mSwarmToWorld.SetBasis(1, Vector3::Up());
 		mSwarmToWorld.SetBasis(2, -direction);
 
+	}
 
-		//Do engine audio
-		size_t engineChannel = 0;
-		for (tbAudio::AudioController& controller : theEngineControllers)
-		{
-			iceVector3& average = positionCountArray[engineChannel].first;
-			const CreatureIndex& count = positionCountArray[engineChannel].second;
-
-			if (0 == count)
-			{
-				if (false == controller.IsComplete())
-				{
-					controller.Stop();
-				}
-			}
-			else
-			{
-				average /= count;
-				average.y = 0.0f;
-				const float speed = static_cast<float>(average.Magnitude());
-
-				tb_debug_log("channel: " << engineChannel << "   speed: " << speed << "  count: " << +count);
-
-
-				//1 = 0.75
-				//35 = 3.75
-
-
-				//Fluffy made that math happen
-				controller.Play();
-				//controller.SetPitch(tbMath::Clamp(0.0882f * speed + 0.6618f, 0.75f, 4.0f));
-				controller.SetPitch(calculatePitch(speed, 1.5));
-			}
-
-			++engineChannel;
-		}
+	const std::chrono::steady_clock::time_point finishTime = GetSwarmStageTime();
+	if (true == theIsTimingSwarmStages)
+	{
+		mSwarmStageTimes.mGroundProbes = static_cast<tbCore::uint64>(std::chrono::duration_cast<std::chrono::nanoseconds>(steeringStartTime - probeStartTime).count());
+		mSwarmStageTimes.mSteering = static_cast<tbCore::uint64>(std::chrono::duration_cast<std::chrono::nanoseconds>(integrationStartTime - steeringStartTime).count());
+		mSwarmStageTimes.mIntegration = static_cast<tbCore::uint64>(std::chrono::duration_cast<std::chrono::nanoseconds>(finishTime - integrationStartTime).count());
 	}
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
 
-void LudumDare56::GameState::RacecarState::Creature::Move(const iceVector3& targetPosition, const iceScalar targetSpeed,
-	const iceVector3& alignment, const iceVector3& cohesion, const iceVector3& separation, const iceMatrix4& vehicleToWorld)
+void LudumDare56::GameState::RacecarState::KillCreature(const CreatureIndex creatureIndex)
 {
-	iceVector3 position = mCreatureToWorld.GetPosition();
-
-	iceScalar distanceToTarget = 0.0;
-	const iceVector3 directionToTarget = iceVector3::Normalize(targetPosition - position, distanceToTarget);
-	//const iceVector3 directionToTarget = (targetPosition - position);
+	mCreatureSwarm.SetFlag(creatureIndex, kCreatureIsAlive, false);
+	mCreatureListsChanged = true;
+	++mSwarmAudio.mNumberOfCrashes;
+}
 
-	icePhysics::Scalar avoidFactor = kAvoidFactor;
-	icePhysics::Scalar centerFactor = kCenteringFactor;
-	icePhysics::Scalar matchFactor = kMatchingFactor;
-	icePhysics::Scalar targetFactor = kTargetFactor;
+//--------------------------------------------------------------------------------------------------------------------//
 
-	if (distanceToTarget < kTargetRange && targetSpeed < kTargetSpeed)
+void LudumDare56::GameState::RacecarState::CompactCreatureLists(void)
+{
+	if (false == mCreatureListsChanged)
 	{
-		avoidFactor = 2.0f;    //separation
-		matchFactor = 1.25f; //alignment
-		centerFactor = 0.913f; //cohesion
-		targetFactor = 0.25;
-
-		//icePhysics::Scalar kMaximumVelocity = 80.0;
-		//icePhysics::Scalar kVelocityDrag = 0.89;
+		return;
 	}
 
-	iceScalar speed = 0.0;
-	if (true == mIsOnTrack)
-	{
-		mVelocity -= mVelocity * kVelocityDrag * kFixedTime;
+	CreatureSwarm& swarm = mCreatureSwarm;
 
-		// Ignore any Y from swarm behavior.
-		iceVector3 flatVelocity = mVelocity;
-		flatVelocity += ((cohesion * centerFactor) + (separation * avoidFactor) + (alignment * matchFactor) +
-			directionToTarget * targetFactor) * kFixedTime;
-		flatVelocity.y = 0.0;
-
-		speed = flatVelocity.Magnitude();
-		if (speed > kMaximumVelocity)
+	CreatureIndex::Integer keptCount = 0;
+	for (CreatureIndex::Integer listIndex = 0; listIndex < mNumberOfAliveCreatures; ++listIndex)
+	{
+		const CreatureIndex::Integer creatureIndex = mAliveCreatures[listIndex];
+		if (true == swarm.HasFlag(creatureIndex, kCreatureIsAlive))
 		{
-			flatVelocity = flatVelocity.GetNormalized() * kMaximumVelocity;
+			mAliveCreatures[keptCount++] = creatureIndex;
 		}
+		else
+		{	//Dead creatures are no longer simulated, so settle their previous position for the interpolation.
+			swarm.mPreviousX[creatureIndex] = swarm.mPositionX[creatureIndex];
+			swarm.mPreviousY[creatureIndex] = swarm.mPositionY[creatureIndex];
+			swarm.mPreviousZ[creatureIndex] = swarm.mPositionZ[creatureIndex];
+		}
+	}
+	mNumberOfAliveCreatures = keptCount;
 
-		mVelocity.x = flatVelocity.x;
-		mVelocity.z = flatVelocity.z;
+	keptCount = 0;
+	for (CreatureIndex::Integer listIndex = 0; listIndex < mNumberOfRacingCreatures; ++listIndex)
+	{
+		const CreatureIndex::Integer creatureIndex = mRacingCreatures[listIndex];
+		if (true == swarm.HasFlag(creatureIndex, kCreatureIsAlive) && true == swarm.HasFlag(creatureIndex, kCreatureIsRacing))
+		{
+			mRacingCreatures[keptCount++] = creatureIndex;
+		}
 	}
+	mNumberOfRacingCreatures = keptCount;
 
-	position += mVelocity * kFixedTime;
+	mCreatureListsChanged = false;
+}
 
-	mCreatureToWorld.SetPosition(position);
+//--------------------------------------------------------------------------------------------------------------------//
 
-	const iceVector3 direction = (speed > 0.4) ? mVelocity.GetNormalized() : -vehicleToWorld.GetBasis(2);
-	const iceVector3 right = Vector3::Cross(direction, Vector3::Up());
-	mCreatureToWorld.SetBasis(0, right);
-	mCreatureToWorld.SetBasis(1, Vector3::Up());
-	mCreatureToWorld.SetBasis(2, -direction);
+LudumDare56::GameState::SwarmKernels::SwarmData LudumDare56::GameState::RacecarState::GetSwarmData(void)
+{
+	return { mCreatureSwarm.mPositionX.data(), mCreatureSwarm.mPositionY.data(), mCreatureSwarm.mPositionZ.data(),
+		mCreatureSwarm.mVelocityX.data(), mCreatureSwarm.mVelocityY.data(), mCreatureSwarm.mVelocityZ.data(), mNumberOfCreatures,
+		mRacingCreatures.data(), mNumberOfRacingCreatures };
 }
 
+//--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
 //--------------------------------------------------------------------------------------------------------------------//
 
-void LudumDare56::GameState::RacecarState::Creature::Die(void)
+void LudumDare56::GameState::RacecarState::MutableCreature::SetPosition(const iceVector3& position)
 {
-	mIsAlive = false;
-
-	if (theCrashSounds.size() < 5)
-	{
-		theCrashSounds.push_back(tbAudio::theAudioManager.PlayEvent("audio_events", "crash"));
-	}
+	CreatureSwarm& swarm = mRacecar.mCreatureSwarm;
+	swarm.mPositionX[mCreatureIndex] = position.x;
+	swarm.mPositionY[mCreatureIndex] = position.y;
+	swarm.mPositionZ[mCreatureIndex] = position.z;
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
 
-icePhysics::Vector3 LudumDare56::GameState::RacecarState::CalculateCohesion(const Creature& creature, const iceScalar visibleDistance) const
+void LudumDare56::GameState::RacecarState::MutableCreature::SetVelocity(const iceVector3& velocity)
 {
-	int count = 0;
-	iceVector3 averagePosition = iceVector3::Zero();
+	CreatureSwarm& swarm = mRacecar.mCreatureSwarm;
+	swarm.mVelocityX[mCreatureIndex] = velocity.x;
+	swarm.mVelocityY[mCreatureIndex] = velocity.y;
+	swarm.mVelocityZ[mCreatureIndex] = velocity.z;
+}
 
-	for (const Creature& otherCreature : mCreatures)
-	{
-		if (&otherCreature == &creature || false == otherCreature.mIsAlive)
-		{	//Don't look at ourself or unalived creatures!
-			continue;
-		}
+//--------------------------------------------------------------------------------------------------------------------//
 
-		const iceScalar distance = creature.mCreatureToWorld.GetPosition().DistanceTo(otherCreature.mCreatureToWorld.GetPosition());
-		if (distance < visibleDistance)
-		{
-			averagePosition += otherCreature.mCreatureToWorld.GetPosition();
-			++count;
-		}
-	}
+void LudumDare56::GameState::RacecarState::MutableCreature::SetOnTrack(const bool isOnTrack)
+{
+	mRacecar.mCreatureSwarm.SetFlag(mCreatureIndex, kCreatureIsOnTrack, isOnTrack);
+}
 
-	if (count > 0)
-	{
-		averagePosition = averagePosition / count;
-		return averagePosition - creature.mCreatureToWorld.GetPosition();
-	}
+//--------------------------------------------------------------------------------------------------------------------//
 
-	return iceVector3::Zero();
+void LudumDare56::GameState::RacecarState::MutableCreature::Die(void)
+{
+	mRacecar.KillCreature(mCreatureIndex);
 }
 
+//--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
 //--------------------------------------------------------------------------------------------------------------------//
 
-icePhysics::Vector3 LudumDare56::GameState::RacecarState::CalculateSeparation(const Creature& creature, const iceScalar separationDistance) const
+class RacecarSwarmTest : tbCore::UnitTest::TestCaseInterface
 {
-	iceVector3 separation = iceVector3::Zero();
-	for (const Creature& otherCreature : mCreatures)
+public:
+	RacecarSwarmTest(void) :
+		tbCore::UnitTest::TestCaseInterface("RacecarSwarmTest")
 	{
-		if (&otherCreature == &creature || false == otherCreature.mIsAlive)
-		{	//Don't look at ourself or unalived creatures!
-			continue;
+	}
+
+	~RacecarSwarmTest(void)
+	{
+	}
+
+protected:
+	virtual bool OnRunTest(void) override
+	{
+		using namespace LudumDare56::GameState;
+
+		//Spread out past the quarter rate distance of the SwarmLevelOfDetail so every tier holds some of the swarm.
+		const RacecarState::CreatureIndex::Integer kNumberOfTestCreatures = 240;
+		const iceScalar kNearestCreature = 2.0;
+		const iceScalar kFarthestCreature = 60.0;
+		const tbCore::uint32 kNumberOfTicks = LudumDare56::GetTickRate() * 5;
+
+		Implementation::FlatTestWorld testWorld;
+		RacecarState& racecar = testWorld.CreateRacecar(kNumberOfTestCreatures);
+
+		for (RacecarState::CreatureIndex creatureIndex = 0; creatureIndex < kNumberOfTestCreatures; ++creatureIndex)
+		{	//Resting on the ground, every other creature drifts sideways so the unsettled ones fill the half rate tier.
+			const iceScalar fraction = static_cast<iceScalar>(static_cast<RacecarState::CreatureIndex::Integer>(creatureIndex)) /
+				static_cast<iceScalar>(kNumberOfTestCreatures);
+			const iceScalar drift = (0 == creatureIndex % 2) ? 0.0 : 1.0;
+
+			RacecarState::MutableCreature creature = racecar.GetMutableCreature(creatureIndex);
+			creature.SetPosition(iceVector3(kNearestCreature + (kFarthestCreature - kNearestCreature) * fraction, 0.01, 0.0));
+			creature.SetVelocity(iceVector3(0.0, 0.0, drift));
+		}
+
+		std::array<bool, SwarmLevelOfDetail::kNumberOfTiers> isTierUsed;
+		isTierUsed.fill(false);
+
+		for (tbCore::uint32 tick = 0; tick < kNumberOfTicks; ++tick)
+		{
+			racecar.SimulateSwarm();
+
+			const SwarmLevelOfDetail& levelOfDetail = racecar.GetSwarmLevelOfDetail();
+			for (int tier = 0; tier < SwarmLevelOfDetail::kNumberOfTiers; ++tier)
+			{
+				isTierUsed[tier] = (true == isTierUsed[tier] || levelOfDetail.GetTierCount(static_cast<SwarmLevelOfDetail::Tier>(tier)) > 0);
+			}
 		}
 
-		iceScalar distance = 0.0;
-		iceVector3 separationDirection = iceVector3::Normalize(creature.mCreatureToWorld.GetPosition() - otherCreature.mCreatureToWorld.GetPosition(), distance);
-		if (distance < separationDistance)
+		for (int tier = 0; tier < SwarmLevelOfDetail::kNumberOfTiers; ++tier)
 		{
-			// The source article said this; but we actually need to invert it so that we separate more strongly from
-			//   the creatures that are closer than the creatures that are near the separation 'border'.
-			//	separation += creature.mCreatureToWorld.GetPosition() - otherCreature.mCreatureToWorld.GetPosition();
-			separation += separationDirection * (separationDistance - distance);
+			ExpectedValue(isTierUsed[tier], true, "Expected some of the swarm to be scheduled on tier %d.", tier);
 		}
+
+		//The creatures skipped by the level of detail must hold their height between ground probes, not fall through.
+		ExpectedValue(racecar.GetAliveCreatures().size() == kNumberOfTestCreatures, true,
+			"Expected every creature resting on flat ground to stay alive on every tier.");
+		ExpectedValue(racecar.GetSwarmHealth() == kNumberOfTestCreatures, true, "Expected the swarm to keep its full health.");
+		return true;
 	}
+};
 
-	return separation;
-}
+RacecarSwarmTest theRacecarSwarmTest;
 
 //--------------------------------------------------------------------------------------------------------------------//
 
-icePhysics::Vector3 LudumDare56::GameState::RacecarState::CalculateAlignment(const Creature& creature, const iceScalar visibleDistance) const
+class RacecarSleepTest : tbCore::UnitTest::TestCaseInterface
 {
-	int count = 0;
-	iceVector3 averageVelocity;
+public:
+	RacecarSleepTest(void) :
+		tbCore::UnitTest::TestCaseInterface("RacecarSleepTest")
+	{
+	}
 
-	for (const Creature& otherCreature : mCreatures)
+	~RacecarSleepTest(void)
 	{
-		if (&otherCreature == &creature || false == otherCreature.mIsAlive)
-		{	//Don't look at ourself or unalived creatures!
-			continue;
+	}
+
+protected:
+	virtual bool OnRunTest(void) override
+	{
+		using namespace LudumDare56::GameState;
+
+		const tbCore::uint32 kNumberOfTicks = LudumDare56::GetTickRate();
+		const iceVector3 kMovedPosition(5.0, 0.75, 3.0);
+
+		Implementation::FlatTestWorld testWorld;
+		RacecarState& racecar = testWorld.CreateRacecar(kDefaultCreaturesPerRacecar);
+
+		{	//Rather than waiting kSleepAfterMS for the swarm to settle, put the racecar to sleep right where it is.
+			std::unique_ptr<RacecarState::Snapshot> snapshot(new RacecarState::Snapshot());
+			racecar.SaveSnapshot(*snapshot);
+			snapshot->mIsSleeping = true;
+			snapshot->mSleepingToWorld = racecar.GetVehicleToWorld();
+			racecar.RestoreSnapshot(*snapshot);
 		}
 
-		const iceScalar distance = creature.mCreatureToWorld.GetPosition().DistanceTo(otherCreature.mCreatureToWorld.GetPosition());
-		if (distance < visibleDistance)	//used as 'visual range' in https://vanhunteradams.com/Pico/Animal_Movement/Boids-algorithm.html
+		//Just as HandleUpdatePacket() moves a racecar that the GameServer says is still at rest.
+		racecar.SetVehicleToWorld(iceMatrix4::Translation(kMovedPosition));
+		racecar.SetLinearVelocity(iceVector3::Zero());
+		racecar.SetAngularVelocity(iceVector3::Zero());
+
+		PhysicsModels::PhysicsModelBatch vehiclePhysics;
+		for (tbCore::uint32 tick = 0; tick < kNumberOfTicks; ++tick)
 		{
-			averageVelocity += otherCreature.mVelocity;
-			++count;
+			vehiclePhysics.Reset();
+			racecar.SimulateControls(vehiclePhysics);
+			testWorld.GetPhysicalWorld().Simulate(LudumDare56::FixedTime());
 		}
-	}
 
-	if (count > 0)
-	{
-		averageVelocity = averageVelocity / count;
-		return averageVelocity - creature.mVelocity;
-	}
+		vehiclePhysics.Reset();
+		racecar.SimulateControls(vehiclePhysics);
 
-	return iceVector3::Zero();
-}
+		ExpectedValue(racecar.IsSleeping(), true, "Expected the racecar to still be asleep after being moved at rest.");
+		ExpectedValue(vehiclePhysics.GetNumberOfVehicles() == 0, true, "Expected a sleeping racecar to skip the physics.");
+		ExpectedValue((racecar.GetVehicleToWorld().GetPosition() - kMovedPosition).Magnitude() < 0.001, true,
+			"Expected the sleeping racecar to stay where it was moved, not snap back to where it fell asleep.");
+		return true;
+	}
+};
 
-//--------------------------------------------------------------------------------------------------------------------//
+RacecarSleepTest theRacecarSleepTest;
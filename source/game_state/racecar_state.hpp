@@ -9,6 +9,10 @@
 #define LudumDare56_RacecarManager_hpp
 
 #include "../game_state/physics/physics_model_interface.hpp"
+#include "../game_state/helpers/ground_probe_batch.hpp"
+#include "../game_state/helpers/spatial_hash_grid.hpp"
+#include "../game_state/helpers/swarm_level_of_detail.hpp"
+#include "../game_state/helpers/swarm_kernels.hpp"
 #include "../game_state/racecar_controller_interface.hpp"
 #include "../game_state/race_session_state.hpp" //for RacecarIndex etc.
 
@@ -23,6 +27,9 @@
 #include <ice/physics/ice_physical_vehicle.hpp>
 
 #include <array>
+#include <span>
+#include <utility>
+#include <vector>
 
 class RacecarControllerInterface;
 
@@ -31,51 +38,125 @@ namespace LudumDare56::GameState
 	namespace PhysicsModels
 	{
 		class PhysicsModelInterface;
+		class PhysicsModelBatch;
 	};
 
 	class RacecarState : public TyreBytes::Core::EventBroadcaster
 	{
 	public:
-		enum class CreatureIndexType : tbCore::uint8 { };
+		enum class CreatureIndexType : tbCore::uint16 { };
 		typedef tbCore::TypedInteger<CreatureIndexType> CreatureIndex;
 
-		static constexpr CreatureIndex::Integer kNumberOfCreatures = 200;
-		static constexpr CreatureIndex::Integer kMinimumCreatures = 0;
+		///
+		/// @details The creature storage of every racecar is a pool that holds kMaximumCreatures, the swarm size of a
+		///   session is chosen at RaceSessionState::Create() and only uses the front of that pool.
+		///
+		static constexpr CreatureIndex::Integer kMaximumCreatures = kMaximumCreaturesPerRacecar;
+
+		///
+		/// @details The racecar has lost once the swarm health drops to this fraction of the swarm size or below.
+		///
+		static constexpr float kMinimumCreaturesFraction = 0.0f;
+
+		///
+		/// @details The engine sound is made of a few channels that each follow the speed of one creature.
+		///
+		static constexpr size_t kNumberOfEngineChannels = 3;
+
+		///
+		/// @details How long, in milliseconds, a racecar must sit idle before it falls asleep, see IsSleeping().
+		///
+		static constexpr tbCore::uint32 kSleepAfterMS = 2000;
 
 		constexpr CreatureIndex InvalidCreature(void) { return CreatureIndex::Integer(~0); }
-		constexpr bool IsValidCreature(const CreatureIndex creatureIndex) { return creatureIndex < kNumberOfCreatures; }
+		inline bool IsValidCreature(const CreatureIndex creatureIndex) const { return creatureIndex < mNumberOfCreatures; }
+
+		enum CreatureFlags : tbCore::uint8
+		{
+			kCreatureIsAlive = 0x01,
+			kCreatureIsOnTrack = 0x02,
+			kCreatureIsRacing = 0x04,
+		};
+
+		///
+		/// @details The swarm is stored as parallel arrays so the neighbor and integration loops only stream through the
+		///   data they actually need. The orientation of a creature is not stored at all, see GetCreatureToWorld().
+		///
+		/// @note The arrays are sized to kMaximumCreatures so changing the swarm size never reallocates them.
+		///
+		struct CreatureSwarm
+		{
+			alignas(32) std::array<iceScalar, kMaximumCreatures> mPositionX;
+			alignas(32) std::array<iceScalar, kMaximumCreatures> mPositionY;
+			alignas(32) std::array<iceScalar, kMaximumCreatures> mPositionZ;
+			alignas(32) std::array<iceScalar, kMaximumCreatures> mVelocityX;
+			alignas(32) std::array<iceScalar, kMaximumCreatures> mVelocityY;
+			alignas(32) std::array<iceScalar, kMaximumCreatures> mVelocityZ;
+			alignas(32) std::array<iceScalar, kMaximumCreatures> mPreviousX;
+			alignas(32) std::array<iceScalar, kMaximumCreatures> mPreviousY;
+			alignas(32) std::array<iceScalar, kMaximumCreatures> mPreviousZ;
+			std::array<tbCore::uint8, kMaximumCreatures> mFlags;
+
+			inline bool HasFlag(const CreatureIndex creatureIndex, const CreatureFlags flag) const { return 0 != (mFlags[creatureIndex] & flag); }
+			inline void SetFlag(const CreatureIndex creatureIndex, const CreatureFlags flag, const bool value)
+			{
+				mFlags[creatureIndex] = static_cast<tbCore::uint8>((true == value) ?
+					(mFlags[creatureIndex] | flag) : (mFlags[creatureIndex] & ~flag));
+			}
+		};
 
+		///
+		/// @details A lightweight, read-only view of a single creature within the swarm.
+		///
 		class Creature
 		{
 		public:
-			iceMatrix4 mCreatureToWorld;
-			iceVector3 mPreviousPosition;
-			iceVector3 mVelocity;
-			bool mIsAlive;
-			bool mIsOnTrack;
-			bool mIsRacing;
-
-			explicit Creature(const iceMatrix4& creatureToWorld = iceMatrix4::Identity()) :
-				mCreatureToWorld(creatureToWorld),
-				mPreviousPosition(iceVector3::Zero()),
-				mVelocity(iceVector3::Zero()),
-				mIsAlive(true),
-				mIsOnTrack(true),
-				mIsRacing(true)
+			Creature(const CreatureSwarm& swarm, const CreatureIndex creatureIndex) :
+				mSwarm(swarm),
+				mCreatureIndex(creatureIndex)
 			{
 			}
 
-			void Move(const iceVector3& targetPosition, const iceScalar targetSpeed, const iceVector3& alignment,
-				const iceVector3& cohesion, const iceVector3& separation, const iceMatrix4& vehicleToWorld);
+			inline CreatureIndex GetCreatureIndex(void) const { return mCreatureIndex; }
+			inline iceVector3 GetPosition(void) const { return iceVector3(mSwarm.mPositionX[mCreatureIndex], mSwarm.mPositionY[mCreatureIndex], mSwarm.mPositionZ[mCreatureIndex]); }
+			inline iceVector3 GetPreviousPosition(void) const { return iceVector3(mSwarm.mPreviousX[mCreatureIndex], mSwarm.mPreviousY[mCreatureIndex], mSwarm.mPreviousZ[mCreatureIndex]); }
+			inline iceVector3 GetVelocity(void) const { return iceVector3(mSwarm.mVelocityX[mCreatureIndex], mSwarm.mVelocityY[mCreatureIndex], mSwarm.mVelocityZ[mCreatureIndex]); }
 
+			inline bool IsAlive(void) const { return mSwarm.HasFlag(mCreatureIndex, kCreatureIsAlive); }
+			inline bool IsOnTrack(void) const { return mSwarm.HasFlag(mCreatureIndex, kCreatureIsOnTrack); }
+			inline bool IsRacing(void) const { return mSwarm.HasFlag(mCreatureIndex, kCreatureIsRacing); }
+
+		protected:
+			const CreatureSwarm& mSwarm;
+			const CreatureIndex mCreatureIndex;
+		};
+
+		///
+		/// @details A lightweight view of a single creature within the swarm that can also modify it.
+		///
+		class MutableCreature : public Creature
+		{
+		public:
+			MutableCreature(RacecarState& racecar, const CreatureIndex creatureIndex) :
+				Creature(racecar.mCreatureSwarm, creatureIndex),
+				mRacecar(racecar)
+			{
+			}
+
+			void SetPosition(const iceVector3& position);
+			void SetVelocity(const iceVector3& velocity);
+			void SetOnTrack(const bool isOnTrack);
 			void Die(void);
+
+		private:
+			RacecarState& mRacecar;
 		};
 
 		static const RacecarState& Get(const RacecarIndex racecarIndex);
 		static RacecarState& GetMutable(const RacecarIndex racecarIndex);
 
-		const Creature& GetCreature(const CreatureIndex creatureIndex) { return mCreatures[creatureIndex]; }
-		Creature& GetMutableCreature(const CreatureIndex creatureIndex) { return mCreatures[creatureIndex]; }
+		Creature GetCreature(const CreatureIndex creatureIndex) const { return Creature(mCreatureSwarm, creatureIndex); }
+		MutableCreature GetMutableCreature(const CreatureIndex creatureIndex) { return MutableCreature(*this, creatureIndex); }
 
 		///
 		/// @note This is purely for some syntactical sugars of using ranged for-loops;
@@ -91,22 +172,77 @@ namespace LudumDare56::GameState
 		RacecarState(void);
 		virtual ~RacecarState(void);
 
-		void Create(icePhysics::World& physicalWorld);
+		///
+		/// @details Creates the racecar in the physical world with a swarm of numberOfCreatures, which must be between 1
+		///   and kMaximumCreatures.
+		///
+		void Create(icePhysics::World& physicalWorld, const CreatureIndex::Integer numberOfCreatures);
 		void Destroy(icePhysics::World& physicalWorld);
 
 		void ResetRacecar(const iceMatrix4& vehicleToWorld);
 
-		const tbGame::GameTimer::Milliseconds& GetElapsedTime(void) const { return mElapsedTime.GetElapsedTime(); }
+		tbGame::GameTimer::Milliseconds GetElapsedTime(void) const { return StepsToMilliseconds(mElapsedSteps); }
 		bool HasWon(void) const { return mRacecarFinished; }
-		bool HasLost(void) const { return mSwarmHealth <= kMinimumCreatures; }
+		bool HasLost(void) const { return mSwarmHealth <= GetMinimumCreatures(); }
 		CreatureIndex GetSwarmHealth(void) const { return mSwarmHealth; }
-		bool IsCreatureAlive(const CreatureIndex& creatureIndex) const { return mCreatures[creatureIndex].mIsAlive; }
+		CreatureIndex::Integer GetNumberOfCreatures(void) const { return mNumberOfCreatures; }
+		CreatureIndex::Integer GetMinimumCreatures(void) const;
+		bool IsCreatureAlive(const CreatureIndex& creatureIndex) const { return mCreatureSwarm.HasFlag(creatureIndex, kCreatureIsAlive); }
+
+		///
+		/// @details The creatures that are alive, or alive and still racing, in increasing order so loops only need to
+		///   visit the survivors. KillCreature() and OnCreatureFinished() mark the lists and the creatures are removed when the
+		///   swarm is next simulated, so a creature that left the race this tick can still be listed.
+		///
+		std::span<const CreatureIndex::Integer> GetAliveCreatures(void) const { return { mAliveCreatures.data(), mNumberOfAliveCreatures }; }
+		std::span<const CreatureIndex::Integer> GetRacingCreatures(void) const { return { mRacingCreatures.data(), mNumberOfRacingCreatures }; }
+
+		///
+		/// @details Contains the level of detail counters for the swarm from the last simulated tick, how many creatures
+		///   were in each tier and how many of those got the full update.
+		///
+		const SwarmLevelOfDetail& GetSwarmLevelOfDetail(void) const { return mSwarmLevelOfDetail; }
+
+		///
+		/// @details The wall-clock time, in nanoseconds, each stage of the last SimulateSwarm() took; probing the
+		///   ground, steering (including the neighbor grid) and integrating (including the swarm averages). These are
+		///   only measured, for every racecar, after SetSwarmStageTiming(true) and otherwise remain zero.
+		///
+		struct SwarmStageTimes
+		{
+			tbCore::uint64 mGroundProbes;
+			tbCore::uint64 mSteering;
+			tbCore::uint64 mIntegration;
+		};
+
+		const SwarmStageTimes& GetSwarmStageTimes(void) const { return mSwarmStageTimes; }
+		static void SetSwarmStageTiming(const bool isTimingStages);
+
+		///
+		/// @details Everything the swarm has to say about its sound, gathered while simulating so the simulation itself
+		///   never touches the audio. The counters only ever go up, an observer plays whatever happened since it last
+		///   looked, see GameClient::SwarmAudioObserver.
+		///
+		struct SwarmAudio
+		{
+			std::array<float, kNumberOfEngineChannels> mEngineSpeeds;  //Flat speed of the creature each channel follows, negative when silent.
+			tbCore::uint32 mNumberOfCrashes;
+			tbCore::uint32 mNumberOfResets;
+			tbCore::uint32 mResetWorldTimer;  //The world timer when last reset, picks between the countdown and start cues.
+		};
+
+		const SwarmAudio& GetSwarmAudio(void) const { return mSwarmAudio; }
 
 		void OnRacecarFinished(void);
 		void OnCreatureFinished(const CreatureIndex& creatureIndex);
 
 		iceMatrix4 GetBodyToWorld(void) const;
 		iceMatrix4 GetWheelToWorld(const size_t wheelIndex) const;
+
+		///
+		/// @details Builds the creature to world transform, facing the direction the creature is moving or the direction
+		///   of the racecar when the creature is nearly stopped or not on the track.
+		///
 		iceMatrix4 GetCreatureToWorld(const CreatureIndex& creatureIndex) const;
 
 		///
@@ -115,6 +251,74 @@ namespace LudumDare56::GameState
 		iceMatrix4 GetSwarmToWorld(void) const;
 		iceVector3 GetSwarmVelocity(void) const;
 
+		///
+		/// @details An axis aligned box holding both the previous and current position of every racing creature, which
+		///   is every segment a creature moved along during the last step. When no creature is racing the minimum is
+		///   greater than the maximum so the box overlaps nothing.
+		///
+		struct SweptBounds
+		{
+			iceVector3 mMinimum;
+			iceVector3 mMaximum;
+		};
+
+		const SweptBounds& GetSwarmSweptBounds(void) const { return mSwarmSweptBounds; }
+
+		///
+		/// @details Everything about the racecar that changes while simulating, for the snapshots of the
+		///   RaceSessionState. Only the creatures of the swarm in use, and the alive and racing lists as long as they
+		///   are, get stored, so a snapshot is about as large as the swarm. A snapshot only allocates when it is saved
+		///   with more creatures than it has held before.
+		///
+		struct Snapshot
+		{
+			std::vector<iceScalar> mCreatureValues;                //Each column of the CreatureSwarm, mNumberOfCreatures long.
+			std::vector<tbCore::uint8> mCreatureFlags;
+			std::vector<CreatureIndex::Integer> mAliveCreatures;
+			std::vector<CreatureIndex::Integer> mRacingCreatures;
+			SwarmLevelOfDetail mSwarmLevelOfDetail;
+			PhysicsModels::PhysicsModelState mPhysicsModelState;
+			PhysicsModels::PhysicsModel mPhysicsModel = PhysicsModels::PhysicsModel::NullModel;
+			RacecarControllerInterface::DecisionState mControllerDecisions;
+
+			tbCore::uint32 mElapsedSteps = 0;
+			iceVector3 mPreviousPosition = iceVector3::Zero();
+			iceMatrix4 mSwarmToWorld = iceMatrix4::Identity();
+			SweptBounds mSwarmSweptBounds = { iceVector3::Zero(), iceVector3::Zero() };
+			iceVector3 mSwarmVelocity = iceVector3::Zero();
+			int mOnTrackCounter = 0;
+			CreatureIndex mSwarmHealth = 0;
+			CreatureIndex::Integer mNumberOfCreatures = 0;
+			SwarmAudio mSwarmAudio = { };
+			DriverIndex mDriverIndex = InvalidDriver();
+
+			tbGame::GameTimer mIdleTimer = 0;
+			iceMatrix4 mSleepingToWorld = iceMatrix4::Identity();
+
+			bool mIsOnTrack = false;
+			bool mIsSleeping = false;
+			bool mRacecarFinished = false;
+			bool mCreatureFinished = false;
+			bool mJustResetted = false;
+			bool mCreatureListsChanged = false;
+		};
+
+		void SaveSnapshot(Snapshot& snapshot) const;
+
+		///
+		/// @details Returns false, without changing anything, when the snapshot was saved with a different driver or
+		///   physics model than the racecar has now, since those own state the snapshot does not hold.
+		///
+		bool CanRestoreSnapshot(const Snapshot& snapshot) const;
+		void RestoreSnapshot(const Snapshot& snapshot);
+
+		///
+		/// @details A 64-bit FNV-1a hash of the position, velocity and flags of every creature in the swarm. While the
+		///   swarms are deterministic, see RaceSessionState::SetDeterministicSwarms(), any machine that simulated the
+		///   same inputs ends up with the same hash.
+		///
+		tbCore::uint64 ComputeSwarmHash(void) const;
+
 		iceMatrix4 GetVehicleToWorld(void) const;
 		void SetVehicleToWorld(const iceMatrix4& vehicleToWorld);
 		iceVector3 GetPreviousPosition(void) const { return mPreviousPosition; }
@@ -127,7 +331,31 @@ namespace LudumDare56::GameState
 		iceScalar GetEngineSpeed(void) const;
 		Gear GetShifterPosition(void) const;
 
-		void Simulate(void);
+		///
+		/// @details A racecar is simulated in phases so the physics models can be stepped together and the swarms of
+		///   different racecars can run at the same time. SimulateControls() updates the controller and adds the physics
+		///   model to the batch, which then steps every racecar. SimulateVehicle() touches shared state (the physical
+		///   world) and must be called for one racecar at a time after the batch, while SimulateSwarm() only touches
+		///   this racecar and only reads from the world, so it may run on a worker while other racecars run
+		///   SimulateSwarm(). See RaceSessionState::Simulate().
+		///
+		///   A sleeping racecar still runs SimulateControls(), which holds it in place or wakes it, but SimulateVehicle()
+		///   and SimulateSwarm() must be skipped for it.
+		///
+		void SimulateControls(PhysicsModels::PhysicsModelBatch& vehiclePhysics);
+		void SimulateVehicle(void);
+		void SimulateSwarm(void);
+
+		///
+		/// @details A racecar falls asleep once it has been at rest for kSleepAfterMS with its swarm settled and nobody
+		///   at the controls, or with the race over for it. A sleeping racecar is held where it fell asleep, its physics
+		///   model is not stepped and its swarm is frozen and silent. It wakes as soon as the controller has any input,
+		///   something bumps into it, it gets reset or the session phase changes. SetVehicleToWorld() on a sleeping
+		///   racecar moves where it is held, and setting velocities beyond resting wakes it on the next step.
+		///
+		inline bool IsSleeping(void) const { return mIsSleeping; }
+		void WakeUp(void);
+
 		void RenderDebug(void) const;
 
 		void SetRacecarController(RacecarControllerInterface* controller);
@@ -150,22 +378,54 @@ namespace LudumDare56::GameState
 
 	private:
 		void SimulateCreatureSwarm(void);
-		iceVector3 CalculateCohesion(const Creature& creature, const iceScalar distance) const;
-		iceVector3 CalculateSeparation(const Creature& creature, const iceScalar distance) const;
-		iceVector3 CalculateAlignment(const Creature& creature, const iceScalar distance) const;
 
-		std::array<Creature, kNumberOfCreatures> mCreatures;
+		///
+		/// @details Counts up the time the racecar has been idle, and puts it to sleep once that reaches kSleepAfterMS.
+		///   Only reads from the physical world so it can run alongside the other swarms.
+		///
+		void UpdateSleep(void);
+		bool IsSwarmSettled(void) const;
+
+		void KillCreature(const CreatureIndex creatureIndex);
+
+		///
+		/// @details Removes the creatures that died or finished from the alive and racing lists, keeping the order.
+		///
+		void CompactCreatureLists(void);
+
+		///
+		/// @details Points the swarm kernels at the arrays of mCreatureSwarm.
+		///
+		SwarmKernels::SwarmData GetSwarmData(void);
+
+		CreatureSwarm mCreatureSwarm;
+		SpatialHashGrid mCreatureGrid;
+		SwarmKernels::SwarmScratch mSwarmScratch;
+		GroundProbeBatch mGroundProbes;
+		SwarmLevelOfDetail mSwarmLevelOfDetail;
+		SwarmStageTimes mSwarmStageTimes;
 
 		PhysicsModels::PhysicsModelInterfacePtr mPhysicsModel;
 		std::unique_ptr<RacecarControllerInterface> mController;
 		icePhysics::World* mPhysicalWorld;
 
-		tbGame::GameTimer mElapsedTime;
+		tbCore::uint32 mElapsedSteps; //Counted in steps so the time is exact at any tick rate, see StepsToMilliseconds().
+		tbGame::GameTimer mIdleTimer;
+		iceMatrix4 mSleepingToWorld;
 		iceVector3 mPreviousPosition;
 		iceMatrix4 mSwarmToWorld;
+		SweptBounds mSwarmSweptBounds;
 		iceVector3 mSwarmVelocity;
 		int mOnTrackCounter;
 		CreatureIndex mSwarmHealth;
+		CreatureIndex::Integer mNumberOfCreatures;
+
+		std::array<CreatureIndex::Integer, kMaximumCreatures> mAliveCreatures;
+		std::array<CreatureIndex::Integer, kMaximumCreatures> mRacingCreatures;
+		CreatureIndex::Integer mNumberOfAliveCreatures;
+		CreatureIndex::Integer mNumberOfRacingCreatures;
+
+		SwarmAudio mSwarmAudio;
 
 		RacecarIndex mRacecarIndex;
 		DriverIndex mDriverIndex;
@@ -174,9 +434,11 @@ namespace LudumDare56::GameState
 	private:
 		bool mIsOnTrack;
 		bool mIsVisible;
+		bool mIsSleeping;
 		bool mRacecarFinished;
 		bool mCreatureFinished;
 		bool mJustResetted;
+		bool mCreatureListsChanged;
 	};
 
 };	//namespace LudumDare56::GameState
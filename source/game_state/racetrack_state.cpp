@@ -18,6 +18,8 @@
 
 #include <turtle_brains/core/tb_types.hpp>
 
+#include <ice/core/ice_mesh_data.hpp>
+#include <ice/core/ice_mesh_manager.hpp>
 #include <ice/physics/ice_physical_world.hpp>
 
 #include <track_bundler/track_bundler.hpp>
@@ -87,6 +89,96 @@ namespace
 	tbMath::BezierCurve theRacetrackCurve;
 	iceCore::MeshHandle theRacetrackMesh;
 	std::unique_ptr<icePhysics::RigidBody> theRacetrackBody;
+	LudumDare56::GameState::BoundingVolumeHierarchy theRacetrackHierarchy;
+
+	void BuildRacetrackHierarchy(const icePhysics::MeshCollider& meshCollider)
+	{	//The racetrack body never moves from the origin, so the collider is already in world space.
+		const auto& vertices = meshCollider.GetVertices();
+		const auto& indices = meshCollider.GetIndices();
+
+		theRacetrackHierarchy.Clear();
+		for (size_t index = 0; index + 2 < indices.size(); index += 3)
+		{
+			theRacetrackHierarchy.AddTriangle(vertices[indices[index + 0]], vertices[indices[index + 1]], vertices[indices[index + 2]]);
+		}
+
+		theRacetrackHierarchy.Build();
+		tb_always_log(LudumDare56::LogState::Info() << "Built the racetrack hierarchy of " << theRacetrackHierarchy.GetNumberOfTriangles() <<
+			" triangles into " << theRacetrackHierarchy.GetNumberOfNodes() << " nodes.");
+	}
+
+	LudumDare56::GameState::TrackSurfaceTable theTrackSurface;
+
+	void BuildTrackSurface(void)
+	{	//Must wait until the whole racetrack is loaded, the TrackNodeEdges and racetrack mesh come from different components.
+		LudumDare56::GameState::Implementation::BuildTrackSurface(theTrackNodeEdges, theRacetrackHierarchy, theTrackSurface);
+		tb_always_log(LudumDare56::LogState::Info() << "Built the track surface table of " << theTrackSurface.GetNumberOfSamples() <<
+			" samples over " << theTrackSurface.GetNumberOfSegments() << " segments.");
+	}
+
+	//Set while LoadRacetrack() found a valid cooked racetrack, so the RacetrackLoader skips deriving the collider and the
+	//  TrackNodes which are created from the cooked racetrack once the bundle has loaded.
+	bool theIsLoadingCookedRacetrack = false;
+	bool theIsCookingRacetrack = false;
+
+	//Owned by theRacetrackBody, kept along with the mesh file the collider was extruded from for cooking the racetrack.
+	const icePhysics::MeshCollider* theRacetrackCollider = nullptr;
+	tbCore::tbString theRacetrackColliderFilepath = "";
+
+	void CreateRacetrackBody(icePhysics::MeshCollider* meshCollider)
+	{
+		theRacetrackCollider = meshCollider;
+		BuildRacetrackHierarchy(*meshCollider);
+
+		theRacetrackBody.reset(new icePhysics::RigidBody(-1.0));
+		theRacetrackBody->AddBoundingVolume(meshCollider);
+	}
+
+	void AddTrackNodeEdge(const LudumDare56::GameState::RacetrackState::TrackNodeEdge& nodeEdge)
+	{
+		using namespace LudumDare56::GameState;
+
+		theTrackNodeEdges.push_back(nodeEdge);
+		if (theTrackNodeEdges.size() > 1)
+		{
+			const RacetrackState::TrackNodeEdge& leadingEdge = theTrackNodeEdges[theTrackNodeEdges.size() - 1];
+			const RacetrackState::TrackNodeEdge& trailingEdge = theTrackNodeEdges[theTrackNodeEdges.size() - 2];
+			Implementation::TheMutableTrackNodes().emplace_back(Implementation::CreateTrackNode(
+				Implementation::ComputeTrackNodePlanes(leadingEdge, trailingEdge)));
+		}
+	}
+
+	void CreateFromCookedRacetrack(LudumDare56::GameState::Implementation::CookedRacetrack& cookedRacetrack)
+	{
+		using namespace LudumDare56::GameState;
+
+		if (false == cookedRacetrack.mColliderVertices.empty())
+		{	//Only the positions matter to the collider, the mesh is not rendered.
+			std::vector<iceCore::MeshVertex> meshVertices(cookedRacetrack.mColliderVertices.size());
+			for (size_t vertexIndex = 0; vertexIndex < meshVertices.size(); ++vertexIndex)
+			{
+				const iceVector3& position = cookedRacetrack.mColliderVertices[vertexIndex];
+				meshVertices[vertexIndex].mPosition = tbMath::Vector3(static_cast<float>(position.x), static_cast<float>(position.y),
+					static_cast<float>(position.z));
+				meshVertices[vertexIndex].mNormal = LudumDare56::WorldUp();
+				meshVertices[vertexIndex].mColor = 0xFFFFFFFF;
+				meshVertices[vertexIndex].mTextureUV = tbMath::Vector2::Zero();
+			}
+
+			const tbCore::uint8 meshFlags = iceCore::MeshFlags::kPosition;
+			theRacetrackMesh = iceCore::theMeshManager.CreateMeshFromData(meshVertices, cookedRacetrack.mColliderIndices, meshFlags);
+			CreateRacetrackBody(new icePhysics::MeshCollider(theRacetrackMesh));
+		}
+
+		theTrackNodeEdges = std::move(cookedRacetrack.mTrackNodeEdges);
+
+		Implementation::TrackNodeContainer& trackNodes = Implementation::TheMutableTrackNodes();
+		trackNodes.reserve(cookedRacetrack.mTrackNodePlanes.size());
+		for (const Implementation::TrackNodePlanes& planes : cookedRacetrack.mTrackNodePlanes)
+		{
+			trackNodes.emplace_back(Implementation::CreateTrackNode(planes));
+		}
+	}
 };
 
 //--------------------------------------------------------------------------------------------------------------------//
@@ -136,6 +228,11 @@ void LudumDare56::GameState::RacetrackState::InvalidateRacetrack(void)
 		theRacetrackMesh = iceCore::InvalidMesh();
 	}
 
+	theRacetrackHierarchy.Clear();
+	theTrackSurface.Clear();
+	theRacetrackCollider = nullptr;
+	theRacetrackColliderFilepath = "";
+
 	Implementation::TheMutableTrackNodes().clear();
 	theTrackNodeEdges.clear();
 
@@ -195,6 +292,7 @@ void LudumDare56::GameState::RacetrackState::Destroy(icePhysics::World& physical
 	{
 		physicalWorld.RemoveBody(theRacetrackBody.get());
 		theRacetrackBody = nullptr;
+		theRacetrackCollider = nullptr;
 	}
 
 	for (ObjectStatePtr& objectState : theRacetrackObjects)
@@ -315,14 +413,28 @@ void LudumDare56::GameState::RacetrackState::LoadRacetrack(const String& racetra
 
 	InvalidateRacetrack();
 
+	//The bundle is still loaded for the objects, components and checkpoints, but the collider and the TrackNodes come
+	//  straight from the cooked racetrack when there is a valid one, which is most of the load time.
+	Implementation::CookedRacetrack cookedRacetrack;
+	theIsLoadingCookedRacetrack = (false == theIsCookingRacetrack &&
+		true == Implementation::LoadCookedRacetrack(Implementation::ToCookedRacetrackFilepath(racetrackFilepath), cookedRacetrack));
+
 	if (false == TrackBundler::Legacy::LoadTrackBundle(racetrackFilepath, theRacetrackBundle, &theRacetrackLoader))
 	{
+		theIsLoadingCookedRacetrack = false;
 		InvalidateRacetrack();
 		tb_error("Failed to load track from file: %s", racetrackFilepath.c_str());
 		return;
 	}
 
+	if (true == theIsLoadingCookedRacetrack)
+	{
+		CreateFromCookedRacetrack(cookedRacetrack);
+		theIsLoadingCookedRacetrack = false;
+	}
+
 	theCurrentRacetrack = racetrackFilepath;
+	BuildTrackSurface();
 
 	theRacetrackBroadcaster.SendEvent(Events::CreateRacetrackEvent(theRacetrackBundle, theTrackSegmentDefinitions,
 		theTrackObjectDefinitions, theTrackSplineDefinitions));
@@ -330,6 +442,57 @@ void LudumDare56::GameState::RacetrackState::LoadRacetrack(const String& racetra
 
 //--------------------------------------------------------------------------------------------------------------------//
 
+bool LudumDare56::GameState::RacetrackState::CookRacetrack(const String& racetrackFilepath)
+{
+	theIsCookingRacetrack = true;
+	InvalidateRacetrack();
+	LoadRacetrack(racetrackFilepath);
+	theIsCookingRacetrack = false;
+
+	if (theCurrentRacetrack != racetrackFilepath)
+	{
+		return false;
+	}
+
+	Implementation::CookedRacetrack cookedRacetrack;
+	cookedRacetrack.mDependencies.push_back({ racetrackFilepath, Implementation::ComputeContentHash(racetrackFilepath) });
+	cookedRacetrack.mDependencies.push_back({ "data/track_splines_list.json", Implementation::ComputeContentHash("data/track_splines_list.json") });
+	if (false == theRacetrackColliderFilepath.empty())
+	{
+		cookedRacetrack.mDependencies.push_back({ theRacetrackColliderFilepath, Implementation::ComputeContentHash(theRacetrackColliderFilepath) });
+	}
+
+	if (nullptr != theRacetrackCollider)
+	{
+		const auto& vertices = theRacetrackCollider->GetVertices();
+		const auto& indices = theRacetrackCollider->GetIndices();
+		cookedRacetrack.mColliderVertices.assign(vertices.begin(), vertices.end());
+		for (const auto vertexIndex : indices)
+		{
+			cookedRacetrack.mColliderIndices.push_back(static_cast<tbCore::uint32>(vertexIndex));
+		}
+	}
+
+	cookedRacetrack.mTrackNodeEdges = theTrackNodeEdges;
+	for (size_t edgeIndex = 1; edgeIndex < theTrackNodeEdges.size(); ++edgeIndex)
+	{
+		cookedRacetrack.mTrackNodePlanes.push_back(Implementation::ComputeTrackNodePlanes(
+			theTrackNodeEdges[edgeIndex], theTrackNodeEdges[edgeIndex - 1]));
+	}
+
+	const String cookedFilepath = Implementation::ToCookedRacetrackFilepath(racetrackFilepath);
+	if (false == Implementation::SaveCookedRacetrack(cookedFilepath, cookedRacetrack))
+	{
+		return false;
+	}
+
+	tb_always_log(LogState::Info() << "Cooked racetrack \"" << cookedFilepath << "\" with " << cookedRacetrack.mColliderIndices.size() / 3 <<
+		" collider triangles and " << cookedRacetrack.mTrackNodePlanes.size() << " track nodes.");
+	return true;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
 const LudumDare56::GameState::ObjectState& LudumDare56::GameState::RacetrackState::GetObjectState(const ObjectHandle objectHandle)
 {
 	tb_error_if(objectHandle >= theRacetrackObjects.size(), "Error: objectHandle is out of range getting transform.");
@@ -402,17 +565,48 @@ const LudumDare56::GameState::RacetrackState::TrackNodeEdge& LudumDare56::GameSt
 
 bool LudumDare56::GameState::RacetrackState::IsOnTrack(const iceVector3& positionInWorld)
 {
-	//float distance = 0.0;
-	//theRacetrackCurve.GetClosestPoint(positionInWorld, distance);
-	//return (distance > 9.5f);
+	TrackSurfaceTable::SurfaceSample sample;
+	return (true == theTrackSurface.QuerySurface(positionInWorld, sample) && true == sample.mIsOnTrack);
+}
 
+//--------------------------------------------------------------------------------------------------------------------//
 
-//	theRacetrackMesh
+bool LudumDare56::GameState::RacetrackState::QueryTrackSurface(const iceVector3& positionInWorld,
+	TrackSurfaceTable::SurfaceSample& sample)
+{
+	return theTrackSurface.QuerySurface(positionInWorld, sample);
+}
 
-	tb_unused(positionInWorld);
+//--------------------------------------------------------------------------------------------------------------------//
+
+const LudumDare56::GameState::TrackSurfaceTable& LudumDare56::GameState::RacetrackState::GetTrackSurface(void)
+{
+	return theTrackSurface;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+bool LudumDare56::GameState::RacetrackState::CastRayAgainstRacetrack(const iceVector3& origin, const iceVector3& direction,
+	const iceScalar maximumDistance, iceVector3& intersectionPoint, iceScalar& distance)
+{
+	BoundingVolumeHierarchy::RayHit hit;
+	if (false == theRacetrackHierarchy.CastRay(origin, direction, maximumDistance, hit))
+	{
+		return false;
+	}
+
+	intersectionPoint = hit.mPoint;
+	distance = hit.mDistance;
 	return true;
 }
 
+//--------------------------------------------------------------------------------------------------------------------//
+
+const LudumDare56::GameState::BoundingVolumeHierarchy& LudumDare56::GameState::RacetrackState::GetRacetrackHierarchy(void)
+{
+	return theRacetrackHierarchy;
+}
+
 //--------------------------------------------------------------------------------------------------------------------//
 //--------------------------------------------------------------------------------------------------------------------//
 //--------------------------------------------------------------------------------------------------------------------//
@@ -541,7 +735,7 @@ void LudumDare56::GameState::Implementation::RacetrackLoader::OnCreateComponent(
 
 		const TrackBundler::ResourceKey meshResourceKey = TrackBundler::ResourceKey::FromString(component.mProperties["mesh"].AsString());
 		const String meshFilepath = TrackBundler::MasterResourceTable::Get().GetResource(meshResourceKey).mFilepath;
-		if ("racetrack" == node.GetName() && true == tbCore::StringContains(meshFilepath, "_collider"))
+		if ("racetrack" == node.GetName() && true == tbCore::StringContains(meshFilepath, "_collider") && false == theIsLoadingCookedRacetrack)
 		{
 			iceGraphics::Visualization unusedDebug;
 
@@ -550,9 +744,9 @@ void LudumDare56::GameState::Implementation::RacetrackLoader::OnCreateComponent(
 
 			tb_error_if(nullptr == splinePathComponent, "Error: Expected 'racetrack' node to have a Spline Path component.");
 			theRacetrackMesh = TrackBundler::CreateMeshFromSplineComponent(*splinePathComponent, component , unusedDebug);
+			theRacetrackColliderFilepath = meshFilepath;
 
-			theRacetrackBody.reset(new icePhysics::RigidBody(-1.0));
-			theRacetrackBody->AddBoundingVolume(new icePhysics::MeshCollider(theRacetrackMesh));
+			CreateRacetrackBody(new icePhysics::MeshCollider(theRacetrackMesh));
 		}
 	}
 	else if (component.mDefinitionKey == TrackBundler::ComponentDefinition::kSplinePathKey)
@@ -583,6 +777,11 @@ void LudumDare56::GameState::Implementation::RacetrackLoader::OnCreateComponent(
 			RaceSessionState::SetCurrentTrackDisplayName(trackProperties.GetMember("track_name").AsStringWithDefault("Track X"));
 			RaceSessionState::SetNextLevel(trackProperties.GetMember("next_track").AsStringWithDefault(""));
 
+			if (true == theIsLoadingCookedRacetrack)
+			{	//The TrackNodes and TrackNodeEdges are created from the cooked racetrack after the bundle has loaded.
+				return;
+			}
+
 			iceGraphics::Visualization unusedDebug;
 			const TrackBundler::Component* splineMeshComponent = GetComponentOn(node.mNodeKey, trackBundle.mImprovedBundle,
 				TrackBundler::ComponentDefinition::kSplineMeshKey);
@@ -621,24 +820,7 @@ void LudumDare56::GameState::Implementation::RacetrackLoader::OnCreateComponent(
 					nodeEdge[TrackEdge::kCenter] = centerPoints[index];
 					nodeEdge[TrackEdge::kRight] = centerPoints[index] + trackRightHalfWidth;
 					nodeEdge[TrackEdge::kLeft] = centerPoints[index] - trackRightHalfWidth;
-					theTrackNodeEdges.push_back(nodeEdge);
-
-					if (index > 0)
-					{
-						const RacetrackState::TrackNodeEdge& leadingEdge = theTrackNodeEdges[theTrackNodeEdges.size() - 1];
-						const RacetrackState::TrackNodeEdge& trailingEdge = theTrackNodeEdges[theTrackNodeEdges.size() - 2];
-
-						TheMutableTrackNodes().emplace_back(TrackNode{ //leading, trailing, left, right
-							icePhysics::BoundingPlane(leadingEdge[TrackEdge::kCenter], icePhysics::Vector3::Cross(
-								Up(), leadingEdge[TrackEdge::kRight] - leadingEdge[TrackEdge::kLeft])),
-							icePhysics::BoundingPlane(trailingEdge[TrackEdge::kCenter], icePhysics::Vector3::Cross(
-								trailingEdge[TrackEdge::kRight] - trailingEdge[TrackEdge::kLeft], Up())),
-							icePhysics::BoundingPlane(leadingEdge[TrackEdge::kLeft], icePhysics::Vector3::Cross(
-								Up(), leadingEdge[TrackEdge::kLeft] - trailingEdge[TrackEdge::kLeft])),
-							icePhysics::BoundingPlane(leadingEdge[TrackEdge::kRight], icePhysics::Vector3::Cross(
-								leadingEdge[TrackEdge::kRight] - trailingEdge[TrackEdge::kRight], Up())),
-						});
-					}
+					AddTrackNodeEdge(nodeEdge);
 				}
 			}
 		}
@@ -739,7 +921,7 @@ void LudumDare56::GameState::Implementation::RacetrackLoader::OnCreateTrackSplin
 	const TrackBundler::Legacy::TrackSpline& trackSpline, const TrackBundler::Legacy::TrackBundle& /*trackBundle*/)
 {
 	const TrackBundler::Legacy::TrackSplineDefinition& splineDefinition = theTrackSplineDefinitions[trackSpline.mDefinitionIndex];
-	if ("Simple Road" == splineDefinition.mDisplayName)
+	if ("Simple Road" == splineDefinition.mDisplayName && false == theIsLoadingCookedRacetrack)
 	{
 		tb_error_if(false == TheTrackNodes().empty(), "Error: Expected TheTrackNodes container to be empty, is there more than one racetrack?");
 		tb_error_if(false == theTrackNodeEdges.empty(), "Error: Expected TrackNodeEdges to be empty, is there more than one racetrack?");
@@ -775,24 +957,7 @@ void LudumDare56::GameState::Implementation::RacetrackLoader::OnCreateTrackSplin
 				nodeEdge[TrackEdge::kCenter] = centerPoints[index];
 				nodeEdge[TrackEdge::kRight] = centerPoints[index] + trackRightHalfWidth;
 				nodeEdge[TrackEdge::kLeft] = centerPoints[index] - trackRightHalfWidth;
-				theTrackNodeEdges.push_back(nodeEdge);
-
-				if (index > 0)
-				{
-					const RacetrackState::TrackNodeEdge& leadingEdge = theTrackNodeEdges[theTrackNodeEdges.size() - 1];
-					const RacetrackState::TrackNodeEdge& trailingEdge = theTrackNodeEdges[theTrackNodeEdges.size() - 2];
-
-					TheMutableTrackNodes().emplace_back(TrackNode{ //leading, trailing, left, right
-						icePhysics::BoundingPlane(leadingEdge[TrackEdge::kCenter], icePhysics::Vector3::Cross(
-							Up(), leadingEdge[TrackEdge::kRight] - leadingEdge[TrackEdge::kLeft])),
-						icePhysics::BoundingPlane(trailingEdge[TrackEdge::kCenter], icePhysics::Vector3::Cross(
-							trailingEdge[TrackEdge::kRight] - trailingEdge[TrackEdge::kLeft], Up())),
-						icePhysics::BoundingPlane(leadingEdge[TrackEdge::kLeft], icePhysics::Vector3::Cross(
-							Up(), leadingEdge[TrackEdge::kLeft] - trailingEdge[TrackEdge::kLeft])),
-						icePhysics::BoundingPlane(leadingEdge[TrackEdge::kRight], icePhysics::Vector3::Cross(
-							leadingEdge[TrackEdge::kRight] - trailingEdge[TrackEdge::kRight], Up())),
-					});
-				}
+				AddTrackNodeEdge(nodeEdge);
 			}
 		}
 	}
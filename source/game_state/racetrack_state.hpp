@@ -9,6 +9,8 @@
 #define LudumDare56_RacetrackManager_hpp
 
 #include "../game_state/race_session_state.hpp"
+#include "../game_state/helpers/bounding_volume_hierarchy.hpp"
+#include "../game_state/helpers/track_surface_table.hpp"
 #include "../core/event_system.hpp"
 #include "../core/typed_range.hpp"
 #include "../ludumdare56.hpp"
@@ -66,6 +68,13 @@ namespace LudumDare56
 			TrackBundler::Legacy::TrackBundle& GetTrackBundle(void);
 			void LoadRacetrack(const String& racetrackFilepath);
 
+			///
+			/// @details Loads the racetrack, ignoring any cooked racetrack, then saves the collider, TrackNodeEdges and
+			///   TrackNodes that were derived into a .ctrk beside it so LoadRacetrack() can skip deriving them next time.
+			///   The racetrack is left loaded. Returns false if it failed to load or the cooked racetrack failed to save.
+			///
+			bool CookRacetrack(const String& racetrackFilepath);
+
 			const ObjectState& GetObjectState(const ObjectHandle objectHandle);
 			ObjectState& GetMutableObjectState(const ObjectHandle objectHandle);
 
@@ -98,8 +107,33 @@ namespace LudumDare56
 
 			inline bool IsValidTrackNode(const TrackNodeIndex trackNodeIndex) { return trackNodeIndex <= GetNumberOfTrackNodes(); }
 
+			///
+			/// @details Returns true if the position is above, or below, the racetrack surface between the left and right
+			///   edges of the track. This only looks up the TrackSurfaceTable built as the racetrack was loaded, so it
+			///   is cheap enough for every creature, every step, and never touches the physical world.
+			///
 			bool IsOnTrack(const iceVector3& positionInWorld);
 
+			///
+			/// @details Finds the ground height, distance along the track and lateral offset beneath the position from the
+			///   TrackSurfaceTable. Returns false when the position is beyond the shoulders of the track or there is no
+			///   racetrack loaded, in which case the sample is left alone.
+			///
+			bool QueryTrackSurface(const iceVector3& positionInWorld, TrackSurfaceTable::SurfaceSample& sample);
+
+			const TrackSurfaceTable& GetTrackSurface(void);
+
+			///
+			/// @details Casts a ray against only the racetrack surface, through a BoundingVolumeHierarchy built as the
+			///   racetrack was loaded, so the cost barely grows with the complexity of the racetrack. The direction is
+			///   expected to be normalized. Returns false if nothing is hit within maximumDistance, or there is no
+			///   racetrack surface, in which case a caller may still cast against the physical world.
+			///
+			bool CastRayAgainstRacetrack(const iceVector3& origin, const iceVector3& direction, const iceScalar maximumDistance,
+				iceVector3& intersectionPoint, iceScalar& distance);
+
+			const BoundingVolumeHierarchy& GetRacetrackHierarchy(void);
+
 		};	//namespace RacetrackState
 
 		typedef RacetrackState::TrackEdge TrackEdge;
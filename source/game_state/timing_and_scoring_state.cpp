@@ -38,20 +38,7 @@ namespace LudumDare56
 				bool mCutPenalty = false;
 			};
 
-			struct Transponder
-			{
-				icePhysics::Vector3 mPosition = icePhysics::Vector3::Zero();
-				icePhysics::Vector2 mPositionOnTrack = icePhysics::Vector2::Zero();
-				TimingState::CheckpointIndex mCheckpointIndex = TimingState::InvalidCheckpoint();
-				TimingState::TrackNodeIndex mTrackNodeIndex = TimingState::InvalidTrackNode();
-				TimingState::TrackNodeIndex mLastValidNode = TimingState::InvalidTrackNode();
-				tbGame::GameTimer mElapsedLapTime = 0;
-				int mRaceStanding = 0; //0 is out-of-race, 1, 2, 3 etc.
-				LapCounter mCurrentLap = 0;
-				bool mIsActive = false;
-
-				static Transponder Invalid(void) { return Transponder(); }
-			};
+			using TimingState::Transponder;
 
 			struct LapResult
 			{	//It is important to remember the driver name, etc that has left the competition, so we can't just
@@ -170,11 +157,11 @@ void LudumDare56::GameState::TimingState::Simulate(void)
 		{
 			transponder.mIsActive = true;
 			transponder.mPosition = racecarPosition;
-			transponder.mElapsedLapTime = 0;
+			transponder.mElapsedLapSteps = 0;
 			transponder.mCurrentLap = 0;
 		}
 
-		transponder.mElapsedLapTime.IncrementStep();
+		++transponder.mElapsedLapSteps;
 
 		if (true)
 		{
@@ -196,29 +183,30 @@ void LudumDare56::GameState::TimingState::Simulate(void)
 						//  This is duplicated to prevent the Standings jumping about on the very first lap whether the checkpoint
 						//  is slightly ahead or behind where the TrackNode circuit loops from finish to start.
 						transponder.mCheckpointIndex = 0;
-						transponder.mElapsedLapTime = 0;
+						transponder.mElapsedLapSteps = 0;
 						transponder.mCurrentLap = 1;
 					}
 					else if (0 == checkpoint.mCheckpointIndex && theHighestCheckpointIndex == transponder.mCheckpointIndex)
 					{
-						transponder.mElapsedLapTime += static_cast<tbCore::uint32>(teeFraction * 1000.0 + 0.5);
+						const tbCore::uint32 lapTime = StepsToMilliseconds(transponder.mElapsedLapSteps) +
+							static_cast<tbCore::uint32>(teeFraction * 1000.0 + 0.5);
 
 						tb_debug_log(LogState::Info() << DebugInfo(racecar) << " has finished lap " << +transponder.mCurrentLap <<
-							" with a time of: " << tbCore::String::TimeToString(transponder.mElapsedLapTime.GetElapsedTime()));
+							" with a time of: " << tbCore::String::TimeToString(lapTime));
 
 						const DriverState& driver = DriverState::Get(racecar.GetDriverIndex());
 
 						if (true == IsTrusted())
 						{
 							const Events::TimingEvent lapResultEvent(Events::Timing::CompletedLapResult, driver.GetLicense(),
-								driver.GetName(), transponder.mElapsedLapTime.GetElapsedTime(), transponder.mCurrentLap);
+								driver.GetName(), lapTime, transponder.mCurrentLap);
 
 							AddCompletedLapResult(lapResultEvent);
 						}
 
 						//Setup and start the next lap... (this is assuming lap-based racing)
 						transponder.mCheckpointIndex = checkpoint.mCheckpointIndex;
-						transponder.mElapsedLapTime = 0;
+						transponder.mElapsedLapSteps = 0;
 						++transponder.mCurrentLap;
 					}
 				}
@@ -248,7 +236,7 @@ void LudumDare56::GameState::TimingState::Simulate(void)
 				//  This is duplicated to prevent the Standings jumping about on the very first lap whether the checkpoint
 				//  is slightly ahead or behind where the TrackNode circuit loops from finish to start.
 				transponder.mCheckpointIndex = 0;
-				transponder.mElapsedLapTime = 0;
+				transponder.mElapsedLapSteps = 0;
 				transponder.mCurrentLap = 1;
 			}
 
@@ -260,7 +248,12 @@ void LudumDare56::GameState::TimingState::Simulate(void)
 
 		transponder.mPosition = racecarPosition;
 	}
+}
 
+//--------------------------------------------------------------------------------------------------------------------//
+
+void LudumDare56::GameState::TimingState::SimulateStandings(void)
+{
 	///
 	/// Sort the current racecar standings based on what transponders are where, and update the transponder standings.
 	///
@@ -319,6 +312,25 @@ void LudumDare56::GameState::TimingState::AddCompletedLapResult(const Events::Ti
 
 //--------------------------------------------------------------------------------------------------------------------//
 
+void LudumDare56::GameState::TimingState::SaveSnapshot(Snapshot& snapshot)
+{
+	snapshot.mTransponders = theTransponders;
+	snapshot.mNumberOfLapResults = theLapResults.size();
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void LudumDare56::GameState::TimingState::RestoreSnapshot(const Snapshot& snapshot)
+{
+	theTransponders = snapshot.mTransponders;
+	if (snapshot.mNumberOfLapResults < theLapResults.size())
+	{	//Shrinking never reallocates, and results cleared by ResetCompetition() since the snapshot stay cleared.
+		theLapResults.resize(snapshot.mNumberOfLapResults);
+	}
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
 int LudumDare56::GameState::TimingState::GetRaceStandingsFor(const RacecarIndex racecarIndex)
 {
 	return theTransponders[racecarIndex].mRaceStanding;
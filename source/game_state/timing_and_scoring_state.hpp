@@ -18,6 +18,8 @@
 
 #include <ice/physics/ice_physical_types.hpp>
 
+#include <array>
+
 namespace LudumDare56
 {
 	namespace GameState
@@ -36,6 +38,31 @@ namespace LudumDare56
 			constexpr TrackNodeIndex InvalidTrackNode(void) { return RacetrackState::InvalidTrackNode(); }
 			//inline bool IsValidTrackNode(const TrackNodeIndex trackNodeIndex) { return RacetrackState::IsValidTrackNode(trackNodeIndex); }
 
+			struct Transponder
+			{
+				icePhysics::Vector3 mPosition = icePhysics::Vector3::Zero();
+				icePhysics::Vector2 mPositionOnTrack = icePhysics::Vector2::Zero();
+				CheckpointIndex mCheckpointIndex = InvalidCheckpoint();
+				TrackNodeIndex mTrackNodeIndex = InvalidTrackNode();
+				TrackNodeIndex mLastValidNode = InvalidTrackNode();
+				tbCore::uint32 mElapsedLapSteps = 0; //Counted in steps so the lap time is exact at any tick rate.
+				int mRaceStanding = 0; //0 is out-of-race, 1, 2, 3 etc.
+				LapCounter mCurrentLap = 0;
+				bool mIsActive = false;
+
+				static Transponder Invalid(void) { return Transponder(); }
+			};
+
+			///
+			/// @details The transponders of every racecar and how many laps had been completed, for the snapshots of the
+			///   RaceSessionState. The lap results themselves are not copied, restoring only drops the ones added since.
+			///
+			struct Snapshot
+			{
+				std::array<Transponder, kNumberOfRacecars> mTransponders;
+				size_t mNumberOfLapResults = 0;
+			};
+
 			///
 			/// @details Add an EventListenter for TimingEvents.
 			///
@@ -64,15 +91,30 @@ namespace LudumDare56
 			void AddCheckpoint(const icePhysics::Matrix4& checkpointToWorld, const CheckpointIndex checkpointIndex, bool withCutPenalty);
 
 			///
-			///
+			/// @details Moves each transponder along with its racecar, crossing checkpoints and completing laps. This
+			///   needs to run every step so no crossing is missed and the lap times stay exact.
 			///
 			void Simulate(void);
 
+			///
+			/// @details Sorts the racecars into their race standings from where the transponders are, which is fine to
+			///   run less often than Simulate().
+			///
+			void SimulateStandings(void);
+
 			///
 			/// @details This is so the GameClient can add the results the GameServer sends.
 			///
 			void AddCompletedLapResult(const Events::TimingEvent& lapResultEvent);
 
+			void SaveSnapshot(Snapshot& snapshot);
+
+			///
+			/// @details Puts the transponders back and removes any lap results completed after the snapshot was saved.
+			///   The lap result events that were already sent are not taken back, and never allocates.
+			///
+			void RestoreSnapshot(const Snapshot& snapshot);
+
 			int GetRaceStandingsFor(const RacecarIndex racecarIndex);
 
 			LapCounter GetCurrentLapFor(const RacecarIndex racecarIndex);
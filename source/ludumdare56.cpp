@@ -10,6 +10,10 @@
 #include "version.hpp"
 
 #include "game_server/game_server.hpp"
+#include "game_server/swarm_benchmark.hpp"
+#include "game_server/fast_forward.hpp"
+#include "game_server/racetrack_cooker.hpp"
+#include "game_state/race_session_state.hpp"
 #include "core/utilities.hpp"
 #include "core/services/connector_service_interface.hpp"
 #include "core/development/developer_console.hpp" //where Init/Cleanup DevTools lives.
@@ -19,6 +23,7 @@
 #include <turtle_brains/system/tb_system_utilities.hpp>
 #include <turtle_brains/core/unit_test/tb_unit_test.hpp>
 #include <turtle_brains/core/tb_version.hpp>
+#include <turtle_brains/game/tb_game_timer.hpp>
 
 #include <ice/core/ice_version.hpp>
 
@@ -85,6 +90,10 @@ namespace LudumDare56
 	};
 
 	String theQuickPlayRacetrackPath = "";
+
+	tbCore::uint32 theTickRate = kDefaultTickRate;
+	float theFixedTime = 1.0f / static_cast<float>(kDefaultTickRate);
+	MillisecondTimer theFixedTimeMS = 1000 / kDefaultTickRate;
 };
 
 int LudumDare56::GameClient::Main(int argumentCount, const char* argumentValues[])
@@ -230,6 +239,7 @@ LudumDare56::UserSettings LudumDare56::ParseLaunchParameters(int argumentCount,
 		{ "--headless", "headless" },
 		{ "--server", "server" },
 		{ "--developer", "developer" },
+		{ "--deterministic", "deterministic" },
 	};
 
 	const std::map<String, String> intArgumentToKeys = {
@@ -239,6 +249,12 @@ LudumDare56::UserSettings LudumDare56::ParseLaunchParameters(int argumentCount,
 		{ "--height", "window_height" },
 		{ "--multi", "multi" },
 		{ "--split", "split" },
+		{ "--ticks", "benchmark_ticks" },
+		{ "--seed", "benchmark_seed" },
+		{ "--laps", "fast_forward_laps" },
+		{ "--minimum_rate", "fast_forward_minimum_rate" },
+		{ "--tick_rate", "tick_rate" },
+		{ "--simulation_workers", "simulation_workers" },
 	};
 
 	const std::map<String, String> stringArgumentToKeys = {
@@ -290,11 +306,40 @@ int main(const int argumentCount, const char* argumentValues[])
 			LudumDare56::String testHeader = "Testing " + LudumDare56::Version::ProjectVersionString();
 			return (true == TurtleBrains::Core::UnitTest::RunAllTests(testHeader)) ? 0 : 1;
 		}
+
+		//Run the swarm benchmark if --benchmark is present, optionally with --ticks, --seed and --racetrack.
+		if (LudumDare56::String("--benchmark") == argumentValues[argumentIndex])
+		{
+			return LudumDare56::GameServer::RunSwarmBenchmark(argumentCount, argumentValues);
+		}
+
+		//Run the session as fast as possible if --fast_forward is present, optionally with --ticks, --laps,
+		//  --minimum_rate and --racetrack.
+		if (LudumDare56::String("--fast_forward") == argumentValues[argumentIndex])
+		{
+			return LudumDare56::GameServer::RunFastForward(argumentCount, argumentValues);
+		}
+
+		//Cook every racetrack, or only --racetrack, if --cook_racetracks is present.
+		if (LudumDare56::String("--cook_racetracks") == argumentValues[argumentIndex])
+		{
+			return LudumDare56::GameServer::RunRacetrackCooker(argumentCount, argumentValues);
+		}
 	}
 
-	// Run --test above this so it can output the results into the nightly build emails.
+	// Run --test, --benchmark, --fast_forward and --cook_racetracks above this so they can output the results into the
+	//   nightly build emails.
 
 	const LudumDare56::UserSettings launchSettings = LudumDare56::ParseLaunchParameters(argumentCount, argumentValues);
+	if (true == launchSettings.GetBoolean("deterministic"))
+	{	//Every machine in a lockstep session, or replaying one, must be launched with --deterministic.
+		LudumDare56::GameState::RaceSessionState::SetDeterministicSwarms(true);
+	}
+	if (launchSettings.GetInteger("simulation_workers", -1) >= 0)
+	{
+		LudumDare56::GameState::RaceSessionState::SetNumberOfSimulationWorkers(
+			static_cast<size_t>(launchSettings.GetInteger("simulation_workers")));
+	}
 
 #if defined(ludumdare56_headless_build)
 	tbCore::Debug::OpenLog(LudumDare56::GetSaveDirectory() + launchSettings.GetString("server_log", "server_log.txt"), true);
@@ -323,6 +368,62 @@ int main(const int argumentCount, const char* argumentValues[])
 
 //--------------------------------------------------------------------------------------------------------------------//
 
+bool LudumDare56::IsValidTickRate(const tbCore::uint32 ticksPerSecond)
+{
+	return (ticksPerSecond >= kMinimumTickRate && ticksPerSecond <= kMaximumTickRate);
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void LudumDare56::SetTickRate(const tbCore::uint32 ticksPerSecond)
+{
+	tb_error_if(false == IsValidTickRate(ticksPerSecond), "Expected the tick rate to be within %d and %d steps per second.",
+		static_cast<int>(kMinimumTickRate), static_cast<int>(kMaximumTickRate));
+
+	theTickRate = ticksPerSecond;
+	theFixedTime = 1.0f / static_cast<float>(ticksPerSecond);
+	SetFixedTimeStep(0);
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+tbCore::uint32 LudumDare56::GetTickRate(void)
+{
+	return theTickRate;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+float LudumDare56::FixedTime(void)
+{
+	return theFixedTime;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+void LudumDare56::SetFixedTimeStep(const tbCore::uint64 simulationStep)
+{	//The milliseconds from the start of the second to the end of this step, less those to its start.
+	const tbCore::uint64 stepInSecond = simulationStep % theTickRate;
+	theFixedTimeMS = static_cast<MillisecondTimer>(StepsToMilliseconds(stepInSecond + 1) - StepsToMilliseconds(stepInSecond));
+	tbGame::GameTimer::SetMillisecondsPerStep(theFixedTimeMS);
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+LudumDare56::MillisecondTimer LudumDare56::FixedTimeMS(void)
+{
+	return theFixedTimeMS;
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
+LudumDare56::MillisecondTimer LudumDare56::StepsToMilliseconds(const tbCore::uint64 numberOfSteps)
+{
+	return static_cast<MillisecondTimer>(numberOfSteps * 1000 / theTickRate);
+}
+
+//--------------------------------------------------------------------------------------------------------------------//
+
 LudumDare56::String LudumDare56::GetSaveDirectory(void)
 {
 #if defined(ludumdare56_headless_build)
@@ -367,3 +468,57 @@ LudumDare56::String LudumDare56::GetYouTubeClientID(void)
 }
 
 //--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
+//--------------------------------------------------------------------------------------------------------------------//
+
+class TickRateTest : tbCore::UnitTest::TestCaseInterface
+{
+public:
+	TickRateTest(void) :
+		tbCore::UnitTest::TestCaseInterface("TickRateTest")
+	{
+	}
+
+	~TickRateTest(void)
+	{
+	}
+
+protected:
+	virtual bool OnRunTest(void) override
+	{
+		using namespace LudumDare56;
+
+		const tbCore::uint32 previousTickRate = GetTickRate();
+
+		for (const tbCore::uint32 tickRate : { 30u, 60u, 100u, 120u, 144u, 240u })
+		{
+			ExpectedValue(IsValidTickRate(tickRate), true, "Expected a tick rate of %d to be valid.", static_cast<int>(tickRate));
+			SetTickRate(tickRate);
+
+			//A couple seconds, starting partway through one, must still add up to whole seconds of milliseconds.
+			MillisecondTimer totalTime = 0;
+			for (tbCore::uint64 simulationStep = 7; simulationStep < 7 + 2 * tickRate; ++simulationStep)
+			{
+				SetFixedTimeStep(simulationStep);
+				totalTime += FixedTimeMS();
+				ExpectedValue(tbGame::GameTimer::GetMillisecondsPerStep() == FixedTimeMS(), true,
+					"Expected the GameTimers to step by the milliseconds of the step.");
+			}
+
+			ExpectedValue(totalTime == 2000, true, "Expected two seconds at %d steps per second to last 2000ms, not %d.",
+				static_cast<int>(tickRate), static_cast<int>(totalTime));
+			ExpectedValue(StepsToMilliseconds(60 * tickRate) == 60000, true, "Expected a minute at %d steps per second to last 60000ms.",
+				static_cast<int>(tickRate));
+		}
+
+		ExpectedValue(IsValidTickRate(kMinimumTickRate - 1) || IsValidTickRate(kMaximumTickRate + 1), false,
+			"Expected tick rates beyond the limits to be invalid.");
+
+		SetTickRate(previousTickRate);
+		return true;
+	}
+};
+
+TickRateTest theTickRateTest;
+
+//--------------------------------------------------------------------------------------------------------------------//
@@ -61,8 +61,37 @@ namespace LudumDare56
 
 	typedef tbCore::uint32 MillisecondTimer;
 
-	static const MillisecondTimer kFixedTimeMS(10);
-	static const float kFixedTime(0.01f);
+	///
+	/// @details The simulation steps at a fixed tick rate, chosen as the RaceSession gets created. The GameTimers and
+	///   the network timers count whole milliseconds, so at a rate like 60 the steps alternate between 16 and 17ms, see
+	///   SetFixedTimeStep(), which adds up to exactly 1000ms every second.
+	///
+	static const tbCore::uint32 kDefaultTickRate(100);
+	static const tbCore::uint32 kMinimumTickRate(30);
+	static const tbCore::uint32 kMaximumTickRate(240);
+
+	///
+	/// @details Returns true if the rate is within kMinimumTickRate and kMaximumTickRate. Anything from the command line
+	///   or the network must be checked before it reaches SetTickRate().
+	///
+	bool IsValidTickRate(const tbCore::uint32 ticksPerSecond);
+	void SetTickRate(const tbCore::uint32 ticksPerSecond);
+	tbCore::uint32 GetTickRate(void);
+	float FixedTime(void);
+
+	///
+	/// @details Picks the whole milliseconds of the given simulation step, which FixedTimeMS() returns and the GameTimers
+	///   step by, so that every GetTickRate() steps add up to exactly one second. Called at the start of each step.
+	///
+	void SetFixedTimeStep(const tbCore::uint64 simulationStep);
+	MillisecondTimer FixedTimeMS(void);
+
+	///
+	/// @details Returns the milliseconds that pass in the number of steps, rounded down, without the error of adding
+	///   up FixedTimeMS() for each step.
+	///
+	MillisecondTimer StepsToMilliseconds(const tbCore::uint64 numberOfSteps);
+
 	static const Vector3 kTheZeroVector = Vector3::Zero();
 
 	inline Vector3 WorldUp(void) { return Vector3(0.0f, 1.0f, 0.0f); }
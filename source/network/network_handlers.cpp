@@ -461,7 +461,21 @@ bool LudumDare56::Network::ClientPacketHandler::OnHandlePacket(const tbCore::byt
 			//
 			//  Not actually supporting the changing the racetrack mid-session at this particular moment, but see above.
 
-			GameState::RaceSessionState::Create(false, racetrackFilepath);
+			if (false == IsValidTickRate(packet.tickRate))
+			{	//SetTickRate() would stop the whole game over a bad packet, so reject the session instead.
+				tb_always_log(LogClient::Error() << "The GameServer sent a tick rate of " << packet.tickRate << " which is not valid.");
+				Network::DestroyConnectionSoon(DisconnectReason::InvalidInformation);
+				break;
+			}
+
+			if (0 == packet.creaturesPerRacecar || packet.creaturesPerRacecar > GameState::kMaximumCreaturesPerRacecar)
+			{
+				tb_always_log(LogClient::Error() << "The GameServer sent a swarm size of " << packet.creaturesPerRacecar << " which is not valid.");
+				Network::DestroyConnectionSoon(DisconnectReason::InvalidInformation);
+				break;
+			}
+
+			GameState::RaceSessionState::Create(false, racetrackFilepath, packet.creaturesPerRacecar, packet.tickRate);
 
 			//Note: Because of single-threading we know the racetrack has been loaded and fully created at this point,
 			//  so we can tell the server the track has been loaded and we are ready to know about the racecars.
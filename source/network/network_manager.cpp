@@ -24,8 +24,7 @@ namespace LudumDare56
 	{
 		namespace Implementation
 		{
-			//All timers are in milliseconds, it is assumed that Simulate() is called at 10ms steps.
-			const tbCore::uint32 kStepTime = 10;
+			//All timers are in milliseconds, it is assumed that Simulate() is called once each FixedTimeMS() step.
 			const tbCore::uint32 kMaximumTimeout = 5000;
 
 			tbCore::uint8 theUpdatePacketsPerSecond = 5;
@@ -471,13 +470,13 @@ void LudumDare56::Network::Simulate(void)
 	//GameClient needs to receive data before it can be fully established, Server does not need to...
 	if (false == IsConnected() || (nullptr != thePacketHandler && false == HasReceivedData()))
 	{
-		theConnectingTimer += kStepTime;
+		theConnectingTimer += FixedTimeMS();
 	}
 	else if(nullptr != thePacketHandler)
 	{
-		thePacketHandler->FixedUpdate(10);
+		thePacketHandler->FixedUpdate(FixedTimeMS());
 
-		theSendUpdateTimer += kStepTime;
+		theSendUpdateTimer += FixedTimeMS();
 		if (theSendUpdateTimer >= theMaximiumTimeToSendUpdate)
 		{
 			theSendUpdateTimer = 0;
@@ -500,7 +499,7 @@ void LudumDare56::Network::Simulate(void)
 		}
 		else
 		{
-			timer += kStepTime;
+			timer += FixedTimeMS();
 		}
 
 		if (false == IsServerConnection())
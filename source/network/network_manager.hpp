@@ -62,7 +62,7 @@ namespace LudumDare56
 		tbCore::uint8 GetPacketsPerSecond(void);
 
 		///
-		/// @note This only has 10ms (or FixedTime steps) due to using Simulate() for polling things. Perhaps using
+		/// @note This only has FixedTimeMS() steps due to using Simulate() for polling things. Perhaps using
 		///   an update could be better, possibly even a separate thread in the future etc...
 		///
 		void SetPacketsPerSecond(const tbCore::uint8 packetsPerSecond);
@@ -343,6 +343,8 @@ LudumDare56::Network::RacetrackResponsePacket LudumDare56::Network::CreateRacetr
 	packet.type = PacketType::RacetrackResponse;
 	packet.phase = static_cast<byte>(GameState::RaceSessionState::GetSessionPhase());
 	packet.phaseTimer = GameState::RaceSessionState::GetPhaseTimer();
+	packet.tickRate = GetTickRate();
+	packet.creaturesPerRacecar = GameState::RaceSessionState::GetCreaturesPerRacecar();
 	packet.loadingTag = loadingTag;
 
 	tbCore::tbString racetrackName = GameState::RacetrackState::GetCurrentRacetrack();
@@ -29,7 +29,7 @@ namespace LudumDare56
 		typedef GameState::DriverIndex DriverIndex;
 		typedef GameState::RacecarIndex RacecarIndex;
 
-		constexpr tbCore::uint8 PacketVersion(void) { return 1; }
+		constexpr tbCore::uint8 PacketVersion(void) { return 3; } //3: RacetrackResponse carries the swarm size, 2: the tick rate.
 
 		enum class PacketSizeType : tbCore::uint8 { };
 		typedef tbCore::TypedInteger<PacketSizeType> PacketSize;
@@ -264,6 +264,8 @@ namespace LudumDare56
 			byte loadingTag;
 			tbCore::FixedString<32> racetrack;
 			tbCore::uint32 phaseTimer;
+			tbCore::uint32 tickRate; //The client must simulate at the same rate as the GameServer.
+			tbCore::uint16 creaturesPerRacecar; //And with the same number of creatures in each swarm.
 		};
 
 		struct ControllerInfo
@@ -29,7 +29,7 @@ LudumDare56::Network::NetworkedRacecarController::~NetworkedRacecarController(vo
 
 void LudumDare56::Network::NetworkedRacecarController::OnUpdateControls(void)
 {
-	mLastUpdateTimer += 10;
+	mLastUpdateTimer += FixedTimeMS();
 
 	SetSteeringValue(mControllerInfo.steering);
 	SetThrottleValue(mControllerInfo.throttle);